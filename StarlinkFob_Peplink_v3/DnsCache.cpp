@@ -0,0 +1,158 @@
+#include <WiFi.h>
+
+#include "DnsCache.h"
+#include "config.h"
+
+#if CONFIG_FREERTOS_UNICORE
+#define ARDUINO_RUNNING_CORE 0
+#else
+#define ARDUINO_RUNNING_CORE 1
+#endif
+
+DnsCache::DnsCache()
+{
+  _task = NULL;
+  _lock = xSemaphoreCreateMutex();
+  memset(_entries, 0, sizeof(_entries));
+}
+
+void DnsCache::begin()
+{
+  if (!_task)
+    xTaskCreatePinnedToCore(_prefetchTask, "DNS Prefetch", 4096, this, 1, &_task, ARDUINO_RUNNING_CORE);
+}
+
+bool DnsCache::resolve(const char *host, IPAddress &ip, uint32_t *latencyMs)
+{
+  if (latencyMs)
+    *latencyMs = 0;
+  if (ip.fromString(host))
+    return true;
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  DnsCache_Entry *entry = _find(host);
+  DnsCache_Entry found;
+  bool fresh = false;
+  if (entry)
+  {
+    uint32_t age = millis() - entry->resolvedAt;
+    fresh = age < entry->lifetimeMs;
+
+    // Refresh names in use before they expire. Failures aren't prefetched, so a dead name costs one lookup per lifetime
+    if (fresh && entry->addr && !entry->prefetch && _task && age + DNS_CACHE_PREFETCH_MS >= entry->lifetimeMs)
+    {
+      entry->prefetch = true;
+      xTaskNotifyGive(_task);
+    }
+    found = *entry;
+  }
+  xSemaphoreGive(_lock);
+
+  if (!fresh)
+    found = _lookup(host);
+
+  if (latencyMs)
+    *latencyMs = found.latencyMs;
+  ip = IPAddress(found.addr);
+  return found.addr != 0;
+}
+
+void DnsCache::clear()
+{
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  memset(_entries, 0, sizeof(_entries));
+  xSemaphoreGive(_lock);
+}
+
+DnsCache_Entry DnsCache::_lookup(const char *host)
+{
+  IPAddress ip;
+  uint32_t start = millis();
+  bool ok = WiFi.hostByName(host, ip) == 1;
+  uint32_t latency = millis() - start;
+#ifdef DNS_DEBUG_LOG
+  Serial.printf("DNS lookup %s -> %s in %lums\n", host, ok ? ip.toString().c_str() : "FAIL", latency);
+#endif
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  DnsCache_Entry *entry = _find(host);
+  if (!entry)
+  {
+    // Take a free entry, or else the one resolved longest ago
+    entry = &_entries[0];
+    for (DnsCache_Entry &candidate : _entries)
+    {
+      if (!candidate.host[0])
+      {
+        entry = &candidate;
+        break;
+      }
+      if ((int32_t)(candidate.resolvedAt - entry->resolvedAt) < 0)
+        entry = &candidate;
+    }
+    strncpy(entry->host, host, sizeof(entry->host) - 1);
+    entry->host[sizeof(entry->host) - 1] = '\0';
+  }
+  else if (!ok && entry->addr && millis() - entry->resolvedAt < entry->lifetimeMs)
+  {
+    // A failed prefetch keeps the address that is still good
+    entry->prefetch = false;
+    DnsCache_Entry copy = *entry;
+    xSemaphoreGive(_lock);
+    return copy;
+  }
+  entry->addr = ok ? (uint32_t)ip : 0;
+  entry->resolvedAt = millis();
+  entry->lifetimeMs = ok ? DNS_CACHE_TTL_MS : DNS_CACHE_NEGATIVE_TTL_MS;
+  entry->latencyMs = latency;
+  entry->prefetch = false;
+  DnsCache_Entry copy = *entry;
+  xSemaphoreGive(_lock);
+  return copy;
+}
+
+DnsCache_Entry *DnsCache::_find(const char *host)
+{
+  for (DnsCache_Entry &entry : _entries)
+    if (entry.host[0] && !strncmp(entry.host, host, sizeof(entry.host) - 1))
+      return &entry;
+  return NULL;
+}
+
+void DnsCache::_prefetchTask(void *arg)
+{
+  DnsCache *cache = (DnsCache *)arg;
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // Look up one queued name at a time, without holding the cache across the lookup
+    for (;;)
+    {
+      char host[DNS_CACHE_HOST_MAX_LEN] = "";
+      xSemaphoreTake(cache->_lock, portMAX_DELAY);
+      for (DnsCache_Entry &entry : cache->_entries)
+      {
+        if (entry.host[0] && entry.prefetch)
+        {
+          strcpy(host, entry.host);
+          break;
+        }
+      }
+      xSemaphoreGive(cache->_lock);
+
+      if (!host[0])
+        break;
+      if (WiFi.status() != WL_CONNECTED)
+      {
+        // Leave the names to be looked up when next read
+        xSemaphoreTake(cache->_lock, portMAX_DELAY);
+        for (DnsCache_Entry &entry : cache->_entries)
+          entry.prefetch = false;
+        xSemaphoreGive(cache->_lock);
+        break;
+      }
+      cache->_lookup(host);
+    }
+  }
+}
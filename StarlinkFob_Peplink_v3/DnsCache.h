@@ -0,0 +1,68 @@
+/**
+ * @file  DnsCache.h
+ * @brief Cache of resolved host names shared by the ping targets and the router connection
+ */
+
+#ifndef _STARLINKFOB_DNSCACHE_H_
+#define _STARLINKFOB_DNSCACHE_H_
+
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <freertos/semphr.h>
+
+#include "config.h"
+
+/// @brief A host name and the outcome of its last lookup
+typedef struct
+{
+    char host[DNS_CACHE_HOST_MAX_LEN];
+    uint32_t addr;          // Resolved IPv4 address. 0 if the lookup failed
+    uint32_t resolvedAt;    // millis() at which the last lookup finished. The entry is unused if the host is empty
+    uint32_t lifetimeMs;    // How long the outcome is trusted: DNS_CACHE_TTL_MS for an address, DNS_CACHE_NEGATIVE_TTL_MS for a failure
+    uint32_t latencyMs;     // Duration of the last lookup
+    bool prefetch;          // Queued for the background task to look up again before it expires
+} DnsCache_Entry;
+
+/// @brief Remembers resolved host names, and failed lookups for a shorter time, so callers that resolve
+/// the same names over and over only wait on the network once per lifetime.
+/// A name read within DNS_CACHE_PREFETCH_MS of its expiry is looked up again by a background task,
+/// so names in steady use never make their caller wait
+/// @note  The lifetimes are fixed since the lwIP resolver doesn't expose the record TTL. lwIP's own table still
+///        honours the TTL, so a prefetch after the record has expired goes to the DNS server
+class DnsCache
+{
+public:
+    DnsCache();
+
+    /// @brief Start the background task that prefetches names about to expire
+    void begin();
+
+    /// @brief Resolve \a host, answering from the cache while its entry is fresh.
+    /// Dotted IPv4 addresses are parsed without being cached
+    /// @param latencyMs If not NULL, set to the duration of the lookup the answer came from, which may have been cached
+    /// @return true if \a host resolved, with its address in \a ip
+    /// @return false if the lookup failed now or within DNS_CACHE_NEGATIVE_TTL_MS
+    bool resolve(const char *host, IPAddress &ip, uint32_t *latencyMs = NULL);
+
+    /// @brief Forget every cached name, e.g. after joining another network
+    void clear();
+
+private:
+    /// @brief Look \a host up on the network and store the outcome
+    /// @return Copy of the stored entry
+    DnsCache_Entry _lookup(const char *host);
+
+    /// @brief Return the entry of \a host, or NULL. Must be called with the cache held
+    DnsCache_Entry *_find(const char *host);
+
+    /// @brief Look up the names queued for prefetching whenever woken
+    static void _prefetchTask(void *arg);
+
+    TaskHandle_t _task;
+    SemaphoreHandle_t _lock;
+    DnsCache_Entry _entries[DNS_CACHE_SIZE];
+};
+
+#endif
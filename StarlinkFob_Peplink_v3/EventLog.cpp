@@ -0,0 +1,209 @@
+#include <string.h>
+
+#include "EventLog.h"
+
+/// @brief Number of records read at a time when scanning the log backwards
+#define EVENT_LOG_READ_BATCH 16
+
+EventLog::EventLog()
+{
+  _file = NULL;
+  _path[0] = '\0';
+  _capacity = 0;
+  _nextSeq = 1;
+}
+
+EventLog::~EventLog()
+{
+  end();
+}
+
+bool EventLog::begin(const char *path, size_t capacity)
+{
+  end();
+  if (!capacity)
+    return false;
+  strncpy(_path, path, sizeof(_path) - 1);
+  _path[sizeof(_path) - 1] = '\0';
+  _capacity = capacity;
+  _nextSeq = 1;
+
+  _file = fopen(_path, "r+b");
+  if (!_file)
+    return _reset();
+
+  fseek(_file, 0, SEEK_END);
+  long size = ftell(_file);
+  size_t used = (size > 0) ? (size_t)size / sizeof(EventLog_Record) : 0;
+  if (used > _capacity)
+    return _reset();
+  if (!used)
+    return true;
+
+  if (used < _capacity)
+  {
+    // Not wrapped yet, so slot i holds event i + 1. A record torn by a power loss is written over
+    uint32_t last = _seqAt(used - 1);
+    if (last == used)
+      _nextSeq = used + 1;
+    else if (used == 1 || _seqAt(used - 2) == used - 1)
+      _nextSeq = used;
+    else
+      return _reset();
+    return true;
+  }
+
+  // Full: the sequence numbers rise from slot 0 to the newest event, then drop to the oldest.
+  // Find the first slot past slot 0 that doesn't continue the rise, a torn record counting as a drop
+  uint32_t first = _seqAt(0);
+  if (!first)
+  {
+    // Slot 0 was being written over. The event before it is in the last slot
+    uint32_t newest = _seqAt(_capacity - 1);
+    if (!newest)
+      return _reset();
+    _nextSeq = newest + 1;
+    return true;
+  }
+  size_t low = 1, high = _capacity;
+  while (low < high)
+  {
+    size_t mid = low + (high - low) / 2;
+    uint32_t seq = _seqAt(mid);
+    if (seq && seq > first)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  _nextSeq = (low == 1 ? first : _seqAt(low - 1)) + 1;
+  return true;
+}
+
+void EventLog::end()
+{
+  if (_file)
+    fclose(_file);
+  _file = NULL;
+}
+
+bool EventLog::append(uint8_t type, uint32_t time, int32_t value, uint8_t subject, uint8_t detail)
+{
+  if (!_file)
+    return false;
+
+  EventLog_Record record;
+  memset(&record, 0, sizeof(record));
+  record.seq = _nextSeq;
+  record.time = time;
+  record.type = type;
+  record.subject = subject;
+  record.detail = detail;
+  record.value = value;
+  record.check = _checksum(record);
+
+  size_t slot = (record.seq - 1) % _capacity;
+  if (fseek(_file, slot * sizeof(record), SEEK_SET) ||
+      fwrite(&record, sizeof(record), 1, _file) != 1 ||
+      fflush(_file))
+    return false;
+  _nextSeq++;
+  return true;
+}
+
+size_t EventLog::read(EventLog_Record *records, size_t maxRecords, uint32_t beforeSeq)
+{
+  uint32_t first = firstSeq();
+  if (!_file || !first || beforeSeq <= first)
+    return 0;
+
+  // Read backwards from the newest event asked for, a batch of consecutive slots at a time
+  uint32_t seq = (beforeSeq > _nextSeq) ? _nextSeq - 1 : beforeSeq - 1;
+  size_t copied = 0;
+  EventLog_Record batch[EVENT_LOG_READ_BATCH];
+  while (copied < maxRecords && seq >= first)
+  {
+    size_t slot = (seq - 1) % _capacity;
+    size_t count = slot + 1;
+    if (count > EVENT_LOG_READ_BATCH)
+      count = EVENT_LOG_READ_BATCH;
+    if (count > seq - first + 1)
+      count = seq - first + 1;
+    if (_readSlots(slot + 1 - count, batch, count) != count)
+      break;
+
+    for (size_t i = count; i-- > 0 && copied < maxRecords; --seq)
+    {
+      // Skip records that don't hold the event expected, e.g. one torn by a power loss
+      if (_valid(batch[i], slot + 1 - count + i) && batch[i].seq == seq)
+        records[copied++] = batch[i];
+    }
+  }
+  return copied;
+}
+
+bool EventLog::findLast(uint8_t type, EventLog_Record &record)
+{
+  EventLog_Record batch[EVENT_LOG_READ_BATCH];
+  uint32_t before = UINT32_MAX;
+  size_t count;
+  while ((count = read(batch, EVENT_LOG_READ_BATCH, before)) > 0)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (batch[i].type == type)
+      {
+        record = batch[i];
+        return true;
+      }
+    }
+    before = batch[count - 1].seq;
+  }
+  return false;
+}
+
+uint32_t EventLog::firstSeq() const
+{
+  if (_nextSeq == 1)
+    return 0;
+  return (_nextSeq - 1 > _capacity) ? _nextSeq - _capacity : 1;
+}
+
+size_t EventLog::_readSlots(size_t slot, EventLog_Record *records, size_t count)
+{
+  if (fseek(_file, slot * sizeof(EventLog_Record), SEEK_SET))
+    return 0;
+  return fread(records, sizeof(EventLog_Record), count, _file);
+}
+
+bool EventLog::_valid(const EventLog_Record &record, size_t slot) const
+{
+  return record.seq && record.check == _checksum(record) && (record.seq - 1) % _capacity == slot;
+}
+
+uint32_t EventLog::_seqAt(size_t slot)
+{
+  EventLog_Record record;
+  if (_readSlots(slot, &record, 1) != 1 || !_valid(record, slot))
+    return 0;
+  return record.seq;
+}
+
+bool EventLog::_reset()
+{
+  if (_file)
+    fclose(_file);
+  _file = fopen(_path, "w+b");
+  _nextSeq = 1;
+  return _file != NULL;
+}
+
+uint8_t EventLog::_checksum(const EventLog_Record &record)
+{
+  // Seeded, so that a record of zeros, as in a freshly erased or padded area, isn't valid
+  const uint8_t *bytes = (const uint8_t *)&record;
+  uint8_t sum = 0xA5;
+  for (size_t i = 0; i < sizeof(record); ++i)
+    if (i != offsetof(EventLog_Record, check))
+      sum = (sum << 1 | sum >> 7) ^ bytes[i];
+  return sum;
+}
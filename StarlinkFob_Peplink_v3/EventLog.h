@@ -0,0 +1,101 @@
+/**
+ * @file  EventLog.h
+ * @brief Append-only log of fixed-size event records kept in a circular file
+ */
+
+#ifndef _STARLINKFOB_EVENTLOG_H_
+#define _STARLINKFOB_EVENTLOG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "config.h"
+
+/// @brief Kinds of event logged
+typedef enum
+{
+    EVENT_LOG_BOOT = 1,         // value: esp_reset_reason()
+    EVENT_LOG_SHUTDOWN,         // value: seconds since boot
+    EVENT_LOG_REBOOT,           // Reboot asked for from the menu. value: seconds since boot
+    EVENT_LOG_TEMP_ALERT,       // value: temperature in hundredths of a degree F. detail: threshold in degrees F
+    EVENT_LOG_WIFI_DOWN,        // Wi-Fi STA connection lost
+    EVENT_LOG_WAN_CHANGE,       // subject: WAN ID. detail: WanHistory_Led_t of its new status LED
+    EVENT_LOG_ROUTER_AUTH_FAIL, // value: error code of the failed login
+} EventLog_Type_t;
+
+/// @brief One logged event, stored as is in the file
+typedef struct
+{
+    uint32_t seq;           // Number of the event since the log was created, from 1. Also gives the record's slot in the file
+    uint32_t time;          // When the event happened, in seconds since 1970 of the RTC's wall clock. 0 if unknown
+    uint8_t type;           // EventLog_Type_t
+    uint8_t subject;
+    uint8_t detail;
+    uint8_t check;          // Checksum of the other bytes, so a record torn by a power loss is spotted
+    int32_t value;
+} EventLog_Record;
+
+/// @brief Keeps the last \a capacity events in one file of fixed-size records. Event n goes to slot (n - 1) % capacity,
+/// so the file fills once and then wraps around, overwriting the oldest event, and any event is read with one seek.
+/// Writing round the file spreads the writes over all its pages rather than wearing the same ones,
+/// and the flash file system levels wear underneath.
+/// On begin(), the newest event is found by a binary search for the point where the sequence numbers wrap.
+/// @note  Only uses C stdio, so it also runs against a plain file on a host. On the fob the file lives on SPIFFS,
+///        which the VFS mounts under /spiffs. Not thread-safe: logEvent() serialises the fob's writers
+class EventLog
+{
+public:
+    EventLog();
+    ~EventLog();
+
+    /// @brief Open the log at \a path, creating it if it doesn't exist, and find where the next event goes.
+    /// A log that doesn't make sense, e.g. one written with another capacity, is started afresh
+    /// @return false if the file couldn't be opened
+    bool begin(const char *path, size_t capacity = EVENT_LOG_CAPACITY);
+
+    /// @brief Close the log
+    void end();
+
+    /// @brief Append an event, overwriting the oldest once the log is full
+    /// @return false if it couldn't be written
+    bool append(uint8_t type, uint32_t time, int32_t value = 0, uint8_t subject = 0, uint8_t detail = 0);
+
+    /// @brief Copy the events older than \a beforeSeq into \a records, newest first.
+    /// Pass the seq of the last record copied to read the next page
+    /// @return Number of records copied
+    size_t read(EventLog_Record *records, size_t maxRecords, uint32_t beforeSeq = UINT32_MAX);
+
+    /// @brief Find the newest event of a \a type
+    /// @return false if none is kept
+    bool findLast(uint8_t type, EventLog_Record &record);
+
+    /// @brief Return the seq of the newest event. 0 if the log is empty
+    uint32_t lastSeq() const { return _nextSeq - 1; }
+
+    /// @brief Return the seq of the oldest event kept. 0 if the log is empty
+    uint32_t firstSeq() const;
+
+private:
+    /// @brief Read the records of \a count consecutive slots from \a slot
+    /// @return Number of records read
+    size_t _readSlots(size_t slot, EventLog_Record *records, size_t count);
+
+    /// @brief Return whether \a record is intact and belongs in \a slot
+    bool _valid(const EventLog_Record &record, size_t slot) const;
+
+    /// @brief Return the seq of the record in \a slot, or 0 if there is no valid one
+    uint32_t _seqAt(size_t slot);
+
+    /// @brief Empty the file and start again from event 1
+    bool _reset();
+
+    static uint8_t _checksum(const EventLog_Record &record);
+
+    FILE *_file;
+    char _path[EVENT_LOG_PATH_MAX_LEN];
+    size_t _capacity;
+    uint32_t _nextSeq;
+};
+
+#endif
@@ -0,0 +1,199 @@
+#include <WiFi.h>
+
+#include "LinkMonitor.h"
+#include "config.h"
+
+#if CONFIG_FREERTOS_UNICORE
+#define ARDUINO_RUNNING_CORE 0
+#else
+#define ARDUINO_RUNNING_CORE 1
+#endif
+
+#define LINK_MONITOR_EPOCH_MS (LINK_MONITOR_WINDOW_MS / LINK_MONITOR_EPOCHS)
+
+/// @brief Upper bound in milliseconds of each RTT bucket, the lower bound being that of the one before.
+/// The buckets are finest where satellite and cellular RTTs usually lie and widen towards the timeout
+static const uint16_t bucketUpperMs[LINK_MONITOR_BUCKETS] = {
+  1, 2, 3, 4, 5, 6, 8, 10,
+  12, 15, 20, 25, 30, 40, 50, 60,
+  80, 100, 120, 150, 200, 250, 300, 400,
+  500, 600, 800, 1000, 1500, 2000, 3000, UINT16_MAX
+};
+
+static size_t bucketOf(uint32_t rttUs)
+{
+  for (size_t i = 0; i < LINK_MONITOR_BUCKETS - 1; ++i)
+    if (rttUs < (uint32_t)bucketUpperMs[i] * 1000)
+      return i;
+  return LINK_MONITOR_BUCKETS - 1;
+}
+
+/// @brief Return the RTT below which \a percent of the \a total replies in \a histogram lie,
+/// assuming the replies are spread evenly within their bucket
+static uint32_t percentileUs(const uint32_t *histogram, uint32_t total, uint8_t percent)
+{
+  if (!total)
+    return 0;
+
+  uint32_t rank = (total * percent + 99) / 100;
+  uint32_t below = 0;
+  for (size_t i = 0; i < LINK_MONITOR_BUCKETS; ++i)
+  {
+    if (below + histogram[i] >= rank)
+    {
+      uint32_t lowerUs = i ? (uint32_t)bucketUpperMs[i - 1] * 1000 : 0;
+      // The last bucket has no upper bound, so report its lower one
+      if (i == LINK_MONITOR_BUCKETS - 1)
+        return lowerUs;
+      uint32_t widthUs = (uint32_t)bucketUpperMs[i] * 1000 - lowerUs;
+      return lowerUs + (uint64_t)widthUs * (rank - below) / histogram[i];
+    }
+    below += histogram[i];
+  }
+  return 0;
+}
+
+LinkMonitor::LinkMonitor()
+{
+  _dns = NULL;
+  _task = NULL;
+  _lock = xSemaphoreCreateMutex();
+  _socket = NETDIAG_SOCKET_INIT;
+  _epoch = 0;
+  _targetCount = 0;
+  memset(_targets, 0, sizeof(_targets));
+}
+
+bool LinkMonitor::addTarget(const char *name, const char *host)
+{
+  if (_task || _targetCount >= LINK_MONITOR_MAX_TARGETS)
+    return false;
+
+  LinkMonitor_Target &target = _targets[_targetCount++];
+  strncpy(target.name, name, sizeof(target.name) - 1);
+  strncpy(target.host, host, sizeof(target.host) - 1);
+  target.dnsOK = true;
+  return true;
+}
+
+void LinkMonitor::begin(DnsCache *dns)
+{
+  _dns = dns;
+  if (!_task && _targetCount)
+    xTaskCreatePinnedToCore(_probeTask, "Link Monitor", 4096, this, 1, &_task, ARDUINO_RUNNING_CORE);
+}
+
+bool LinkMonitor::stats(size_t index, LinkMonitor_Stats &stats)
+{
+  if (index >= _targetCount)
+    return false;
+
+  uint32_t histogram[LINK_MONITOR_BUCKETS] = {};
+  uint32_t sent = 0, received = 0;
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _rollEpochs();
+  LinkMonitor_Target &target = _targets[index];
+  for (size_t epoch = 0; epoch < LINK_MONITOR_EPOCHS; ++epoch)
+  {
+    for (size_t i = 0; i < LINK_MONITOR_BUCKETS; ++i)
+      histogram[i] += target.histogram[epoch][i];
+    sent += target.sent[epoch];
+    received += target.received[epoch];
+  }
+  stats.name = target.name;
+  stats.host = target.host;
+  stats.jitterUs = target.jitterUs;
+  stats.lastRttUs = target.lastRttUs;
+  stats.dnsOK = target.dnsOK;
+  xSemaphoreGive(_lock);
+
+  stats.probes = sent;
+  stats.replies = received;
+  stats.lossPercent = sent ? 100 - (received * 100) / sent : 0;
+  stats.p50Us = percentileUs(histogram, received, 50);
+  stats.p95Us = percentileUs(histogram, received, 95);
+  stats.p99Us = percentileUs(histogram, received, 99);
+  return true;
+}
+
+void LinkMonitor::_rollEpochs()
+{
+  uint32_t epoch = millis() / LINK_MONITOR_EPOCH_MS;
+  uint32_t passed = epoch - _epoch;
+  if (!passed)
+    return;
+  if (passed > LINK_MONITOR_EPOCHS)
+    passed = LINK_MONITOR_EPOCHS;
+
+  // Clear the slots the epochs since the last probe will use, oldest data first
+  for (uint32_t n = 1; n <= passed; ++n)
+  {
+    size_t slot = (_epoch + n) % LINK_MONITOR_EPOCHS;
+    for (size_t i = 0; i < _targetCount; ++i)
+    {
+      memset(_targets[i].histogram[slot], 0, sizeof(_targets[i].histogram[slot]));
+      _targets[i].sent[slot] = 0;
+      _targets[i].received[slot] = 0;
+    }
+  }
+  _epoch = epoch;
+}
+
+void LinkMonitor::_probe()
+{
+  NetDiag_PingResult results[LINK_MONITOR_MAX_TARGETS];
+  bool dnsOK[LINK_MONITOR_MAX_TARGETS];
+  for (size_t i = 0; i < _targetCount; ++i)
+  {
+    IPAddress ip;
+    dnsOK[i] = _dns ? _dns->resolve(_targets[i].host, ip) : ip.fromString(_targets[i].host);
+    results[i].addr = dnsOK[i] ? (uint32_t)ip : 0;
+  }
+
+  netDiagSweep(&_socket, results, _targetCount, 1, LINK_MONITOR_TIMEOUT_MS, LINK_MONITOR_TIMEOUT_MS);
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _rollEpochs();
+  size_t slot = _epoch % LINK_MONITOR_EPOCHS;
+  for (size_t i = 0; i < _targetCount; ++i)
+  {
+    LinkMonitor_Target &target = _targets[i];
+    target.dnsOK = dnsOK[i];
+    if (!results[i].sent)
+      continue;
+
+    target.sent[slot]++;
+    if (!results[i].received)
+    {
+      target.lastRttUs = 0;
+      continue;
+    }
+
+    uint32_t rttUs = results[i].rttAvgUs;
+    target.received[slot]++;
+    target.histogram[slot][bucketOf(rttUs)]++;
+
+    // J += (|D| - J) / 16, taking D between consecutive replies only
+    if (target.lastRttUs)
+    {
+      int32_t d = (int32_t)(rttUs - target.lastRttUs);
+      uint32_t absD = d < 0 ? -d : d;
+      target.jitterUs += ((int32_t)absD - (int32_t)target.jitterUs) / 16;
+    }
+    target.lastRttUs = rttUs;
+  }
+  xSemaphoreGive(_lock);
+}
+
+void LinkMonitor::_probeTask(void *arg)
+{
+  LinkMonitor *monitor = (LinkMonitor *)arg;
+  TickType_t lastWake = xTaskGetTickCount();
+  for (;;)
+  {
+    if (WiFi.status() == WL_CONNECTED)
+      monitor->_probe();
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(LINK_MONITOR_INTERVAL_MS));
+  }
+}
@@ -0,0 +1,93 @@
+/**
+ * @file  LinkMonitor.h
+ * @brief Background probing of the ping targets, keeping rolling RTT, jitter and loss statistics
+ */
+
+#ifndef _STARLINKFOB_LINKMONITOR_H_
+#define _STARLINKFOB_LINKMONITOR_H_
+
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <freertos/semphr.h>
+
+#include "NetDiag.h"
+#include "DnsCache.h"
+#include "config.h"
+
+/// @brief Number of RTT histogram buckets. Their bounds are fixed in LinkMonitor.cpp
+#define LINK_MONITOR_BUCKETS 32
+
+/// @brief Link quality of a target over the last LINK_MONITOR_WINDOW_MS
+typedef struct
+{
+    const char *name;
+    const char *host;
+    uint32_t p50Us;         // RTT percentiles of the replies in the window, interpolated within their histogram bucket. 0 if none
+    uint32_t p95Us;
+    uint32_t p99Us;
+    uint32_t jitterUs;      // Smoothed difference between consecutive RTTs, as defined for RTP in RFC 3550
+    uint32_t lastRttUs;     // RTT of the last probe. 0 if it was lost
+    uint16_t probes;        // Probes sent in the window
+    uint16_t replies;       // Replies received in the window
+    uint8_t lossPercent;    // Share of the probes in the window that went unanswered
+    bool dnsOK;             // Whether the host resolved for the last probe. Probes that couldn't be sent don't count as lost
+} LinkMonitor_Stats;
+
+/// @brief A monitored target and its histograms.
+/// The window is split into LINK_MONITOR_EPOCHS epochs. The oldest epoch is cleared as a new one starts,
+/// so the statistics roll forward in fixed memory
+typedef struct
+{
+    char name[NAME_MAX_LEN];
+    char host[DNS_CACHE_HOST_MAX_LEN];
+    uint16_t histogram[LINK_MONITOR_EPOCHS][LINK_MONITOR_BUCKETS];
+    uint16_t sent[LINK_MONITOR_EPOCHS];
+    uint16_t received[LINK_MONITOR_EPOCHS];
+    uint32_t jitterUs;
+    uint32_t lastRttUs;
+    bool dnsOK;
+} LinkMonitor_Target;
+
+/// @brief Probes every target once per LINK_MONITOR_INTERVAL_MS in one concurrent sweep, whatever page is shown,
+/// so degradation is measured continuously rather than only while the diagnostics page is open
+class LinkMonitor
+{
+public:
+    LinkMonitor();
+
+    /// @brief Add a target to probe. Must be called before begin()
+    /// @param host Dotted IPv4 address or host name, resolved through the DNS cache
+    /// @return false if LINK_MONITOR_MAX_TARGETS targets are already monitored
+    bool addTarget(const char *name, const char *host);
+
+    /// @brief Start the background task that probes the targets
+    void begin(DnsCache *dns);
+
+    /// @brief Return the number of monitored targets
+    size_t targetCount() const { return _targetCount; }
+
+    /// @brief Get the statistics of the target at \a index over the current window
+    /// @return false if there is no such target
+    bool stats(size_t index, LinkMonitor_Stats &stats);
+
+private:
+    /// @brief Probe the targets every LINK_MONITOR_INTERVAL_MS while Wi-Fi is connected
+    static void _probeTask(void *arg);
+
+    /// @brief Resolve and probe every target once, and record the outcome
+    void _probe();
+
+    /// @brief Clear the epochs that ended since the last probe. Must be called with the monitor held
+    void _rollEpochs();
+
+    DnsCache *_dns;
+    TaskHandle_t _task;
+    SemaphoreHandle_t _lock;
+    NetDiag_Socket _socket;
+    uint32_t _epoch;            // Number of the current epoch since boot
+    LinkMonitor_Target _targets[LINK_MONITOR_MAX_TARGETS];
+    size_t _targetCount;
+};
+
+#endif
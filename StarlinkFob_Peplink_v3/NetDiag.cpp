@@ -0,0 +1,205 @@
+#include <string.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+
+#include "NetDiag.h"
+
+#define ICMP_ECHO_REPLY     0
+#define ICMP_ECHO_REQUEST   8
+
+/// @brief Number of bits of the echo sequence number holding the probe number. The rest hold the target index
+#define NETDIAG_PROBE_BITS  4
+
+/// @brief Echo request sent by a sweep.
+/// The payload identifies the sweep and the probe again, since ICMP datagram sockets replace the identifier
+typedef struct __attribute__((packed))
+{
+  uint8_t type;
+  uint8_t code;
+  uint16_t checksum;
+  uint16_t id;
+  uint16_t seq;         // Target index and probe number, in network byte order
+  uint32_t token;       // Identifies the sweep, so replies to anything else pinging from this host are ignored
+  uint32_t sentUs;      // When the request was sent, to time the reply without keeping any state per request
+  uint16_t target;
+  uint8_t probe;
+} NetDiagEcho;
+
+static uint32_t sweepCount;
+
+static uint64_t nowUs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint16_t icmpChecksum(const void *data, size_t len)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t sum = 0;
+  for (size_t i = 0; i + 1 < len; i += 2)
+    sum += (bytes[i] << 8) | bytes[i + 1];
+  if (len & 1)
+    sum += bytes[len - 1] << 8;
+  while (sum >> 16)
+    sum = (sum & 0xFFFF) + (sum >> 16);
+  return htons(~sum);
+}
+
+/// @brief Open \a sock if it isn't already
+static bool openSweepSocket(NetDiag_Socket *sock)
+{
+  if (sock->fd >= 0)
+    return true;
+
+  sock->fd = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+#ifdef __linux__
+  // Unprivileged ping socket, allowed by net.ipv4.ping_group_range
+  if (sock->fd < 0)
+    sock->fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_ICMP);
+#endif
+  return sock->fd >= 0;
+}
+
+/// @brief Send probe \a probe to every host that has an address
+static void sendRound(int fd, NetDiag_PingResult *results, size_t count, uint8_t probe, uint32_t token)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (!results[i].addr)
+      continue;
+
+    NetDiagEcho echo;
+    memset(&echo, 0, sizeof(echo));
+    echo.type = ICMP_ECHO_REQUEST;
+    echo.id = htons(token & 0xFFFF);
+    echo.seq = htons((i << NETDIAG_PROBE_BITS) | probe);
+    echo.token = token;
+    echo.target = i;
+    echo.probe = probe;
+    echo.sentUs = (uint32_t)nowUs();
+    echo.checksum = icmpChecksum(&echo, sizeof(echo));
+
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = results[i].addr;
+    if (sendto(fd, &echo, sizeof(echo), 0, (struct sockaddr *)&to, sizeof(to)) == sizeof(echo))
+      results[i].sent++;
+  }
+}
+
+/// @brief Read every reply waiting on the socket into the results
+/// @return Number of new replies matched to a probe of this sweep
+static size_t receiveReplies(int fd, NetDiag_PingResult *results, size_t count, uint8_t probes, uint32_t token,
+                             uint16_t *seen, uint64_t *rttSumUs)
+{
+  size_t matched = 0;
+  uint8_t buffer[128];
+  for (;;)
+  {
+    struct sockaddr_in from;
+    socklen_t fromLen = sizeof(from);
+    int len = recvfrom(fd, buffer, sizeof(buffer), MSG_DONTWAIT, (struct sockaddr *)&from, &fromLen);
+    if (len <= 0)
+      return matched;
+    uint32_t receivedUs = (uint32_t)nowUs();
+
+    // Raw sockets hand over the IP header too, datagram sockets don't
+    size_t offset = 0;
+    if ((buffer[0] >> 4) == 4)
+      offset = (buffer[0] & 0x0F) * 4;
+    if ((size_t)len < offset + sizeof(NetDiagEcho))
+      continue;
+
+    NetDiagEcho echo;
+    memcpy(&echo, buffer + offset, sizeof(echo));
+    if (echo.type != ICMP_ECHO_REPLY || echo.token != token || echo.target >= count || echo.probe >= probes)
+      continue;
+    if (ntohs(echo.seq) != ((echo.target << NETDIAG_PROBE_BITS) | echo.probe))
+      continue;
+
+    NetDiag_PingResult &result = results[echo.target];
+    if (from.sin_addr.s_addr != result.addr || (seen[echo.target] & (1 << echo.probe)))
+      continue;
+    seen[echo.target] |= 1 << echo.probe;
+
+    uint32_t rttUs = receivedUs - echo.sentUs;
+    if (!result.received || rttUs < result.rttMinUs)
+      result.rttMinUs = rttUs;
+    if (rttUs > result.rttMaxUs)
+      result.rttMaxUs = rttUs;
+    rttSumUs[echo.target] += rttUs;
+    result.received++;
+    matched++;
+  }
+}
+
+bool netDiagSweep(NetDiag_Socket *sock, NetDiag_PingResult *results, size_t count, uint8_t probes, uint32_t intervalMs, uint32_t timeoutMs)
+{
+  if (count > NETDIAG_MAX_TARGETS)
+    count = NETDIAG_MAX_TARGETS;
+  if (probes > (1 << NETDIAG_PROBE_BITS))
+    probes = 1 << NETDIAG_PROBE_BITS;
+
+  size_t expected = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    results[i].sent = 0;
+    results[i].received = 0;
+    results[i].rttMinUs = 0;
+    results[i].rttAvgUs = 0;
+    results[i].rttMaxUs = 0;
+    results[i].lossPercent = 100;
+    if (results[i].addr)
+      expected += probes;
+  }
+
+  if (!openSweepSocket(sock))
+    return false;
+
+  // Replies still arriving from an earlier sweep carry its token and are dropped
+  uint32_t token = (uint32_t)nowUs() ^ (++sweepCount << 16);
+  uint16_t seen[NETDIAG_MAX_TARGETS] = {};
+  uint64_t rttSumUs[NETDIAG_MAX_TARGETS] = {};
+  size_t received = 0;
+
+  uint8_t probe = 0;
+  uint64_t nextRound = nowUs();
+  uint64_t deadline = nextRound + ((uint64_t)(probes ? probes - 1 : 0) * intervalMs + timeoutMs) * 1000;
+  while (probe < probes || received < expected)
+  {
+    uint64_t now = nowUs();
+    if (probe < probes && now >= nextRound)
+    {
+      sendRound(sock->fd, results, count, probe++, token);
+      nextRound += (uint64_t)intervalMs * 1000;
+      continue;
+    }
+    if (now >= deadline)
+      break;
+
+    // Sleep until a reply arrives, the next round is due or the sweep times out
+    uint64_t wakeUp = (probe < probes && nextRound < deadline) ? nextRound : deadline;
+    struct timeval wait;
+    wait.tv_sec = (wakeUp - now) / 1000000;
+    wait.tv_usec = (wakeUp - now) % 1000000;
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(sock->fd, &readable);
+    if (select(sock->fd + 1, &readable, NULL, NULL, &wait) > 0)
+      received += receiveReplies(sock->fd, results, count, probes, token, seen, rttSumUs);
+  }
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (results[i].received)
+      results[i].rttAvgUs = rttSumUs[i] / results[i].received;
+    if (results[i].sent)
+      results[i].lossPercent = 100 - (results[i].received * 100) / results[i].sent;
+  }
+  return true;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file  NetDiag.h
+ * @brief Concurrent ICMP echo sweep used by the network diagnostics page
+ */
+
+#ifndef _STARLINKFOB_NETDIAG_H_
+#define _STARLINKFOB_NETDIAG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "config.h"
+
+/// @brief A host pinged in a sweep, and how it answered
+typedef struct
+{
+    uint32_t addr;          // IPv4 address in network byte order. The host is skipped if 0, e.g. when it couldn't be resolved
+    uint8_t sent;           // Echo requests sent
+    uint8_t received;       // Echo replies received before the sweep timed out
+    uint8_t lossPercent;    // Share of the requests sent that went unanswered. 100 if none could be sent
+    uint32_t rttMinUs;      // Round-trip times of the replies received. 0 if none were
+    uint32_t rttAvgUs;
+    uint32_t rttMaxUs;
+} NetDiag_PingResult;
+
+/// @brief ICMP socket a sweep pings from, opened by the first sweep and kept open for the next.
+/// Each task sweeping concurrently needs its own, since a sweep reads every reply waiting on its socket.
+/// Initialise with NETDIAG_SOCKET_INIT
+typedef struct
+{
+    int fd;
+} NetDiag_Socket;
+
+#define NETDIAG_SOCKET_INIT {-1}
+
+/// @brief Ping all \a count hosts at once.
+/// Every host is sent \a probes echo requests, one round every \a intervalMs, and the replies of all hosts are
+/// collected by one receive loop until they are all in or \a timeoutMs has passed since the last round was sent.
+/// A sweep therefore takes about (probes - 1) * intervalMs + timeoutMs however many hosts are down.
+/// @note  Only depends on BSD sockets, so it also builds and runs on a Linux host, where it falls back
+///        to an unprivileged ICMP datagram socket if it isn't allowed to open a raw one
+/// @param sock Socket to ping from. Keeping it in static storage means a task deleted mid-sweep doesn't leak it
+/// @param results Hosts to ping, filled in with their statistics. At most NETDIAG_MAX_TARGETS are pinged
+/// @return false if no ICMP socket could be opened, in which case every host is reported as lost
+bool netDiagSweep(NetDiag_Socket *sock, NetDiag_PingResult *results, size_t count,
+                  uint8_t probes = NETDIAG_PINGS_PER_TARGET,
+                  uint32_t intervalMs = NETDIAG_PING_INTERVAL_MS,
+                  uint32_t timeoutMs = NETDIAG_PING_TIMEOUT_MS);
+
+#endif
@@ -1,789 +1,1414 @@
-#include "stdint.h"
-#include "Arduino.h"
-#include <ArduinoJson.h>
-#include <Preferences.h>
-
-#include "PeplinkAPI.h"
-#include "config.h"
-
-#include "utils.h"
-
-String PeplinkRouter::login(const char *username, const char *password)
-{
-  String uri = "/api/login";
-  String response = String();
-
-  JsonDocument sendDoc;
-  JsonDocument recvDoc;
-
-  // Add a filter that will grab the cookie from the router HTTP response header on successful login
-  const char *headerKeys[] = {"Set-Cookie"};
-  Serial.println("Logging into Router with admin account");
-  // Construct a JSON document containing credentials to be sent to the server
-  sendDoc["username"] = username;
-  sendDoc["password"] = password;
-  char json_string[256];
-  serializeJson(sendDoc, json_string);
-#ifdef PEPLINK_DEBUG_LOG
-  Serial.println("JSON Body:");
-  Serial.println(json_string);
-#endif
-  int httpResponseCode;
-  HTTPClient https;
-#ifdef PEPLINK_USE_HTTPS
-  https.begin(_ip, _port, uri, rootCACertificate);
-#else
-  https.begin(_ip, _port, uri);
-#endif
-  // Set the HTTP client to grab the cookie header from the router response
-  https.collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
-
-  // The content being sent to the router is JSON data
-  https.addHeader("Content-Type", "application/json");
-
-  // Perform a post request and retrieve the HTTP response code
-  httpResponseCode = https.POST(json_string);
-
-  Serial.print("HTTP RESPONSE: ");
-  Serial.println(httpResponseCode);
-  if (httpResponseCode > 0)
-  {
-    // On success, retrieve the HTTP response body
-    response = https.getString();
-#ifdef PEPLINK_DEBUG_LOG
-    Serial.println("PAYLOAD:");
-    Serial.println(response);
-#endif
-  }
-  else
-  {
-    // Print the error code string on fail
-    Serial.println("Error " + String(httpResponseCode) + String(" : ") + https.errorToString(httpResponseCode));
-    https.end();
-    return String();
-  }
-
-  https.end();
-  
-  // Attempt to parse the router response as a JSON document
-  DeserializationError error = deserializeJson(recvDoc, response);
-  if (error)
-  {
-    Serial.print(F("deserializeJson() failed: "));
-    Serial.println(error.f_str());
-    return String();
-  }
-
-  String opStatus = recvDoc["stat"];
-  if (opStatus != "ok")
-  {
-    String message = recvDoc["message"].as<String>();
-    Serial.print("Login error ");
-    int err = recvDoc["code"].as<int>();
-    Serial.print(err);
-    Serial.print(": ");
-    Serial.println(message);
-
-    // On a login attempt, if a 301 : Unauthorised response means wrong login credentials are used
-    if(err == 301 && message == "Unauthorized")  
-      Serial.println("Login failed: Invalid credentials");
-
-    return String();
-  }
-
-  // Verify the access rights provided by a successful login 
-  if (recvDoc["response"]["permission"])
-  {
-    int getAllowed = recvDoc["response"]["permission"]["GET"].as<int>();
-    int postAllowed = recvDoc["response"]["permission"]["POST"].as<int>();
-    Serial.print("Login permissions: GET - ");
-    Serial.print((getAllowed ? "allowed" : "denied"));
-    Serial.print(" POST - ");
-    Serial.println((postAllowed ? "allowed" : "denied"));
-
-    if (getAllowed != 1 || postAllowed != 1)
-      return String();
-  }
-
-  Serial.println("Login success");
-
-#ifdef PEPLINK_DEBUG_LOG
-
-  int i = https.headers();
-  Serial.println("Got " + String(i) + " HTTP headers :");
-
-  while (i--)
-    Serial.println(headerKeys[i] + String(" : ") + https.header(headerKeys[i]));
-
-#endif
-
-  // Check for cookie field and extract if exists
-  if (https.hasHeader("Set-cookie"))
-  {
-    String cookieField = https.header("Set-cookie");
-#ifdef PEPLINK_DEBUG_LOG
-    Serial.println("Cooie header = 'Set-cookie:" + cookieField + "'");
-#endif
-    int cookieStart = cookieField.indexOf("auth=");
-    if (cookieStart == -1)
-      return String();
-
-    int cookieEnd = cookieField.indexOf(';', cookieStart);
-    if (cookieEnd == -1)
-      return String();
-
-    // Cookie will either have a key of "pauth" for "http" or bauth for https
-    // so extract one more character before "auth"
-    String cookie = cookieField.substring(--cookieStart, cookieEnd);
-    Serial.println("Got cookie : " + cookie);
-    _cookie = cookie;
-
-
-    // Store the cookie in our non-volatile cookie jar
-    Preferences prefs;
-    prefs.begin(COOKIES_NAMESPACE, false);
-    
-    size_t cookieJarSize = prefs.getBytesLength(COOKIES_NAMESPACE);
-
-    // If the stored data is of the right size, extract, modify then put it back
-    if (cookieJarSize == sizeof(PeplinkAPI_CookieJar_t))
-    {
-      uint8_t cookieBuffer[sizeof(PeplinkAPI_CookieJar_t)];
-      prefs.getBytes(COOKIES_NAMESPACE, cookieBuffer, sizeof(cookieBuffer));
-      PeplinkAPI_CookieJar_t *jar = (PeplinkAPI_CookieJar_t *)cookieBuffer;
-      strncpy(jar->cookie, cookie.c_str(), sizeof(jar->cookie));
-      prefs.putBytes(COOKIES_NAMESPACE, jar, sizeof(PeplinkAPI_CookieJar_t));
-      prefs.end();
-    }
-    else  // Otherwise, initialize the cookie and store the new cookie into it
-    {
-      prefs.clear();
-      PeplinkAPI_CookieJar_t jar = { .magic = 0xDEADBEEF };
-      strncpy(jar.cookie, cookie.c_str(), sizeof(jar.cookie));
-
-      prefs.putBytes(COOKIES_NAMESPACE, &jar, sizeof(jar));
-      prefs.end();
-    }
-
-    return cookie;
-  }
-
-  return String();
-}
-
-PeplinkAPI_ClientInfo PeplinkRouter::_createClient(String name, PeplinkAPI_ClientScope_t scope)
-{
-  PeplinkAPI_ClientInfo clientInfo;
-  String uri = "/api/auth.client";
-
-  JsonDocument sendDoc;
-  JsonDocument recvDoc;
-
-  // Construct the JSON data required to create a new client
-  sendDoc["action"] = "add";
-  sendDoc["name"] = name;
-  sendDoc["scope"] = (scope == CLIENT_SCOPE_READ_ONLY) ? "api.read-only" : "api";
-  char json_string[256];
-  serializeJson(sendDoc, json_string);
-
-#ifdef PEPLINK_DEBUG_LOG
-  Serial.println("JSON Body:");
-  Serial.println(json_string);
-#endif
-
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string);
-  if (!response.length())
-    return clientInfo;
-
-  deserializeJson(recvDoc, response);
-
-  // Extract the new client information received from the router
-  clientInfo.name = recvDoc["response"]["name"].as<String>();
-  clientInfo.id = recvDoc["response"]["clientId"].as<String>();
-  clientInfo.secret = recvDoc["response"]["clientSecret"].as<String>();
-  String clientScope = recvDoc["response"]["scope"].as<String>();
-
-  if (clientScope == "api.read-only")
-    clientInfo.scope = CLIENT_SCOPE_READ_ONLY;
-  else
-    clientInfo.scope = CLIENT_SCOPE_READ_WRITE;
-
-  if (clientInfo.id.length())
-  {
-    // If a client was successfullt created, add it to the local list of clients
-    _grantClientToken(clientInfo);
-    _clients.push_back(clientInfo);
-  }
-
-  return clientInfo;
-}
-
-bool PeplinkRouter::_deleteClient(PeplinkAPI_ClientInfo &clientToDelete)
-{
-  String uri = "/api/auth.client";
-
-  JsonDocument sendDoc;
-  JsonDocument recvDoc;
-
-  Serial.println("Deleting client with id: " + clientToDelete.id);
-  sendDoc["action"] = "remove";
-  sendDoc["clientId"] = clientToDelete.id.c_str();
-  char json_string[256];
-  serializeJson(sendDoc, json_string);
-
-#ifdef PEPLINK_DEBUG_LOG
-  Serial.println("JSON Body:");
-  Serial.println(json_string);
-#endif
-
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string);
-  if (!response.length())
-    return false;
-
-  // If the request to delete a client from the router was successful, remove it from the local list of clients
-  for (auto it = _clients.begin(); it != _clients.end(); ++it)
-  {
-    if (it->id == clientToDelete.id)
-    {
-      _clients.erase(it);
-      break;
-    }
-  }
-
-  return true;
-}
-
-void PeplinkRouter::_deleteExistingClients()
-{
-  Serial.println("Deleting all " + String(_clients.size()) + " clients");
-  while(_clients.size())
-  {
-    _deleteClient(_clients[0]);
-    delay(1000);
-    getClientList();
-    delay(1000);
-  }
-}
-
-String PeplinkRouter::begin(String username, String password, String clientName, PeplinkAPI_ClientScope_t clientScope, bool deleteExistingClients)
-{
-    // Check that the router is accessible (ping)
-    if (!checkAvailable())
-    {
-      Serial.println("Router ping failed!! IP : " + _ip + String(" Port: ") + String(_port));
-      _available = false;
-      return String();
-    }
-
-    String cookie = String();
-
-    // If no cookie has been retrieved from storage, log in to receive one from the server
-    if (!_cookie.length())
-    {
-      cookie = login(username.c_str(), password.c_str());
-      if (!cookie.length())
-      {
-        _available = false;
-        return String();
-      }
-    }
-
-    // If no access token has been retrieved from storage, get the list of existing clients and attempt to grant a new token
-    // On failure, delete all clients and create one afresh. This prevents stale (outdated/unuseable) clients from accumulating.
-    if(!_token.length() && getClientList())
-    {
-      if (deleteExistingClients)
-      {
-        printRouterClients(*this);
-
-        _deleteExistingClients();
-        PeplinkAPI_ClientInfo client = _createClient(clientName, clientScope);
-        if (!client.id.length())
-            return String();
-      }
-      else
-      {
-        if (_clients.size())
-          if (!_grantClientToken(_clients[0]))
-            _deleteExistingClients();
-      }    
-    }
-    _available = true;
-    return _cookie;
-}
-
-bool PeplinkRouter::checkAvailable()
-{
-    IPAddress ip;
-    ip.fromString(_ip);
-    _available = Ping.ping(ip);
-    return _available;
-}
-
-bool PeplinkRouter::getClientList()
-{
-  String uri = "/api/auth.client?accessToken=" + _token;
-
-  JsonDocument recvDoc;
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL);
-  if (!response.length())
-    return (_available = false);
-
-  Serial.println("getClientList() success");
-
-  deserializeJson(recvDoc, response);
-
-  _clients.clear();
-
-  int clientCount = recvDoc["response"].as<JsonArray>().size();
-  Serial.printf("Got %d router clients\n", clientCount);
-
-  for (JsonObject routerClient : recvDoc["response"].as<JsonArray>())
-  {
-    PeplinkAPI_ClientInfo clientInfo;
-    clientInfo.name = routerClient["name"].as<String>();
-    clientInfo.id = routerClient["clientId"].as<String>();
-    clientInfo.secret = routerClient["clientSecret"].as<String>();
-    clientInfo.scope = (routerClient["scope"].as<String>() == "api") ? CLIENT_SCOPE_READ_WRITE : CLIENT_SCOPE_READ_ONLY;
-    _clients.push_back(clientInfo);
-  }
-  return (_available = true);
-}
-
-bool PeplinkRouter::_refreshToken()
-{
-    _token = String();
-    if(getClientList())
-    {
-      printRouterClients(*this);
-      _deleteExistingClients();
-      PeplinkAPI_ClientInfo client = _createClient(CLIENT_NAME_DEFAULT, CLIENT_SCOPE_DEFAULT);
-      if (!client.id.length())
-        return false;
-    }
-    else
-      return false;
-    return (_available = true);
-}
-
-bool PeplinkRouter::_grantClientToken(PeplinkAPI_ClientInfo &client)
-{
-  String uri = "/api/auth.token.grant";
-
-  JsonDocument sendDoc;
-  JsonDocument recvDoc;
-
-  sendDoc["clientId"] = client.id;
-  sendDoc["clientSecret"] = client.secret;
-  char json_string[256];
-  serializeJson(sendDoc, json_string);
-
-#ifdef PEPLINK_DEBUG_LOG
-  Serial.println("JSON Body:");
-  Serial.println(json_string);
-#endif
-
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string);
-  if (!response.length())
-    return (_available = false);
-
-  Serial.println("_grantClientToken() success");
-
-  deserializeJson(recvDoc, response);
-
-  client.token = recvDoc["response"]["accessToken"].as<String>();
-  client.tokenExpiry = recvDoc["response"]["expiresIn"].as<int>();
-
-  Serial.println("Got access token " + client.token + "for client " + client.id + " expiring in " + client.tokenExpiry + " seconds");
-  _token = client.token;
-
-  // Store the token in our non-volatile cookie jar
-  Preferences prefs;
-  prefs.begin(COOKIES_NAMESPACE, false);
-  
-  size_t jarSize = prefs.getBytesLength(COOKIES_NAMESPACE);
-
-   // If the stored data is of the right size, read, modify write
-  if (jarSize == sizeof(PeplinkAPI_CookieJar_t))
-  {
-    uint8_t jarBuffer[sizeof(PeplinkAPI_CookieJar_t)];
-    prefs.getBytes(COOKIES_NAMESPACE, jarBuffer, sizeof(jarBuffer));
-    PeplinkAPI_CookieJar_t *jar = (PeplinkAPI_CookieJar_t *)jarBuffer;
-    strncpy(jar->token, _token.c_str(), sizeof(jar->token));
-    prefs.putBytes(COOKIES_NAMESPACE, jar, sizeof(PeplinkAPI_CookieJar_t));
-    prefs.end();
-  }
-  else
-  {
-    prefs.clear();
-    PeplinkAPI_CookieJar_t jar = { .magic = 0xDEADBEEF };
-    strncpy(jar.token, _token.c_str(), sizeof(jar.token));
-    
-    prefs.putBytes(COOKIES_NAMESPACE, &jar, sizeof(jar));
-    prefs.end();
-  }
-  return (_available = true);
-}
-
-bool PeplinkRouter::getWanTraffic(uint8_t id)
-{
-  
-  String uri = "/api/status.traffic?accessToken=" + _token;
-
-  JsonDocument recvDoc;
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL);
-  if (!response.length())
-    return (_available = false);
-
-  Serial.println("getWanTraffic() success");
-
-  deserializeJson(recvDoc, response);
-
-  PeplinkAPI_WAN_Traffic speed;
-  for (int key : recvDoc["response"]["bandwidth"]["order"].as<JsonArray>())
-  {
-    speed.name = recvDoc["response"]["bandwidth"][String(key).c_str()]["name"].as<String>();
-    speed.download = recvDoc["response"]["bandwidth"][String(key).c_str()]["overall"]["download"].as<int>();
-    speed.upload = recvDoc["response"]["bandwidth"][String(key).c_str()]["overall"]["upload"].as<int>();
-    speed.unit = recvDoc["response"]["bandwidth"]["unit"].as<String>();
-    speed.id = key;
-    _wanTraffic.push_back(speed);
-  }
-
-  if(id == 0)
-  {
-    for(size_t i = 0; i < _wanTraffic.size(), i < _wan.size(); ++i)
-    {
-      _wan[i]->download = _wanTraffic[i].download;
-      _wan[i]->upload = _wanTraffic[i].upload;
-      _wan[i]->unit = _wanTraffic[i].unit;
-    }
-  }
-  else
-  {  
-    for(size_t i = 0; i < _wanTraffic.size(); ++i)
-    {
-      if(id == _wanTraffic[i].id)
-      {
-        _wan[0]->download = _wanTraffic[i].download;
-        _wan[0]->upload = _wanTraffic[i].upload;
-        _wan[0]->unit = _wanTraffic[i].unit;
-        break;
-      }
-    }
-  }
-
-  return (_available = true);
-} 
-
-bool PeplinkRouter::getWanStatus(uint8_t id)
-{
-  if(id = 0)
-  {
-    for(PeplinkAPI_WAN* wan: _wan)
-      delete wan;
-    _wan.clear();
-  }
-  else
-  {
-    for(auto it = _wan.begin(); it < _wan.end(); ++it)
-    {
-      if((*it)->id == id)
-      {
-        delete (*it);
-        _wan.erase(it);
-      }
-    }
-  }
-
-  String uri = "/api/status.wan.connection?accessToken=" + _token;
-  if(id != 0 && id <= 3)
-    uri += "&id=" + String(id);
-
-  JsonDocument recvDoc;
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL);
-  if (!response.length())
-    return (_available = false);
-
-  Serial.println("getWanStatus() success");
-
-  deserializeJson(recvDoc, response);
-
-  // Extract the ordered list of available WANs
-  for (int key : recvDoc["response"]["order"].as<JsonArray>())
-  {
-    String wanInfo = recvDoc["response"][String(key).c_str()].as<String>();
-    String wanType = recvDoc["response"][String(key).c_str()]["type"];
-
-    if (wanType == "ethernet")
-    {
-      PeplinkAPI_WAN_Ethernet wan = _parseEthernetWAN(wanInfo);
-      wan.id = key;
-      if (wan.name.length())
-        _wan.push_back((PeplinkAPI_WAN *)new PeplinkAPI_WAN_Ethernet(wan));
-    }
-    else if (wanType == "cellular")
-    {
-      PeplinkAPI_WAN_Cellular wan = _parseCellularWAN(wanInfo);
-      wan.id = key;
-      if (wan.name.length())
-        _wan.push_back((PeplinkAPI_WAN *)new PeplinkAPI_WAN_Cellular(wan));
-    }
-    else if (wanType == "wifi")
-    {
-      PeplinkAPI_WAN_WiFi wan = _parseWiFiWAN(wanInfo);
-      wan.id = key;
-      if (wan.name.length())
-        _wan.push_back((PeplinkAPI_WAN *)new PeplinkAPI_WAN_WiFi(wan));
-    }
-    else
-      Serial.println("Unsupported WAN type: " + wanType);
-  }
-
-  // Rearrange the WAN list based on priority
-  if(this->_wan.size() > 1)
-  {
-    size_t wanCount = this->_wan.size();
-    size_t currentWanPriority = 1;
-
-    for(size_t i = 0; i < wanCount; ++i)
-    {
-      for(size_t j = 0; j < wanCount; ++j)
-      {
-        if(this->_wan[i]->priority == currentWanPriority)
-        {
-          this->_wan.push_back(this->_wan[i]);
-          break;
-        }
-      }
-      currentWanPriority++;
-    }
-
-    // Append the rest of the WANs with no priority assigned
-    for(size_t i = 0; i < wanCount; ++i)
-      if(this->_wan[i]->priority == 0)
-        this->_wan.push_back(this->_wan[i]);
-
-    // Erase the old list
-    for(size_t i = 0; i < wanCount; i++)
-      this->_wan.erase(this->_wan.begin());
-
-  }
-  getWanTraffic(id);
-  return (_available = true);
-}
-
-String PeplinkRouter::_sendJsonRequest(PeplinkAPI_HTTPRequest_t type, String &endpoint, char *body)
-{
-  JsonDocument recvDoc;
-  String response = String();
-  int httpResponseCode;
-  HTTPClient https;
-  
-#ifdef PEPLINK_USE_HTTPS
-  https.begin(_ip, _port, endpoint, rootCACertificate);
-#else
-  https.begin(_ip, _port, endpoint);
-#endif
-
-  https.addHeader("Cookie", _cookie.c_str());
-
-  switch (type)
-  {
-  case PEPLINKAPI_HTTP_REQUEST_POST:
-  {
-    https.addHeader("Content-Type", "application/json");
-    httpResponseCode = https.POST(body);
-  }
-    break;
-  case PEPLINKAPI_HTTP_REQUEST_GET:
-    httpResponseCode = https.GET();
-    break;
-  }
-
-  Serial.print("HTTP RESPONSE: ");
-  Serial.println(httpResponseCode);
-  if (httpResponseCode > 0)
-  {
-    response = https.getString();
-#ifdef PEPLINK_DEBUG_LOG
-    Serial.println("PAYLOAD:");
-    Serial.println(response);
-#endif
-  }
-  else
-  {
-    Serial.println("Error " + String(httpResponseCode) + String(" : ") + https.errorToString(httpResponseCode));
-    https.end();
-    return String();
-  }
-  https.end();
-
-  DeserializationError error = deserializeJson(recvDoc, response);
-  if (error)
-  {
-    Serial.print(F("deserializeJson() failed: "));
-    Serial.println(error.f_str());
-    return String();
-  }
-
-  String opStatus = recvDoc["stat"];
-  if (opStatus != "ok")
-  {
-    String message = recvDoc["message"].as<String>();
-    Serial.print("Operation error ");
-    int err = recvDoc["code"].as<int>();
-    Serial.print(err);
-    Serial.print(": ");
-    Serial.println(message);
-
-    if(err == 401 && message == "Unauthorized") // If cookie expired, log in again
-      login(fob.routers.username.c_str(), fob.routers.password.c_str());
-    else if(err == 401 && message == "Invalid access token") //If access token expired, refresh it
-      _refreshToken();
-
-    return String();
-  }
-
-  return response;
-}
-
-PeplinkAPI_WAN_Ethernet PeplinkRouter::_parseEthernetWAN(String& wanInfo)
-{
-  JsonDocument wanDoc;
-  deserializeJson(wanDoc, wanInfo);
-  PeplinkAPI_WAN_Ethernet wan;
-
-  wan.name = wanDoc["name"].as<String>();
-  wan.type = PEPLINKAPI_WAN_TYPE_ETHERNET;
-  wan.status = wanDoc["message"].as<String>();
-  wan.statusLED = wanDoc["statusLed"].as<String>();
-  wan.priority = wanDoc["priority"].as<int>();
-  wan.managementOnly = wanDoc["managementOnly"].as<bool>();
-
-  if (wan.status == "Disabled")
-    return wan;
-
-  wan.ip = wanDoc["ip"].as<String>();
-  return wan;
-}
-
-PeplinkAPI_WAN_Cellular PeplinkRouter::_parseCellularWAN(String& wanInfo)
-{
-  JsonDocument wanDoc;
-  deserializeJson(wanDoc, wanInfo);
-
-  PeplinkAPI_WAN_Cellular wan;
-
-  wan.name = wanDoc["name"].as<String>();
-  wan.type = PEPLINKAPI_WAN_TYPE_CELLULAR;
-  wan.status = wanDoc["message"].as<String>();
-  wan.statusLED = wanDoc["statusLed"].as<String>();
-  wan.priority = wanDoc["priority"].as<int>();
-  wan.signalLevel = wanDoc["cellular"]["signalLevel"].as<int>();
-  wan.networkType = wanDoc["cellular"]["network"].as<String>();
-
-  if (wan.status == "Disabled")
-    return wan;
-
-  wan.ip = wanDoc["ip"].as<String>();
-  wan.carrier = wanDoc["cellular"]["carrier"]["name"].as<String>();
-
-  for (int key : wanDoc["cellular"]["sim"]["order"].as<JsonArray>())
-  {
-    String simKey = String(key);
-    JsonObject sim = wanDoc["cellular"]["sim"][simKey.c_str()];
-
-    PeplinkAPI_WAN_Cellular_SIM simCard;
-    simCard.detected = sim["simCardDetected"].as<bool>();
-    if (simCard.detected)
-    {
-      simCard.active = sim["active"].as<bool>();
-      simCard.iccid = sim["iccid"].as<String>();
-    }
-    wan.simCards.push_back(simCard);
-  }
-  return wan;
-}
-
-PeplinkAPI_WAN_WiFi PeplinkRouter::_parseWiFiWAN(String& wanInfo)
-{
-  JsonDocument wanDoc;
-  deserializeJson(wanDoc, wanInfo);
-
-  PeplinkAPI_WAN_WiFi wan;
-
-  wan.name = wanDoc["name"].as<String>();
-  wan.type = PEPLINKAPI_WAN_TYPE_WIFI;
-  wan.status = wanDoc["message"].as<String>();
-  wan.statusLED = wanDoc["statusLed"].as<String>();
-  wan.priority = wanDoc["priority"].as<int>();
-
-  if (wan.status == "Disabled")
-    return wan;
-
-  wan.ip = wanDoc["ip"].as<String>();
-  wan.strength = wanDoc["signal"]["strength"].as<int>();
-  wan.ssid = wanDoc["ssid"].as<String>();
-  wan.bssid = wanDoc["bssid"].as<String>();
-  return wan;
-}
-
-bool PeplinkRouter::getInfo()
-{
-  String uri = "/api/status.system.info?accessToken=" + _token;
-
-  JsonDocument recvDoc;
-
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL);
-  if (!response.length())
-    return (_available = false);
-
-  Serial.println("getInfo() success");
-
-  deserializeJson(recvDoc, response);
-
-  // Extract the system info
-  _info.name = recvDoc["response"]["device"]["name"].as<String>();
-  _info.uptime = recvDoc["response"]["uptime"]["second"].as<long>();
-  _info.serial = recvDoc["response"]["device"]["serialNumber"].as<String>();
-  _info.fwVersion = recvDoc["response"]["device"]["firmwareVersion"].as<String>();
-  _info.productCode = recvDoc["response"]["device"]["productCode"].as<String>();
-  _info.hardwareRev = recvDoc["response"]["device"]["hardwareRevision"].as<String>();
-
-  return (_available = true);
-}
-
-bool PeplinkRouter::getLocation()
-{
-  String uri = "/api/info.location?accessToken=" + _token;
-
-  JsonDocument recvDoc;
-
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL);
-  if (!response.length())
-    return (_available = false);
-
-  Serial.println("getLocation() success");
-
-  deserializeJson(recvDoc, response);
-
-  // Extract the location
-  _location.latitude = recvDoc["response"]["location"]["latitude"].as<String>();
-  _location.longitude = recvDoc["response"]["location"]["longitude"].as<String>();
-  _location.altitude = recvDoc["response"]["location"]["altitude"].as<String>();
-  return (_available = true);
-}
-
-bool PeplinkRouter::remoterReboot()
-{
-  String uri = "/api/cmd.system.reboot?accessToken=" + _token;
-
-  JsonDocument recvDoc;
-
-  String response = _sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL);
-  if (!response.length())
-    return (_available = false);
-  _available = false;
-  return true;
-}
+#include "stdint.h"
+#include "Arduino.h"
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <limits.h>
+
+#include "PeplinkAPI.h"
+#include "DnsCache.h"
+#include "config.h"
+
+#include "utils.h"
+
+/// @brief Holds a router's recursive lock until the end of the scope, so every return releases it
+class PeplinkAPI_LockGuard
+{
+public:
+  PeplinkAPI_LockGuard(PeplinkRouter *router) : _router(router) { _router->lock(); }
+  ~PeplinkAPI_LockGuard() { _router->unlock(); }
+
+private:
+  PeplinkRouter *_router;
+};
+
+PeplinkAPI_ConnectionPool::PeplinkAPI_ConnectionPool()
+{
+  _free = xSemaphoreCreateCounting(PEPLINK_HTTP_POOL_SIZE, PEPLINK_HTTP_POOL_SIZE);
+  _lock = xSemaphoreCreateMutex();
+  memset(&_stats, 0, sizeof(_stats));
+
+  for (PeplinkAPI_Connection &conn : _connections)
+  {
+#ifdef PEPLINK_USE_HTTPS
+    conn.client.setCACert(rootCACertificate);
+#endif
+    // Keep the socket open after each response so the next request skips the handshake
+    conn.http.setReuse(true);
+    conn.lastUsed = 0;
+    conn.inUse = false;
+    conn.closeOnRelease = false;
+  }
+}
+
+PeplinkAPI_Connection *PeplinkAPI_ConnectionPool::acquire(uint32_t timeoutMs)
+{
+  if (xSemaphoreTake(_free, pdMS_TO_TICKS(timeoutMs)) != pdTRUE)
+    return NULL;
+
+  PeplinkAPI_Connection *conn = NULL;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+
+  // Prefer a connection that is still open so the handshake can be skipped
+  for (PeplinkAPI_Connection &candidate : _connections)
+  {
+    if (!candidate.inUse && (!conn || (!conn->client.connected() && candidate.client.connected())))
+      conn = &candidate;
+  }
+  conn->inUse = true;
+  xSemaphoreGive(_lock);
+
+  // The router drops connections it considers idle, often without notice, so don't trust an old one
+  if (conn->client.connected() && (millis() - conn->lastUsed) > PEPLINK_HTTP_IDLE_TIMEOUT_MS)
+  {
+#ifdef PEPLINK_DEBUG_LOG
+    Serial.println("Closing idle router connection");
+#endif
+    conn->client.stop();
+  }
+
+  return conn;
+}
+
+void PeplinkAPI_ConnectionPool::release(PeplinkAPI_Connection *conn, bool ok)
+{
+  if (!conn)
+    return;
+
+  uint32_t elapsed = millis() - conn->requestStart;
+
+  // end() leaves the socket open when the router agreed to keep it alive
+  conn->http.end();
+  if (!ok || conn->closeOnRelease)
+    conn->client.stop();
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  if (ok)
+  {
+    _stats.requests++;
+    _stats.lastMs = elapsed;
+    _stats.totalMs += elapsed;
+    if (elapsed > _stats.maxMs)
+      _stats.maxMs = elapsed;
+  }
+  else
+    _stats.failures++;
+  conn->lastUsed = millis();
+  conn->closeOnRelease = false;
+  conn->inUse = false;
+  xSemaphoreGive(_lock);
+
+  xSemaphoreGive(_free);
+
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.printf("Router request took %lums\n", elapsed);
+#endif
+}
+
+void PeplinkAPI_ConnectionPool::closeAll()
+{
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (PeplinkAPI_Connection &conn : _connections)
+  {
+    if (conn.inUse)
+      conn.closeOnRelease = true;
+    else
+      conn.client.stop();
+  }
+  xSemaphoreGive(_lock);
+}
+
+void PeplinkAPI_ConnectionPool::countConnect(bool reconnect)
+{
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _stats.connects++;
+  if (reconnect)
+    _stats.reconnects++;
+  xSemaphoreGive(_lock);
+}
+
+PeplinkAPI_RequestStats_t PeplinkAPI_ConnectionPool::stats()
+{
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  PeplinkAPI_RequestStats_t stats = _stats;
+  xSemaphoreGive(_lock);
+  return stats;
+}
+
+/// @brief Reads exactly one HTTP response body off a connection, decoding chunked transfer encoding if used.
+/// This lets ArduinoJson parse straight from the socket while leaving the connection positioned at the next response
+class PeplinkAPI_ResponseStream : public Stream
+{
+public:
+  /// @param contentLength Body length from the Content-Length header, or -1 if the body runs until the connection closes
+  PeplinkAPI_ResponseStream(Stream &client, bool chunked, int contentLength)
+      : _client(client), _chunked(chunked), _remaining(chunked ? 0 : contentLength), _firstChunk(true), _done(!chunked && contentLength == 0)
+  {
+    // The underlying client already blocks for its own timeout, so don't wait again on top of it
+    setTimeout(0);
+  }
+
+  int available() override { return _done ? 0 : _client.available(); }
+
+  int read() override
+  {
+    if (!_nextByteAvailable())
+      return -1;
+
+    uint8_t c;
+    if (_client.readBytes(&c, 1) != 1)
+    {
+      _done = true;
+      return -1;
+    }
+
+    if (_remaining > 0 && --_remaining == 0 && !_chunked)
+      _done = true;
+    return c;
+  }
+
+  int peek() override { return _nextByteAvailable() ? _client.peek() : -1; }
+
+  size_t write(uint8_t) override { return 0; }
+
+  /// @brief Discard the rest of the body, including any chunk trailer, so the connection can carry another request
+  void drain()
+  {
+    while (read() >= 0)
+      ;
+  }
+
+private:
+  /// @brief Move on to the next chunk if the current one is exhausted
+  bool _nextByteAvailable()
+  {
+    if (_done)
+      return false;
+    if (_chunked && _remaining == 0 && !_readChunkHeader())
+    {
+      _done = true;
+      return false;
+    }
+    return true;
+  }
+
+  /// @brief Read a chunk size line. A zero-sized chunk marks the end of the body
+  bool _readChunkHeader()
+  {
+    // Every chunk after the first is preceded by the CRLF that terminated the previous chunk's data
+    if (!_firstChunk)
+      _client.readStringUntil('\n');
+    _firstChunk = false;
+
+    String sizeLine = _client.readStringUntil('\n');
+    if (!sizeLine.length())
+      return false;
+
+    _remaining = strtol(sizeLine.c_str(), NULL, 16);
+    if (_remaining > 0)
+      return true;
+
+    // Skip any trailer headers up to the blank line ending the message
+    while (_client.readStringUntil('\n').length() > 1)
+      ;
+    return false;
+  }
+
+  Stream &_client;
+  bool _chunked;
+  int32_t _remaining;   // Bytes left in the current chunk, or in the whole body when not chunked. Negative if unknown
+  bool _firstChunk;
+  bool _done;
+};
+
+/// @brief Response headers collected on every request. Transfer-Encoding tells the body reader whether to expect chunks
+static const char *defaultHeaderKeys[] = {"Transfer-Encoding"};
+
+/// @brief Check whether a request failed because the router closed a kept-alive connection under us, and whether it is safe
+/// to send it again. A GET can always be repeated. A POST is only repeated when it never left the fob, as the router may
+/// already have acted on one whose connection dropped while waiting for the reply
+static bool isRetryableReset(PeplinkAPI_HTTPRequest_t type, int httpResponseCode)
+{
+  if (httpResponseCode == HTTPC_ERROR_SEND_HEADER_FAILED || httpResponseCode == HTTPC_ERROR_NOT_CONNECTED)
+    return true;
+
+  return type == PEPLINKAPI_HTTP_REQUEST_GET &&
+         (httpResponseCode == HTTPC_ERROR_CONNECTION_LOST || httpResponseCode == HTTPC_ERROR_SEND_PAYLOAD_FAILED);
+}
+
+bool PeplinkRouter::_connect(PeplinkAPI_Connection *conn)
+{
+  IPAddress ip;
+  bool connected;
+  if (ip.fromString(_ip) || (_dns && _dns->resolve(_ip.c_str(), ip)))
+  {
+#ifdef PEPLINK_USE_HTTPS
+    // TLS still needs the name, to send as SNI and to check the certificate against
+    connected = conn->client.connect(ip, _port, _ip.c_str(), rootCACertificate, NULL, NULL);
+#else
+    connected = conn->client.connect(ip, _port);
+#endif
+  }
+  else
+    connected = !_dns && conn->client.connect(_ip.c_str(), _port);
+
+  // Responses are read with Stream's own timeout, which a fresh socket leaves at its 1s default
+  if (connected)
+    conn->client.Stream::setTimeout(HTTPCLIENT_DEFAULT_TCP_TIMEOUT);
+  return connected;
+}
+
+int PeplinkRouter::_beginRequest(PeplinkAPI_Connection *&conn, PeplinkAPI_HTTPRequest_t type, String &endpoint, const char *body,
+                                 const char **headerKeys, size_t headerCount)
+{
+  int httpResponseCode = HTTPC_ERROR_CONNECTION_REFUSED;
+
+  conn = _pool.acquire();
+  if (!conn)
+  {
+    Serial.println("No free router connection!");
+    return httpResponseCode;
+  }
+  conn->requestStart = millis();
+
+  // Try on the kept-alive connection first. If the router has reset it, retry once on a fresh connection when that is safe
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+    // HTTPClient would look a router known by name up itself, so a fresh socket is opened here and handed to it
+    bool reused = conn->client.connected();
+    if (!reused)
+    {
+      _pool.countConnect(attempt > 0);
+      if (!_connect(conn))
+      {
+        httpResponseCode = HTTPC_ERROR_CONNECTION_REFUSED;
+        break;
+      }
+    }
+
+#ifdef PEPLINK_USE_HTTPS
+    conn->http.begin(conn->client, _ip, _port, endpoint, true);
+#else
+    conn->http.begin(conn->client, _ip, _port, endpoint);
+#endif
+
+    if (headerKeys)
+      conn->http.collectHeaders(headerKeys, headerCount);
+    else
+      conn->http.collectHeaders(defaultHeaderKeys, sizeof(defaultHeaderKeys) / sizeof(defaultHeaderKeys[0]));
+
+    if (_cookie.length())
+      conn->http.addHeader("Cookie", _cookie);
+
+    switch (type)
+    {
+    case PEPLINKAPI_HTTP_REQUEST_POST:
+      conn->http.addHeader("Content-Type", "application/json");
+      httpResponseCode = conn->http.POST((uint8_t *)body, body ? strlen(body) : 0);
+      break;
+    case PEPLINKAPI_HTTP_REQUEST_GET:
+      httpResponseCode = conn->http.GET();
+      break;
+    }
+
+    if (!reused || !isRetryableReset(type, httpResponseCode))
+      break;
+
+    Serial.println("Router reset kept-alive connection, reconnecting");
+    conn->http.end();
+    conn->client.stop();
+  }
+
+  return httpResponseCode;
+}
+
+void PeplinkRouter::unlock()
+{
+  // Logging writes to flash, so a login failure recorded under the lock is only logged once the outermost hold ends
+  bool authFailed = false;
+  int authFailCode = _authFailCode;
+  if (!--_lockDepth)
+  {
+    authFailed = _authFailed;
+    _authFailed = false;
+  }
+  xSemaphoreGiveRecursive(_lock);
+
+  if (authFailed)
+    logEvent(EVENT_LOG_ROUTER_AUTH_FAIL, authFailCode);
+}
+
+void PeplinkRouter::_endRequest(PeplinkAPI_Connection *conn, bool ok)
+{
+  _pool.release(conn, ok);
+}
+
+String PeplinkRouter::login(const char *username, const char *password)
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/login";
+  String response = String();
+
+  JsonDocument sendDoc;
+  JsonDocument recvDoc;
+
+  // Add a filter that will grab the cookie from the router HTTP response header on successful login
+  const char *headerKeys[] = {"Set-Cookie"};
+  Serial.println("Logging into Router with admin account");
+  // Construct a JSON document containing credentials to be sent to the server
+  sendDoc["username"] = username;
+  sendDoc["password"] = password;
+  char json_string[256];
+  serializeJson(sendDoc, json_string);
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.println("JSON Body:");
+  Serial.println(json_string);
+#endif
+  // Perform a post request, collecting the cookie header, and retrieve the HTTP response code
+  PeplinkAPI_Connection *conn;
+  int httpResponseCode = _beginRequest(conn, PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string, headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+
+  Serial.print("HTTP RESPONSE: ");
+  Serial.println(httpResponseCode);
+  if (httpResponseCode > 0)
+  {
+    // On success, retrieve the HTTP response body
+    response = conn->http.getString();
+#ifdef PEPLINK_DEBUG_LOG
+    Serial.println("PAYLOAD:");
+    Serial.println(response);
+#endif
+  }
+  else
+  {
+    // Print the error code string on fail
+    Serial.println("Error " + String(httpResponseCode) + String(" : ") + HTTPClient::errorToString(httpResponseCode));
+    _endRequest(conn, false);
+    return String();
+  }
+
+#ifdef PEPLINK_DEBUG_LOG
+
+  int i = conn->http.headers();
+  Serial.println("Got " + String(i) + " HTTP headers :");
+
+  while (i--)
+    Serial.println(headerKeys[i] + String(" : ") + conn->http.header(headerKeys[i]));
+
+#endif
+
+  // Grab the cookie header before the connection is handed back to the pool
+  String cookieField = conn->http.hasHeader("Set-cookie") ? conn->http.header("Set-cookie") : String();
+  _endRequest(conn, true);
+  
+  // Attempt to parse the router response as a JSON document
+  DeserializationError error = deserializeJson(recvDoc, response);
+  if (error)
+  {
+    Serial.print(F("deserializeJson() failed: "));
+    Serial.println(error.f_str());
+    return String();
+  }
+
+  String opStatus = recvDoc["stat"];
+  if (opStatus != "ok")
+  {
+    String message = recvDoc["message"].as<String>();
+    Serial.print("Login error ");
+    int err = recvDoc["code"].as<int>();
+    Serial.print(err);
+    Serial.print(": ");
+    Serial.println(message);
+    _authFailed = true;
+    _authFailCode = err;
+
+    // On a login attempt, if a 301 : Unauthorised response means wrong login credentials are used
+    if(err == 301 && message == "Unauthorized")  
+      Serial.println("Login failed: Invalid credentials");
+
+    return String();
+  }
+
+  // Verify the access rights provided by a successful login 
+  if (recvDoc["response"]["permission"])
+  {
+    int getAllowed = recvDoc["response"]["permission"]["GET"].as<int>();
+    int postAllowed = recvDoc["response"]["permission"]["POST"].as<int>();
+    Serial.print("Login permissions: GET - ");
+    Serial.print((getAllowed ? "allowed" : "denied"));
+    Serial.print(" POST - ");
+    Serial.println((postAllowed ? "allowed" : "denied"));
+
+    if (getAllowed != 1 || postAllowed != 1)
+      return String();
+  }
+
+  Serial.println("Login success");
+
+  // Check for cookie field and extract if exists
+  if (cookieField.length())
+  {
+#ifdef PEPLINK_DEBUG_LOG
+    Serial.println("Cooie header = 'Set-cookie:" + cookieField + "'");
+#endif
+    int cookieStart = cookieField.indexOf("auth=");
+    if (cookieStart == -1)
+      return String();
+
+    int cookieEnd = cookieField.indexOf(';', cookieStart);
+    if (cookieEnd == -1)
+      return String();
+
+    // Cookie will either have a key of "pauth" for "http" or bauth for https
+    // so extract one more character before "auth"
+    String cookie = cookieField.substring(--cookieStart, cookieEnd);
+    Serial.println("Got cookie : " + cookie);
+    _cookie = cookie;
+
+
+    // Keep the cookie in the cookie jar, which is written to NVS once the credentials settle
+    storeRouterCookie(cookie);
+
+    return cookie;
+  }
+
+  return String();
+}
+
+PeplinkAPI_ClientInfo PeplinkRouter::_createClient(String name, PeplinkAPI_ClientScope_t scope)
+{
+  PeplinkAPI_ClientInfo clientInfo;
+  String uri = "/api/auth.client";
+
+  JsonDocument sendDoc;
+  JsonDocument recvDoc;
+
+  // Construct the JSON data required to create a new client
+  sendDoc["action"] = "add";
+  sendDoc["name"] = name;
+  sendDoc["scope"] = (scope == CLIENT_SCOPE_READ_ONLY) ? "api.read-only" : "api";
+  char json_string[256];
+  serializeJson(sendDoc, json_string);
+
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.println("JSON Body:");
+  Serial.println(json_string);
+#endif
+
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string, recvDoc))
+    return clientInfo;
+
+  // Extract the new client information received from the router
+  clientInfo.name = recvDoc["response"]["name"].as<String>();
+  clientInfo.id = recvDoc["response"]["clientId"].as<String>();
+  clientInfo.secret = recvDoc["response"]["clientSecret"].as<String>();
+  String clientScope = recvDoc["response"]["scope"].as<String>();
+
+  if (clientScope == "api.read-only")
+    clientInfo.scope = CLIENT_SCOPE_READ_ONLY;
+  else
+    clientInfo.scope = CLIENT_SCOPE_READ_WRITE;
+
+  if (clientInfo.id.length())
+  {
+    // If a client was successfullt created, add it to the local list of clients and use it from now on.
+    // Any client used before it is now stale
+    _grantClientToken(clientInfo);
+    _clients.push_back(clientInfo);
+    _client = clientInfo;
+    _pruneClients = true;
+    storeRouterClient(clientInfo.id, clientInfo.secret);
+  }
+
+  return clientInfo;
+}
+
+bool PeplinkRouter::_deleteClient(PeplinkAPI_ClientInfo &clientToDelete)
+{
+  String uri = "/api/auth.client";
+
+  JsonDocument sendDoc;
+  JsonDocument recvDoc;
+
+  Serial.println("Deleting client with id: " + clientToDelete.id);
+  sendDoc["action"] = "remove";
+  sendDoc["clientId"] = clientToDelete.id.c_str();
+  char json_string[256];
+  serializeJson(sendDoc, json_string);
+
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.println("JSON Body:");
+  Serial.println(json_string);
+#endif
+
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string, recvDoc))
+    return false;
+
+  // If the request to delete a client from the router was successful, remove it from the local list of clients
+  for (auto it = _clients.begin(); it != _clients.end(); ++it)
+  {
+    if (it->id == clientToDelete.id)
+    {
+      _clients.erase(it);
+      break;
+    }
+  }
+
+  return true;
+}
+
+bool PeplinkRouter::pruneClients()
+{
+  PeplinkAPI_LockGuard hold(this);
+  // Without knowing which client is in use, every client under our name could be it
+  if (!_client.id.length())
+    return (_pruneClients = false);
+  if (!getClientList())
+    return false;
+  _pruneClients = false;
+
+  // Go through a copy, since each deletion also drops the client from the local list
+  std::vector<PeplinkAPI_ClientInfo> clients = _clients;
+  size_t deleted = 0;
+  for (PeplinkAPI_ClientInfo &client : clients)
+  {
+    // Clients under other names belong to other applications
+    if (client.id == _client.id || client.name != _clientName)
+      continue;
+    if (_deleteClient(client))
+      deleted++;
+  }
+  Serial.printf("Deleted %u stale clients\n", deleted);
+  return true;
+}
+
+String PeplinkRouter::begin(String username, String password, String clientName, PeplinkAPI_ClientScope_t clientScope, bool deleteExistingClients)
+{
+    PeplinkAPI_LockGuard hold(this);
+    // Check that the router is accessible (ping)
+    if (!checkAvailable())
+    {
+      Serial.println("Router ping failed!! IP : " + _ip + String(" Port: ") + String(_port));
+      _available = false;
+      return String();
+    }
+
+    String cookie = String();
+
+    // If no cookie has been retrieved from storage, log in to receive one from the server
+    if (!_cookie.length())
+    {
+      cookie = login(username.c_str(), password.c_str());
+      if (!cookie.length())
+      {
+        _available = false;
+        return String();
+      }
+    }
+
+    // If no access token has been retrieved from storage, grant one to the client we created in an earlier session,
+    // which takes a single request. Only if the router no longer knows that client is a new one created.
+    // Stale clients are deleted later by pruneClients(), so they don't hold up the first requests
+    _clientName = clientName;
+    _clientScope = clientScope;
+    if (!_token.length() && !(_client.id.length() && _grantClientToken(_client)))
+    {
+      PeplinkAPI_ClientInfo client = _createClient(clientName, clientScope);
+      if (!client.id.length())
+        return String();
+    }
+    if (deleteExistingClients)
+      _pruneClients = true;
+    _available = true;
+    return _cookie;
+}
+
+bool PeplinkRouter::checkAvailable()
+{
+    IPAddress ip;
+    if (!ip.fromString(_ip))
+    {
+      // A router known by name that doesn't resolve is as unreachable as one that doesn't answer
+      if (!_dns || !_dns->resolve(_ip.c_str(), ip))
+        return (_available = false);
+    }
+    _available = Ping.ping(ip);
+    return _available;
+}
+
+bool PeplinkRouter::getClientList()
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/auth.client?accessToken=" + _token;
+
+  // Only keep the client fields we store
+  JsonDocument filter;
+  filter["response"][0]["name"] = true;
+  filter["response"][0]["clientId"] = true;
+  filter["response"][0]["clientSecret"] = true;
+  filter["response"][0]["scope"] = true;
+
+  JsonDocument recvDoc;
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL, recvDoc, &filter))
+    return (_available = false);
+
+  Serial.println("getClientList() success");
+
+  _clients.clear();
+
+  int clientCount = recvDoc["response"].as<JsonArray>().size();
+  Serial.printf("Got %d router clients\n", clientCount);
+
+  for (JsonObject routerClient : recvDoc["response"].as<JsonArray>())
+  {
+    PeplinkAPI_ClientInfo clientInfo;
+    clientInfo.name = routerClient["name"].as<String>();
+    clientInfo.id = routerClient["clientId"].as<String>();
+    clientInfo.secret = routerClient["clientSecret"].as<String>();
+    clientInfo.scope = (routerClient["scope"].as<String>() == "api") ? CLIENT_SCOPE_READ_WRITE : CLIENT_SCOPE_READ_ONLY;
+    _clients.push_back(clientInfo);
+  }
+  return (_available = true);
+}
+
+bool PeplinkRouter::_refreshToken()
+{
+    _token = String();
+    PeplinkAPI_ClientInfo client = _createClient(_clientName, _clientScope);
+    if (!client.id.length())
+      return false;
+    return (_available = true);
+}
+
+void PeplinkRouter::setTokenExpiry(uint32_t secondsLeft)
+{
+  // Tokens are renewed within 20 days whatever their lifetime, so millis() arithmetic never wraps
+  secondsLeft = min(secondsLeft, (uint32_t)(20 * 24 * 3600));
+  _tokenExpiryMs = millis() + secondsLeft * 1000;
+  _tokenExpiryKnown = true;
+}
+
+bool PeplinkRouter::tokenExpiresWithin(uint32_t seconds) const
+{
+  if (!_token.length() || !_tokenExpiryKnown)
+    return false;
+  return (int32_t)(_tokenExpiryMs - millis()) <= (int32_t)(seconds * 1000);
+}
+
+bool PeplinkRouter::renewToken()
+{
+  PeplinkAPI_LockGuard hold(this);
+  // A request sent while renewing can fail on the old token too, which mustn't start another renewal
+  if (_renewingToken)
+    return false;
+  Serial.println("Renewing access token");
+  _renewingToken = true;
+
+  // Granting our client a new token takes one request, where _refreshToken() creates a client to be pruned later
+  bool renewed = (_client.id.length() && _grantClientToken(_client)) || _refreshToken();
+  _renewingToken = false;
+  return renewed;
+}
+
+bool PeplinkRouter::renewTokenIfExpiring()
+{
+  if (!tokenExpiresWithin(PEPLINK_TOKEN_RENEW_MARGIN_S))
+    return true;
+  return renewToken();
+}
+
+bool PeplinkRouter::_grantClientToken(PeplinkAPI_ClientInfo &client)
+{
+  String uri = "/api/auth.token.grant";
+
+  JsonDocument sendDoc;
+  JsonDocument recvDoc;
+
+  sendDoc["clientId"] = client.id;
+  sendDoc["clientSecret"] = client.secret;
+  char json_string[256];
+  serializeJson(sendDoc, json_string);
+
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.println("JSON Body:");
+  Serial.println(json_string);
+#endif
+
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_POST, uri, json_string, recvDoc))
+    return (_available = false);
+
+  Serial.println("_grantClientToken() success");
+
+  client.token = recvDoc["response"]["accessToken"].as<String>();
+  client.tokenExpiry = recvDoc["response"]["expiresIn"].as<int>();
+
+  Serial.println("Got access token " + client.token + "for client " + client.id + " expiring in " + client.tokenExpiry + " seconds");
+  _token = client.token;
+  if (client.tokenExpiry > 0)
+    setTokenExpiry(client.tokenExpiry);
+  else
+    _tokenExpiryKnown = false;
+
+  // Keep the token in the cookie jar, which is written to NVS once the credentials settle
+  storeRouterToken(_token, max(client.tokenExpiry, 0));
+  return (_available = true);
+}
+
+/// @brief Build the filter for the traffic response. Only the overall bandwidth of each WAN is kept
+/// @param id Only keep the bandwidth of the WAN with this ID. 0 keeps every WAN
+static void buildWanTrafficFilter(JsonDocument &filter, uint8_t id = 0)
+{
+  JsonObject bandwidthFilter = filter["response"]["bandwidth"].to<JsonObject>();
+  bandwidthFilter["order"] = true;
+  bandwidthFilter["unit"] = true;
+  JsonObject wanFilter = id ? bandwidthFilter[String(id)].to<JsonObject>() : bandwidthFilter["*"].to<JsonObject>();
+  wanFilter["name"] = true;
+  wanFilter["overall"]["download"] = true;
+  wanFilter["overall"]["upload"] = true;
+}
+
+/// @brief Build the filter for the system info response. Only the device fields we display are kept
+static void buildInfoFilter(JsonDocument &filter)
+{
+  JsonObject deviceFilter = filter["response"]["device"].to<JsonObject>();
+  deviceFilter["name"] = true;
+  deviceFilter["serialNumber"] = true;
+  deviceFilter["firmwareVersion"] = true;
+  deviceFilter["productCode"] = true;
+  deviceFilter["hardwareRevision"] = true;
+  filter["response"]["uptime"]["second"] = true;
+}
+
+/// @brief Build the filter for the location response
+static void buildLocationFilter(JsonDocument &filter)
+{
+  JsonObject locationFilter = filter["response"]["location"].to<JsonObject>();
+  locationFilter["latitude"] = true;
+  locationFilter["longitude"] = true;
+  locationFilter["altitude"] = true;
+}
+
+/// @brief Build the filter for the WAN status response, which is by far the largest the router sends.
+/// Only the fields read by the WAN parsers are kept
+static void buildWanStatusFilter(JsonDocument &filter)
+{
+  filter["response"]["order"] = true;
+  JsonObject wanFilter = filter["response"]["*"].to<JsonObject>();
+  wanFilter["name"] = true;
+  wanFilter["type"] = true;
+  wanFilter["message"] = true;
+  wanFilter["statusLed"] = true;
+  wanFilter["priority"] = true;
+  wanFilter["managementOnly"] = true;
+  wanFilter["ip"] = true;
+  wanFilter["ssid"] = true;
+  wanFilter["bssid"] = true;
+  wanFilter["signal"]["strength"] = true;
+
+  JsonObject cellularFilter = wanFilter["cellular"].to<JsonObject>();
+  cellularFilter["signalLevel"] = true;
+  cellularFilter["network"] = true;
+  cellularFilter["carrier"]["name"] = true;
+  cellularFilter["sim"]["order"] = true;
+  cellularFilter["sim"]["*"]["simCardDetected"] = true;
+  cellularFilter["sim"]["*"]["active"] = true;
+  cellularFilter["sim"]["*"]["iccid"] = true;
+}
+
+bool PeplinkRouter::getWanTraffic(uint8_t id)
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/status.traffic?accessToken=" + _token;
+
+  JsonDocument filter;
+  buildWanTrafficFilter(filter, id);
+
+  JsonDocument recvDoc;
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL, recvDoc, &filter))
+    return (_available = false);
+
+  Serial.println("getWanTraffic() success");
+
+  _parseWanTraffic(recvDoc, id);
+  return (_available = true);
+}
+
+void PeplinkRouter::_parseWanTraffic(JsonDocument &recvDoc, uint8_t id)
+{
+  JsonObject bandwidth = recvDoc["response"]["bandwidth"];
+  const char *unit = bandwidth["unit"] | "";
+
+  // Match on the WAN ID rather than list position since the WAN list is sorted by priority
+  char key[12];
+  for (int wanId : bandwidth["order"].as<JsonArray>())
+  {
+    if (id != 0 && wanId != id)
+      continue;
+
+    PeplinkAPI_WAN *wan = _wan.find(wanId);
+    if (!wan)
+      continue;
+
+    snprintf(key, sizeof(key), "%d", wanId);
+    long download = bandwidth[key]["overall"]["download"].as<long>();
+    long upload = bandwidth[key]["overall"]["upload"].as<long>();
+    if (download != wan->download || upload != wan->upload || strcmp(unit, wan->unit))
+      wan->changes |= PEPLINKAPI_WAN_CHANGED_TRAFFIC;
+    else
+      wan->changes &= ~PEPLINKAPI_WAN_CHANGED_TRAFFIC;
+    wan->download = download;
+    wan->upload = upload;
+    strlcpy(wan->unit, unit, sizeof(wan->unit));
+  }
+}
+
+/// @brief Compare the status fields of two copies of a WAN
+/// @return PeplinkAPI_WANChange_t bits of the fields that differ, leaving out traffic
+static uint8_t diffWanStatus(const PeplinkAPI_WAN &a, const PeplinkAPI_WAN &b)
+{
+  uint8_t changes = 0;
+  if (a.type != b.type || strcmp(a.name, b.name) || strcmp(a.status, b.status) || a.priority != b.priority || a.managementOnly != b.managementOnly)
+    changes |= PEPLINKAPI_WAN_CHANGED_STATUS;
+  if (strcmp(a.statusLED, b.statusLED))
+    changes |= PEPLINKAPI_WAN_CHANGED_LED;
+  if (strcmp(a.ip, b.ip))
+    changes |= PEPLINKAPI_WAN_CHANGED_IP;
+
+  // The type-specific fields of the other type overlap, so they only compare while the type stays the same
+  if (a.type != b.type)
+    return changes | PEPLINKAPI_WAN_CHANGED_SIGNAL | PEPLINKAPI_WAN_CHANGED_SIM;
+
+  if (a.type == PEPLINKAPI_WAN_TYPE_CELLULAR)
+  {
+    if (strcmp(a.cellular.carrier, b.cellular.carrier) || a.cellular.signalLevel != b.cellular.signalLevel ||
+        strcmp(a.cellular.networkType, b.cellular.networkType))
+      changes |= PEPLINKAPI_WAN_CHANGED_SIGNAL;
+    if (a.cellular.simCount != b.cellular.simCount)
+      changes |= PEPLINKAPI_WAN_CHANGED_SIM;
+    for (size_t i = 0; i < a.cellular.simCount && !(changes & PEPLINKAPI_WAN_CHANGED_SIM); ++i)
+      if (a.cellular.simCards[i].detected != b.cellular.simCards[i].detected || a.cellular.simCards[i].active != b.cellular.simCards[i].active ||
+          strcmp(a.cellular.simCards[i].iccid, b.cellular.simCards[i].iccid))
+        changes |= PEPLINKAPI_WAN_CHANGED_SIM;
+  }
+  else if (a.type == PEPLINKAPI_WAN_TYPE_WIFI)
+  {
+    if (a.wifi.strength != b.wifi.strength || strcmp(a.wifi.ssid, b.wifi.ssid) || strcmp(a.wifi.bssid, b.wifi.bssid))
+      changes |= PEPLINKAPI_WAN_CHANGED_SIGNAL;
+  }
+  return changes;
+}
+
+bool PeplinkRouter::getWanStatus(uint8_t id, bool withTraffic)
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/status.wan.connection?accessToken=" + _token;
+  if (id)
+    uri += "&id=" + String(id);
+
+  JsonDocument filter;
+  buildWanStatusFilter(filter);
+
+  JsonDocument recvDoc;
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL, recvDoc, &filter))
+    return (_available = false);
+
+  Serial.println("getWanStatus() success");
+
+  _parseWanList(recvDoc, id);
+
+  if (withTraffic)
+    getWanTraffic(id);
+  return (_available = true);
+}
+
+void PeplinkRouter::_parseWanList(JsonDocument &recvDoc, uint8_t id)
+{
+  // Bit i is set once entry i of the table has been found in the response
+  uint32_t seen = 0;
+  char key[12];
+
+  // Extract the ordered list of available WANs
+  for (int wanId : recvDoc["response"]["order"].as<JsonArray>())
+  {
+    snprintf(key, sizeof(key), "%d", wanId);
+    JsonObject wanInfo = recvDoc["response"][key];
+    const char *wanType = wanInfo["type"] | "";
+
+    // Parse into a scratch copy, so a WAN that turns out unnamed or unsupported leaves the table as it was
+    PeplinkAPI_WAN parsed;
+    memset(&parsed, 0, sizeof(PeplinkAPI_WAN));
+    parsed.id = wanId;
+
+    if (!strcmp(wanType, "ethernet"))
+      _parseEthernetWAN(wanInfo, parsed);
+    else if (!strcmp(wanType, "cellular"))
+      _parseCellularWAN(wanInfo, parsed);
+    else if (!strcmp(wanType, "wifi"))
+      _parseWiFiWAN(wanInfo, parsed);
+    else
+      Serial.printf("Unsupported WAN type: %s\n", wanType);
+
+    PeplinkAPI_WAN *wan = _wan.find(wanId);
+
+    // Unnamed and unsupported WANs are left out of the list. A full listing drops one already listed below,
+    // as it isn't marked seen, but a single WAN response is all there is to go on
+    if (!parsed.name[0])
+    {
+      if (wan && id != 0)
+      {
+        for (PeplinkAPI_WAN *next = wan + 1; next < _wan.end(); ++next)
+          *(next - 1) = *next;
+        _wan.count--;
+      }
+      continue;
+    }
+
+    // Update the WAN in place if already listed, otherwise fill the next free entry
+    if (wan)
+    {
+      // Bandwidth comes from a separate endpoint, so it carries over from the previous copy
+      parsed.upload = wan->upload;
+      parsed.download = wan->download;
+      memcpy(parsed.unit, wan->unit, sizeof(parsed.unit));
+      parsed.changes = (wan->changes & PEPLINKAPI_WAN_CHANGED_TRAFFIC) | diffWanStatus(*wan, parsed);
+    }
+    else
+    {
+      if (_wan.count >= PEPLINK_MAX_WANS)
+      {
+        Serial.printf("WAN list full, ignoring WAN %d\n", wanId);
+        continue;
+      }
+      wan = &_wan.wans[_wan.count++];
+      parsed.changes = PEPLINKAPI_WAN_CHANGED_ALL;
+    }
+
+    *wan = parsed;
+    seen |= (1UL << (wan - _wan.wans));
+  }
+
+  // A full listing drops any WAN the router no longer reports
+  if (id == 0)
+  {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < _wan.count; ++i)
+    {
+      if (!(seen & (1UL << i)))
+        continue;
+      if (kept != i)
+        _wan.wans[kept] = _wan.wans[i];
+      kept++;
+    }
+    _wan.count = kept;
+  }
+
+  // Rearrange the WAN list based on priority, keeping the router's order among equal priorities.
+  // WANs with no priority assigned go last
+  std::stable_sort(_wan.begin(), _wan.end(), [](const PeplinkAPI_WAN &a, const PeplinkAPI_WAN &b)
+                   { return (a.priority ? a.priority : INT_MAX) < (b.priority ? b.priority : INT_MAX); });
+}
+
+bool PeplinkRouter::refresh(uint8_t parts, uint8_t wanId)
+{
+  PeplinkAPI_LockGuard hold(this);
+
+  // Endpoint and response filter of each part, in PeplinkAPI_StatePart_t bit order.
+  // The traffic filter depends on the WAN asked for, so it is built separately
+  const size_t partCount = 4;
+  const char *endpoints[partCount] = {"/api/status.wan.connection", "/api/status.traffic", "/api/status.system.info", "/api/info.location"};
+  void (*buildFilter[partCount])(JsonDocument &) = {buildWanStatusFilter, NULL, buildInfoFilter, buildLocationFilter};
+
+  // The requested parts are fetched together so they describe the router at the same moment
+  String uris[partCount];
+  JsonDocument filters[partCount];
+  JsonDocument recvDocs[partCount];
+  size_t count = 0;
+  for (size_t i = 0; i < partCount; ++i)
+  {
+    if (!(parts & (1 << i)))
+      continue;
+    uris[count] = String(endpoints[i]) + "?accessToken=" + _token;
+
+    // The status of one WAN is asked for by ID. The traffic endpoint has no such parameter,
+    // so all but that WAN are filtered out of its response instead
+    if (wanId && (1 << i) == PEPLINKAPI_STATE_WAN_STATUS)
+      uris[count] += "&id=" + String(wanId);
+    if ((1 << i) == PEPLINKAPI_STATE_WAN_TRAFFIC)
+      buildWanTrafficFilter(filters[count], wanId);
+    else
+      buildFilter[i](filters[count]);
+    count++;
+  }
+
+  if (!count)
+    return true;
+
+  if (!_sendJsonRequests(uris, recvDocs, filters, count))
+    return (_available = false);
+
+  Serial.println("refresh() success");
+
+  // Status goes first so that traffic lands on any WAN that has just appeared
+  size_t doc = 0;
+  if (parts & PEPLINKAPI_STATE_WAN_STATUS)
+    _parseWanList(recvDocs[doc++], wanId);
+  if (parts & PEPLINKAPI_STATE_WAN_TRAFFIC)
+    _parseWanTraffic(recvDocs[doc++], wanId);
+
+  if (parts & PEPLINKAPI_STATE_INFO)
+    _parseInfo(recvDocs[doc++]);
+  if (parts & PEPLINKAPI_STATE_LOCATION)
+    _parseLocation(recvDocs[doc++]);
+
+  _lastRefresh = millis();
+  return (_available = true);
+}
+
+/// @brief Read a response status line and headers straight off a connection
+/// @param contentLength Set to the Content-Length header value, or -1 if absent
+/// @param chunked Set if the body uses chunked transfer encoding
+/// @param keepAlive Set if the router will keep the connection open after this response
+/// @return HTTP response code, or a negative HTTPC_ERROR_* value on fail
+static int readResponseHeader(Stream &client, int &contentLength, bool &chunked, bool &keepAlive)
+{
+  String statusLine = client.readStringUntil('\n');
+  if (!statusLine.startsWith("HTTP/1."))
+    return HTTPC_ERROR_READ_TIMEOUT;
+
+  // "HTTP/1.1 200 OK"
+  int code = statusLine.substring(9, 12).toInt();
+  keepAlive = statusLine.startsWith("HTTP/1.1");
+  contentLength = -1;
+  chunked = false;
+
+  for (;;)
+  {
+    String line = client.readStringUntil('\n');
+    line.trim();
+    if (!line.length())
+      break;
+
+    int colon = line.indexOf(':');
+    if (colon < 0)
+      continue;
+
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+
+    if (name.equalsIgnoreCase("Content-Length"))
+      contentLength = value.toInt();
+    else if (name.equalsIgnoreCase("Transfer-Encoding"))
+      chunked = value.indexOf("chunked") >= 0;
+    else if (name.equalsIgnoreCase("Connection"))
+      keepAlive = value.equalsIgnoreCase("keep-alive");
+  }
+
+  return code > 0 ? code : HTTPC_ERROR_READ_TIMEOUT;
+}
+
+size_t PeplinkRouter::_sendPipelinedRequests(String *endpoints, JsonDocument *recvDocs, JsonDocument *filters, size_t count)
+{
+  PeplinkAPI_Connection *conn = _pool.acquire();
+  if (!conn)
+  {
+    Serial.println("No connection available to the router");
+    return 0;
+  }
+  conn->requestStart = millis();
+
+  if (!conn->client.connected())
+  {
+    _pool.countConnect(false);
+    if (!_connect(conn))
+    {
+      _pool.release(conn, false);
+      return 0;
+    }
+  }
+
+  // Write every request before reading any response so they all share a single round trip
+  String requests;
+  String host = _ip + ":" + String(_port);
+  for (size_t i = 0; i < count; ++i)
+  {
+    requests += "GET " + endpoints[i] + " HTTP/1.1\r\n";
+    requests += "Host: " + host + "\r\n";
+    requests += "Connection: keep-alive\r\n";
+    if (_cookie.length())
+      requests += "Cookie: " + _cookie + "\r\n";
+    requests += "\r\n";
+  }
+
+  if (conn->client.write((const uint8_t *)requests.c_str(), requests.length()) != requests.length())
+  {
+    _pool.release(conn, false);
+    return 0;
+  }
+
+  // The router answers pipelined requests in order. Stop at the first response that can't be read, the
+  // connection position is unknown after that
+  size_t parsed = 0;
+  bool keepAlive = true;
+  while (parsed < count && keepAlive)
+  {
+    int contentLength;
+    bool chunked;
+    int httpResponseCode = readResponseHeader(conn->client, contentLength, chunked, keepAlive);
+    if (httpResponseCode <= 0)
+      break;
+
+    PeplinkAPI_ResponseStream bodyStream(conn->client, chunked, contentLength);
+    if (!_parseJsonResponse(bodyStream, recvDocs[parsed], &filters[parsed]))
+      break;
+    parsed++;
+  }
+
+  conn->closeOnRelease = !keepAlive;
+  _pool.release(conn, parsed == count);
+  return parsed;
+}
+
+bool PeplinkRouter::_sendJsonRequests(String *endpoints, JsonDocument *recvDocs, JsonDocument *filters, size_t count)
+{
+  size_t parsed = 0;
+
+#ifdef PEPLINK_HTTP_PIPELINING
+  parsed = _sendPipelinedRequests(endpoints, recvDocs, filters, count);
+
+  // The connection has been handed back, so an expired cookie or token can now be renewed without starving the pool
+  for (size_t i = 0; i < parsed; ++i)
+    if (!_checkOperationStatus(recvDocs[i]))
+      return false;
+
+  if (parsed < count)
+    Serial.println("Pipelined request " + String(parsed) + " failed, sending the rest one by one");
+#endif
+
+  // Anything the pipeline didn't deliver is sent one request at a time on the same kept-alive connection
+  for (size_t i = parsed; i < count; ++i)
+  {
+    recvDocs[i].clear();
+    if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, endpoints[i], NULL, recvDocs[i], &filters[i]))
+      return false;
+  }
+
+  return true;
+}
+
+bool PeplinkRouter::_sendJsonRequest(PeplinkAPI_HTTPRequest_t type, String &endpoint, const char *body, JsonDocument &recvDoc, JsonDocument *filter)
+{
+  PeplinkAPI_Connection *conn;
+
+  int httpResponseCode = _beginRequest(conn, type, endpoint, body);
+
+  Serial.print("HTTP RESPONSE: ");
+  Serial.println(httpResponseCode);
+  if (httpResponseCode <= 0)
+  {
+    Serial.println("Error " + String(httpResponseCode) + String(" : ") + HTTPClient::errorToString(httpResponseCode));
+    _endRequest(conn, false);
+    return false;
+  }
+
+  // Parse the body as it arrives off the connection instead of buffering it in a String first
+  PeplinkAPI_ResponseStream bodyStream(conn->http.getStream(), conn->http.header("Transfer-Encoding").indexOf("chunked") >= 0, conn->http.getSize());
+  bool parsed = _parseJsonResponse(bodyStream, recvDoc, filter);
+  _endRequest(conn, parsed);
+
+  return parsed && _checkOperationStatus(recvDoc);
+}
+
+bool PeplinkRouter::_parseJsonResponse(PeplinkAPI_ResponseStream &bodyStream, JsonDocument &recvDoc, JsonDocument *filter)
+{
+  // The operation status is needed to detect authentication errors, so it always passes the filter
+  if (filter)
+  {
+    (*filter)["stat"] = true;
+    (*filter)["code"] = true;
+    (*filter)["message"] = true;
+  }
+
+#ifdef PEPLINK_DEBUG_LOG
+  uint32_t parseStart = micros();
+  uint32_t heapBefore = ESP.getFreeHeap();
+#endif
+
+  DeserializationError error = filter ? deserializeJson(recvDoc, bodyStream, DeserializationOption::Filter(*filter))
+                                      : deserializeJson(recvDoc, bodyStream);
+
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.printf("Parsed response in %luus, document holds %ld bytes of heap\n", micros() - parseStart, (long)heapBefore - (long)ESP.getFreeHeap());
+  Serial.println("PAYLOAD:");
+  serializeJson(recvDoc, Serial);
+  Serial.println();
+#endif
+
+  if (error)
+  {
+    Serial.print(F("deserializeJson() failed: "));
+    Serial.println(error.f_str());
+    return false;
+  }
+
+  // Consume the rest of the body so the connection can carry the next response
+  bodyStream.drain();
+  return true;
+}
+
+bool PeplinkRouter::_checkOperationStatus(JsonDocument &recvDoc)
+{
+  String opStatus = recvDoc["stat"];
+  if (opStatus != "ok")
+  {
+    String message = recvDoc["message"].as<String>();
+    Serial.print("Operation error ");
+    int err = recvDoc["code"].as<int>();
+    Serial.print(err);
+    Serial.print(": ");
+    Serial.println(message);
+
+    if(err == 401 && message == "Unauthorized") // If cookie expired, log in again
+      login(fob.routers.username.c_str(), fob.routers.password.c_str());
+    else if(err == 401 && message == "Invalid access token") //If access token expired, renew it
+      renewToken();
+
+    return false;
+  }
+
+  return true;
+}
+
+void PeplinkRouter::_parseEthernetWAN(JsonObject wanDoc, PeplinkAPI_WAN &wan)
+{
+  strlcpy(wan.name, wanDoc["name"] | "", sizeof(wan.name));
+  wan.type = PEPLINKAPI_WAN_TYPE_ETHERNET;
+  strlcpy(wan.status, wanDoc["message"] | "", sizeof(wan.status));
+  strlcpy(wan.statusLED, wanDoc["statusLed"] | "", sizeof(wan.statusLED));
+  wan.priority = wanDoc["priority"].as<int>();
+  wan.managementOnly = wanDoc["managementOnly"].as<bool>();
+
+  if (!strcmp(wan.status, "Disabled"))
+    return;
+
+  strlcpy(wan.ip, wanDoc["ip"] | "", sizeof(wan.ip));
+}
+
+void PeplinkRouter::_parseCellularWAN(JsonObject wanDoc, PeplinkAPI_WAN &wan)
+{
+  strlcpy(wan.name, wanDoc["name"] | "", sizeof(wan.name));
+  wan.type = PEPLINKAPI_WAN_TYPE_CELLULAR;
+  strlcpy(wan.status, wanDoc["message"] | "", sizeof(wan.status));
+  strlcpy(wan.statusLED, wanDoc["statusLed"] | "", sizeof(wan.statusLED));
+  wan.priority = wanDoc["priority"].as<int>();
+  wan.cellular.signalLevel = wanDoc["cellular"]["signalLevel"].as<int>();
+  strlcpy(wan.cellular.networkType, wanDoc["cellular"]["network"] | "", sizeof(wan.cellular.networkType));
+
+  if (!strcmp(wan.status, "Disabled"))
+    return;
+
+  strlcpy(wan.ip, wanDoc["ip"] | "", sizeof(wan.ip));
+  strlcpy(wan.cellular.carrier, wanDoc["cellular"]["carrier"]["name"] | "", sizeof(wan.cellular.carrier));
+
+  char simKey[12];
+  for (int key : wanDoc["cellular"]["sim"]["order"].as<JsonArray>())
+  {
+    if (wan.cellular.simCount >= PEPLINK_MAX_SIMS)
+      break;
+
+    snprintf(simKey, sizeof(simKey), "%d", key);
+    JsonObject sim = wanDoc["cellular"]["sim"][simKey];
+
+    PeplinkAPI_WAN_Cellular_SIM &simCard = wan.cellular.simCards[wan.cellular.simCount++];
+    simCard.detected = sim["simCardDetected"].as<bool>();
+    if (simCard.detected)
+    {
+      simCard.active = sim["active"].as<bool>();
+      strlcpy(simCard.iccid, sim["iccid"] | "", sizeof(simCard.iccid));
+    }
+  }
+}
+
+void PeplinkRouter::_parseWiFiWAN(JsonObject wanDoc, PeplinkAPI_WAN &wan)
+{
+  strlcpy(wan.name, wanDoc["name"] | "", sizeof(wan.name));
+  wan.type = PEPLINKAPI_WAN_TYPE_WIFI;
+  strlcpy(wan.status, wanDoc["message"] | "", sizeof(wan.status));
+  strlcpy(wan.statusLED, wanDoc["statusLed"] | "", sizeof(wan.statusLED));
+  wan.priority = wanDoc["priority"].as<int>();
+
+  if (!strcmp(wan.status, "Disabled"))
+    return;
+
+  strlcpy(wan.ip, wanDoc["ip"] | "", sizeof(wan.ip));
+  wan.wifi.strength = wanDoc["signal"]["strength"].as<int>();
+  strlcpy(wan.wifi.ssid, wanDoc["ssid"] | "", sizeof(wan.wifi.ssid));
+  strlcpy(wan.wifi.bssid, wanDoc["bssid"] | "", sizeof(wan.wifi.bssid));
+}
+
+bool PeplinkRouter::getInfo()
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/status.system.info?accessToken=" + _token;
+
+  JsonDocument filter;
+  buildInfoFilter(filter);
+
+  JsonDocument recvDoc;
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL, recvDoc, &filter))
+    return (_available = false);
+
+  Serial.println("getInfo() success");
+
+  _parseInfo(recvDoc);
+  return (_available = true);
+}
+
+void PeplinkRouter::_parseInfo(JsonDocument &recvDoc)
+{
+  // Extract the system info
+  _info.name = recvDoc["response"]["device"]["name"].as<String>();
+  _info.uptime = recvDoc["response"]["uptime"]["second"].as<long>();
+  _info.serial = recvDoc["response"]["device"]["serialNumber"].as<String>();
+  _info.fwVersion = recvDoc["response"]["device"]["firmwareVersion"].as<String>();
+  _info.productCode = recvDoc["response"]["device"]["productCode"].as<String>();
+  _info.hardwareRev = recvDoc["response"]["device"]["hardwareRevision"].as<String>();
+}
+
+bool PeplinkRouter::getLocation()
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/info.location?accessToken=" + _token;
+
+  JsonDocument filter;
+  buildLocationFilter(filter);
+
+  JsonDocument recvDoc;
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL, recvDoc, &filter))
+    return (_available = false);
+
+  Serial.println("getLocation() success");
+
+  _parseLocation(recvDoc);
+  return (_available = true);
+}
+
+void PeplinkRouter::_parseLocation(JsonDocument &recvDoc)
+{
+  // Extract the location
+  _location.latitude = recvDoc["response"]["location"]["latitude"].as<String>();
+  _location.longitude = recvDoc["response"]["location"]["longitude"].as<String>();
+  _location.altitude = recvDoc["response"]["location"]["altitude"].as<String>();
+}
+
+bool PeplinkRouter::remoterReboot()
+{
+  PeplinkAPI_LockGuard hold(this);
+  String uri = "/api/cmd.system.reboot?accessToken=" + _token;
+
+  JsonDocument recvDoc;
+
+  if (!_sendJsonRequest(PEPLINKAPI_HTTP_REQUEST_GET, uri, NULL, recvDoc))
+    return (_available = false);
+  _available = false;
+  return true;
+}
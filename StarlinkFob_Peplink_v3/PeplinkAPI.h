@@ -1,285 +1,505 @@
-#ifndef _PEPLINKAPI_H_
-#define _PEPLINKAPI_H_
-
-#include <vector>
-#include <stdint.h>
-
-#include <WiFi.h>
-#include <Arduino.h>
-#include <ESP32Ping.h>
-#include <HTTPClient.h>
-#include <ArduinoJson.h>
-
-#include "secrets.h"
-#include "config.h"
-
-/// @brief Stores router-assigned credentials
-typedef struct
-{
-    uint32_t magic;         // Header used to verify the validity of a cookie jar retrieved from storage
-    char cookie[128];       // Issued at login, and used to subsequentlt provide admin access without explicit login
-    char token[128];        // Issued when a client token is granted and used for generic API access
-} PeplinkAPI_CookieJar_t;
-
-/// @brief HTTP request types supported by the router
-typedef enum
-{
-    PEPLINKAPI_HTTP_REQUEST_GET, 
-    PEPLINKAPI_HTTP_REQUEST_POST,
-} PeplinkAPI_HTTPRequest_t;
-
-/// @brief Access rights used when creating a client
-typedef enum
-{
-    CLIENT_SCOPE_READ_ONLY,
-    CLIENT_SCOPE_READ_WRITE
-} PeplinkAPI_ClientScope_t;
-
-/// @brief Client information
-class PeplinkAPI_ClientInfo
-{
-public:
-    String name;
-    String id;
-    String secret;
-    String token;
-    int tokenExpiry;    // Time in seconds before the token granted to the client expires
-    PeplinkAPI_ClientScope_t scope;
-};
-
-/// @brief WAN types
-typedef enum
-{
-    PEPLINKAPI_WAN_TYPE_ETHERNET,
-    PEPLINKAPI_WAN_TYPE_CELLULAR,
-    PEPLINKAPI_WAN_TYPE_WIFI,
-} PeplinkAPI_WANType_t;
-
-/// @brief Generic WAN class
-class PeplinkAPI_WAN
-{
-public:
-    String name;
-    String ip;
-    String status;
-    String statusLED;
-    long upload;        // Upload bandwidth
-    long download;      // Download bandwidth
-    String unit;        // Unit used for upload/download bandwidth
-    int id;
-    int priority;
-    PeplinkAPI_WANType_t type;
-    bool managementOnly;
-};
-
-/// @brief SIM slot information for cellular wan
-class PeplinkAPI_WAN_Cellular_SIM
-{
-public:
-    bool detected;
-    bool active;
-    String iccid;
-};
-
-/// @brief Cellular WAN class
-class PeplinkAPI_WAN_Cellular : public PeplinkAPI_WAN
-{
-public:
-    String carrier;
-    int rssi;
-    int signalLevel;
-    String networkType;
-
-    std::vector<PeplinkAPI_WAN_Cellular_SIM> simCards;
-};
-
-/// @brief Ethernet WAN class
-class PeplinkAPI_WAN_Ethernet : public PeplinkAPI_WAN{};
-
-/// @brief Wi-Fi WAN class
-class PeplinkAPI_WAN_WiFi : public PeplinkAPI_WAN
-{
-public:
-    int strength;
-    String ssid;
-    String bssid;
-};
-
-/// @brief WAN bandwidth information
-struct PeplinkAPI_WAN_Traffic
-{
-    String name;
-    long download;
-    long upload;
-    String unit;
-    int id;
-};
-
-/// @brief Router device information
-struct PeplinkRouterInfo
-{
-    String name;
-    long uptime;
-    String serial;
-    String fwVersion;
-    String productCode;
-    String hardwareRev;
-};
-
-/// @brief Router location information
-struct PeplinkRouterLocation
-{
-    String latitude;
-    String longitude;
-    String altitude;
-};
-
-/// @brief 
-class PeplinkRouter
-{
-
-public:
-    PeplinkRouter(){};
-    PeplinkRouter(String ip, uint16_t port)
-    {
-        _ip = ip;
-        _port = port;
-    }
-
-    /// @brief Ping the router IP address
-    bool begin(){ return checkAvailable(); }
-
-    
-    /// @brief Initialize the router object by testing the validity of cookes and accesss token and refreshing them as necessary
-    /// @note The cookie and token values should be initialized from NVS (if available) prior to calling this function, avoding unnecessary login
-    /// @param username Administrator username used when loging in
-    /// @param password Administrator password used when loging in
-    /// @param clientName Name of the client to create if there are no valid clients
-    /// @param clientScope Access rights used to create a new client
-    /// @param deleteExistingClients Whether or not to delete all existing clients registered on the router then create a new client
-    /// @return Cookie, on success.
-    /// @return Empty string on fail
-    String begin(String username, String password, String clientName, PeplinkAPI_ClientScope_t clientScope, bool deleteExistingClients);
-    
-    /// @brief Check whether the IP address of the router is reachable via a ping request
-    /// @note   Default ping timeout is 10s
-    /// @return true on ping success
-    /// @return false on ping fail
-    bool checkAvailable();
-
-    bool available() const { return _available;}
-
-    bool update() { return (getClientList() && getWanStatus() && getInfo() && getLocation()); }
-    
-    /// @brief Retrieve the router's list of registered clients and update the local copy.
-    /// @note  Any existing clients in the local list is cleared before the new list is retrieved
-    bool getClientList();
-    
-    /// @brief Get the WAN connection status
-    bool getWanStatus(uint8_t id = 0);
-    
-    /// @brief Get the bandwith of all WANs
-    bool getWanTraffic(uint8_t id = 0);
-    
-    /// @brief Get device information from router
-    bool getInfo();
-
-    /// @brief Return the router device information
-    PeplinkRouterInfo info() const { return _info; };
-
-    /// @brief Get location information from router
-    bool getLocation();
-
-    /// @brief Return router location
-    PeplinkRouterLocation location() const { return _location; };
-    
-    /// @brief Set the router IP address
-    void setIP(String ip) { _ip = ip; };
-
-    /// @brief Get the router IP address
-    String ip() const { return _ip; };
-
-    /// @brief Set the router port
-    void setPort(uint16_t port) { _port = port; };
-
-    /// @brief Get the router port
-    uint16_t port() const { return _port; };
-
-    /// @brief Set the router login cookie
-    /// @note Call this function before begin() to use a cookie retrieved from NVS for admin access rather than logging in afresh
-    void setCookie(String cookie) { _cookie = cookie; }
-
-    /// @brief Get the router cookie
-    String cookie() const { return _cookie; }
-    
-    /// @brief Set the router API access token
-    /// @note Call this function before begin() to use an access token retrieved from NVS for API access
-    void setToken(String token) { _token = token; }
-    
-    /// @brief Get the router API access token
-    String token() const { return _token; }
-
-
-    /// @brief Log in to router with a the administrator \a username & \a password
-    /// @return Server-generated cookie if login is successful and access rights are confirmed
-    /// @return Empty String on fail
-    String login(const char *username, const char *password);
-
-    std::vector<PeplinkAPI_ClientInfo> clients() const { return _clients; };
-    size_t numClients() const { return _clients.size(); };
-    std::vector<PeplinkAPI_WAN *> wanStatus() const { return _wan; };
-
-    bool remoterReboot();
-
-private:
-    
-    /// @brief Send an HTTP request and handle any authentication errors before returning the response
-    /// @param type HTTP request type. Either GET or POST
-    /// @param endpoint URL of the API endpoint to send the request to
-    /// @param body If sending a POST request, this parameter becomes the body content of the request
-    /// @return Valid string on success
-    /// @return Empty string on fail
-    String _sendJsonRequest(PeplinkAPI_HTTPRequest_t type, String &endpoint, char *body);
-
-    /// @brief Extract the information for ethernet-type WAN
-    PeplinkAPI_WAN_Ethernet _parseEthernetWAN(String &wanInfo);
-
-    /// @brief Extract the information for cellular-type WAN
-    PeplinkAPI_WAN_Cellular _parseCellularWAN(String &wanInfo);
-
-    /// @brief Extract the information for WiFi-type WAN
-    PeplinkAPI_WAN_WiFi _parseWiFiWAN(String &wanInfo);
-
-    /// @brief Create a clent with a given \a name and permissions.
-    /// @note   Multiple clients can be created with the same name since the router will assing each one a unique ID 
-    /// @return On success, id and secret populated
-    /// @return On fail, empty PeplinkAPI_ClientInfo
-    PeplinkAPI_ClientInfo _createClient(String name, PeplinkAPI_ClientScope_t scope);
-    
-    /// @brief Delete a specified client from the local list as well as from the router
-    bool _deleteClient(PeplinkAPI_ClientInfo &client);
-    
-    /// @brief Delete all clients in the local list as well as from the router
-    void _deleteExistingClients();
-    
-    /// @brief Request an access token for an existing client
-    bool _grantClientToken(PeplinkAPI_ClientInfo &client);
-    
-    /// @brief  Refresh the access token used for non-admin API access.
-    /// @note   By default, the access token used for API acccess is one granted in the most recent call to _grantClientToken()
-    bool _refreshToken();
-
-private:
-    PeplinkRouterInfo _info;
-    PeplinkRouterLocation _location;
-    bool _available;
-    String _ip;
-    uint16_t _port;
-    String _cookie;
-    String _token;
-    std::vector<PeplinkAPI_WAN *> _wan;
-    std::vector<PeplinkAPI_WAN_Traffic> _wanTraffic;
-    std::vector<PeplinkAPI_ClientInfo> _clients;
-};
-
+#ifndef _PEPLINKAPI_H_
+#define _PEPLINKAPI_H_
+
+#include <vector>
+#include <stdint.h>
+
+#include <WiFi.h>
+#include <Arduino.h>
+#include <ESP32Ping.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include <ArduinoJson.h>
+#include <freertos/semphr.h>
+
+#include "secrets.h"
+#include "config.h"
+
+class PeplinkAPI_ResponseStream;
+class DnsCache;
+
+/// @brief Stores router-assigned credentials
+typedef struct
+{
+    uint32_t magic;         // Header used to verify the validity of a cookie jar retrieved from storage
+    char cookie[128];       // Issued at login, and used to subsequentlt provide admin access without explicit login
+    char token[128];        // Issued when a client token is granted and used for generic API access
+    uint32_t tokenExpiry;   // RTC wall-clock time, in seconds since 1970, at which the token expires. 0 if unknown
+    char clientId[64];      // ID of the client the fob created, which the token is granted to
+    char clientSecret[64];  // Secret used to grant the client new tokens
+} PeplinkAPI_CookieJar_t;
+
+/// @brief HTTP request types supported by the router
+typedef enum
+{
+    PEPLINKAPI_HTTP_REQUEST_GET, 
+    PEPLINKAPI_HTTP_REQUEST_POST,
+} PeplinkAPI_HTTPRequest_t;
+
+/// @brief Latency and reliability counters for requests sent to the router
+typedef struct
+{
+    uint32_t requests;      // Number of requests that completed with an HTTP response
+    uint32_t failures;      // Number of requests that failed at the transport level
+    uint32_t connects;      // Number of TCP (and TLS) handshakes performed. Stays flat while connections are reused
+    uint32_t reconnects;    // Number of kept-alive connections found reset by the router and re-established
+    uint32_t lastMs;        // Round-trip time of the most recent request, including reading the response body
+    uint32_t maxMs;         // Slowest round-trip time seen
+    uint64_t totalMs;       // Sum of all round-trip times, used to compute the average
+} PeplinkAPI_RequestStats_t;
+
+/// @brief Access rights used when creating a client
+typedef enum
+{
+    CLIENT_SCOPE_READ_ONLY,
+    CLIENT_SCOPE_READ_WRITE
+} PeplinkAPI_ClientScope_t;
+
+/// @brief Client information
+class PeplinkAPI_ClientInfo
+{
+public:
+    String name;
+    String id;
+    String secret;
+    String token;
+    int tokenExpiry;    // Time in seconds before the token granted to the client expires
+    PeplinkAPI_ClientScope_t scope;
+};
+
+/// @brief WAN types
+typedef enum
+{
+    PEPLINKAPI_WAN_TYPE_ETHERNET,
+    PEPLINKAPI_WAN_TYPE_CELLULAR,
+    PEPLINKAPI_WAN_TYPE_WIFI,
+} PeplinkAPI_WANType_t;
+
+/// @brief Parts of the router state fetched by PeplinkRouter::refresh(). Each comes from its own endpoint
+typedef enum
+{
+    PEPLINKAPI_STATE_WAN_STATUS  = (1 << 0),    // WAN connection status, including the SIM cards of cellular WANs
+    PEPLINKAPI_STATE_WAN_TRAFFIC = (1 << 1),    // WAN bandwidth
+    PEPLINKAPI_STATE_INFO        = (1 << 2),    // Device information
+    PEPLINKAPI_STATE_LOCATION    = (1 << 3),    // GPS location
+    PEPLINKAPI_STATE_ALL         = 0x0F,
+} PeplinkAPI_StatePart_t;
+
+/// @brief Fields of a WAN that changed since the previous response, as flagged in PeplinkAPI_WAN::changes
+typedef enum
+{
+    PEPLINKAPI_WAN_CHANGED_STATUS  = (1 << 0),    // Name, type, status message, priority or management flag
+    PEPLINKAPI_WAN_CHANGED_LED     = (1 << 1),    // Status LED colour
+    PEPLINKAPI_WAN_CHANGED_IP      = (1 << 2),    // IP address
+    PEPLINKAPI_WAN_CHANGED_SIGNAL  = (1 << 3),    // Carrier, network type, signal level or Wi-Fi network
+    PEPLINKAPI_WAN_CHANGED_SIM     = (1 << 4),    // SIM card detection, activity or ICCID
+    PEPLINKAPI_WAN_CHANGED_TRAFFIC = (1 << 5),    // Upload/download bandwidth
+    PEPLINKAPI_WAN_CHANGED_ADDED   = (1 << 6),    // WAN wasn't listed before
+    PEPLINKAPI_WAN_CHANGED_ALL     = 0x7F,
+} PeplinkAPI_WANChange_t;
+
+/// @brief SIM slot information for cellular wan
+typedef struct
+{
+    bool detected;
+    bool active;
+    char iccid[24];
+} PeplinkAPI_WAN_Cellular_SIM;
+
+/// @brief Fields specific to cellular WANs
+typedef struct
+{
+    char carrier[32];
+    int rssi;
+    int signalLevel;
+    char networkType[16];
+    uint8_t simCount;
+    PeplinkAPI_WAN_Cellular_SIM simCards[PEPLINK_MAX_SIMS];
+} PeplinkAPI_WAN_Cellular;
+
+/// @brief Fields specific to Wi-Fi WANs
+typedef struct
+{
+    int strength;
+    char ssid[33];
+    char bssid[18];
+} PeplinkAPI_WAN_WiFi;
+
+/// @brief Generic WAN. The type selects which of the type-specific members is valid
+struct PeplinkAPI_WAN
+{
+    char name[32];
+    char ip[16];
+    char status[48];
+    char statusLED[8];
+    long upload;        // Upload bandwidth
+    long download;      // Download bandwidth
+    char unit[8];       // Unit used for upload/download bandwidth
+    int id;
+    int priority;
+    PeplinkAPI_WANType_t type;
+    bool managementOnly;
+    uint8_t changes;    // PeplinkAPI_WANChange_t bits of the fields that changed in the last status and traffic responses
+    union
+    {
+        PeplinkAPI_WAN_Cellular cellular;
+        PeplinkAPI_WAN_WiFi wifi;
+    };
+};
+
+/// @brief Fixed-capacity list of WANs, sorted by priority.
+/// Entries are updated in place on each refresh, so the list never touches the heap
+struct PeplinkAPI_WANTable
+{
+    PeplinkAPI_WAN wans[PEPLINK_MAX_WANS];
+    uint8_t count = 0;
+
+    /// @brief Return the WAN with a given router-assigned \a id, or NULL if it isn't listed
+    PeplinkAPI_WAN *find(int id)
+    {
+        for (PeplinkAPI_WAN &wan : *this)
+            if (wan.id == id)
+                return &wan;
+        return NULL;
+    }
+    const PeplinkAPI_WAN *find(int id) const { return const_cast<PeplinkAPI_WANTable *>(this)->find(id); }
+
+    size_t size() const { return count; }
+    PeplinkAPI_WAN *begin() { return wans; }
+    PeplinkAPI_WAN *end() { return wans + count; }
+    const PeplinkAPI_WAN *begin() const { return wans; }
+    const PeplinkAPI_WAN *end() const { return wans + count; }
+};
+
+/// @brief Router device information
+struct PeplinkRouterInfo
+{
+    String name;
+    long uptime;
+    String serial;
+    String fwVersion;
+    String productCode;
+    String hardwareRev;
+};
+
+/// @brief Router location information
+struct PeplinkRouterLocation
+{
+    String latitude;
+    String longitude;
+    String altitude;
+};
+
+/// @brief A kept-alive HTTP/1.1 connection to the router
+class PeplinkAPI_Connection
+{
+public:
+#ifdef PEPLINK_USE_HTTPS
+    WiFiClientSecure client;
+#else
+    WiFiClient client;
+#endif
+    HTTPClient http;
+    uint32_t lastUsed;      // millis() timestamp at which the connection was last returned to the pool
+    uint32_t requestStart;  // millis() timestamp at which the current request was started
+    bool inUse;
+    bool closeOnRelease;    // Set when the connection should be dropped rather than reused once returned
+};
+
+/// @brief Fixed set of reusable connections to the router, so requests skip the TCP/TLS handshake
+class PeplinkAPI_ConnectionPool
+{
+public:
+    PeplinkAPI_ConnectionPool();
+
+    /// @brief Borrow a free connection, waiting up to \a timeoutMs for one to be returned if all are busy
+    /// @note  Connections left idle for longer than PEPLINK_HTTP_IDLE_TIMEOUT_MS are closed rather than reused
+    /// @return NULL if no connection became free in time
+    PeplinkAPI_Connection *acquire(uint32_t timeoutMs = PEPLINK_HTTP_ACQUIRE_TIMEOUT_MS);
+
+    /// @brief Return a borrowed connection to the pool and record the request latency
+    /// @param ok Whether the request completed. Failed connections are closed instead of being kept alive
+    void release(PeplinkAPI_Connection *conn, bool ok);
+
+    /// @brief Close every connection, e.g. when the router address changes
+    /// @note  Connections that are currently borrowed are closed when they are released
+    void closeAll();
+
+    /// @brief Count a TCP (and TLS) handshake. \a reconnect is set when a reset kept-alive connection was replaced
+    void countConnect(bool reconnect);
+
+    /// @brief Return a copy of the request counters
+    PeplinkAPI_RequestStats_t stats();
+
+private:
+    PeplinkAPI_Connection _connections[PEPLINK_HTTP_POOL_SIZE];
+    SemaphoreHandle_t _free;    // Counts the connections available to borrow
+    SemaphoreHandle_t _lock;    // Guards connection ownership and the request counters
+    PeplinkAPI_RequestStats_t _stats;
+};
+
+/// @brief 
+class PeplinkRouter
+{
+
+public:
+    PeplinkRouter() { _lock = xSemaphoreCreateRecursiveMutex(); };
+    PeplinkRouter(String ip, uint16_t port)
+    {
+        _lock = xSemaphoreCreateRecursiveMutex();
+        _ip = ip;
+        _port = port;
+    }
+
+    /// @brief Hold the router while reading the list returned by wanStatus(), so a request can't update it mid-read.
+    /// Every request holds the router too, so only one task talks to it at a time
+    void lock() { xSemaphoreTakeRecursive(_lock, portMAX_DELAY); _lockDepth++; }
+
+    /// @brief Release the router after reading the WAN list. Releasing the outermost hold logs a login failure
+    /// recorded while it was held
+    void unlock();
+
+    /// @brief Ping the router IP address
+    bool begin(){ return checkAvailable(); }
+
+    
+    /// @brief Initialize the router object by testing the validity of cookes and accesss token and refreshing them as necessary
+    /// @note The cookie and token values should be initialized from NVS (if available) prior to calling this function, avoding unnecessary login
+    /// @param username Administrator username used when loging in
+    /// @param password Administrator password used when loging in
+    /// @param clientName Name of the client to create if the one set with setClient() is no longer valid
+    /// @param clientScope Access rights used to create a new client
+    /// @param deleteExistingClients Whether to have clients left over from earlier sessions deleted by pruneClients()
+    /// @return Cookie, on success.
+    /// @return Empty string on fail
+    String begin(String username, String password, String clientName, PeplinkAPI_ClientScope_t clientScope, bool deleteExistingClients);
+    
+    /// @brief Check whether the IP address of the router is reachable via a ping request
+    /// @note   Default ping timeout is 10s. A host name is resolved through the resolver set with setResolver()
+    /// @return true on ping success
+    /// @return false on ping fail
+    bool checkAvailable();
+
+    bool available() const { return _available;}
+
+    bool update() { return (getClientList() && refresh()); }
+
+    /// @brief Fetch the WAN status, WAN traffic, device info and location together on one connection
+    /// and replace the local copies at once, so they all describe the router at the same moment
+    /// @param parts PeplinkAPI_StatePart_t bits selecting which of the four to fetch
+    /// @param wanId Only fetch the WAN status and traffic of the WAN with this ID, updating its entry in place.
+    ///        0 fetches every WAN, dropping any the router no longer reports
+    /// @return true if all the requested parts were retrieved. On fail, the previous copies are left untouched
+    bool refresh(uint8_t parts = PEPLINKAPI_STATE_ALL, uint8_t wanId = 0);
+
+    /// @brief Return the millis() timestamp at which the last successful refresh() completed
+    uint32_t lastRefresh() const { return _lastRefresh; }
+    
+    /// @brief Retrieve the router's list of registered clients and update the local copy.
+    /// @note  Any existing clients in the local list is cleared before the new list is retrieved
+    bool getClientList();
+    
+    /// @brief Get the WAN connection status
+    /// @param withTraffic Whether to also fetch the bandwidth of the WANs in a second request
+    bool getWanStatus(uint8_t id = 0, bool withTraffic = true);
+    
+    /// @brief Get the bandwith of all WANs
+    bool getWanTraffic(uint8_t id = 0);
+    
+    /// @brief Get device information from router
+    bool getInfo();
+
+    /// @brief Return the router device information
+    PeplinkRouterInfo info() { lock(); PeplinkRouterInfo info = _info; unlock(); return info; };
+
+    /// @brief Get location information from router
+    bool getLocation();
+
+    /// @brief Return router location
+    PeplinkRouterLocation location() { lock(); PeplinkRouterLocation location = _location; unlock(); return location; };
+    
+    /// @brief Set the router IP address
+    void setIP(String ip) { lock(); if (ip != _ip) _pool.closeAll(); _ip = ip; unlock(); };
+
+    /// @brief Get the router IP address
+    String ip() const { return _ip; };
+
+    /// @brief Set the router port
+    void setPort(uint16_t port) { lock(); if (port != _port) _pool.closeAll(); _port = port; unlock(); };
+
+    /// @brief Get the router port
+    uint16_t port() const { return _port; };
+
+    /// @brief Resolve the router address through \a dns when it is a host name rather than an IP address
+    void setResolver(DnsCache *dns) { _dns = dns; };
+
+    /// @brief Set the router login cookie
+    /// @note Call this function before begin() to use a cookie retrieved from NVS for admin access rather than logging in afresh
+    void setCookie(String cookie) { _cookie = cookie; }
+
+    /// @brief Get the router cookie
+    String cookie() const { return _cookie; }
+    
+    /// @brief Set the router API access token
+    /// @note Call this function before begin() to use an access token retrieved from NVS for API access
+    void setToken(String token) { _token = token; }
+    
+    /// @brief Get the router API access token
+    String token() const { return _token; }
+
+    /// @brief Set the ID and secret of the client the fob created in an earlier session
+    /// @note Call this function before begin() so a new token is granted to that client rather than a new client created
+    void setClient(String id, String secret) { _client.id = id; _client.secret = secret; }
+
+    /// @brief Return whether clients left over from earlier sessions are waiting to be deleted by pruneClients()
+    bool clientsNeedPruning() const { return _pruneClients; }
+
+    /// @brief Delete, in one pass, the clients the router holds under the fob's client name other than the one in use
+    /// @return false if the client list couldn't be fetched
+    bool pruneClients();
+
+    /// @brief Set how many seconds the access token has left, e.g. for one retrieved from NVS.
+    /// 0 has it renewed by the next call to renewTokenIfExpiring()
+    void setTokenExpiry(uint32_t secondsLeft);
+
+    /// @brief Return whether there is an access token that expires within \a seconds. An expiry never set counts as far off
+    bool tokenExpiresWithin(uint32_t seconds) const;
+
+    /// @brief Grant a new access token to the fob's client, so requests never meet an expired one.
+    /// Falls back to creating a new client if the router no longer knows it
+    /// @return true if a new token was granted
+    bool renewToken();
+
+    /// @brief Renew the access token if it expires within PEPLINK_TOKEN_RENEW_MARGIN_S
+    /// @return false if it had to be renewed but couldn't be
+    bool renewTokenIfExpiring();
+
+
+    /// @brief Log in to router with a the administrator \a username & \a password
+    /// @return Server-generated cookie if login is successful and access rights are confirmed
+    /// @return Empty String on fail
+    String login(const char *username, const char *password);
+
+    std::vector<PeplinkAPI_ClientInfo> clients() { lock(); std::vector<PeplinkAPI_ClientInfo> clients = _clients; unlock(); return clients; };
+    size_t numClients() const { return _clients.size(); };
+    /// @brief Return the WAN list
+    /// @note  Only valid between lock() and unlock()
+    const PeplinkAPI_WANTable &wanStatus() const { return _wan; };
+
+    bool remoterReboot();
+
+    /// @brief Return latency and connection reuse counters for requests sent to the router
+    PeplinkAPI_RequestStats_t requestStats() { return _pool.stats(); }
+
+private:
+
+    /// @brief Open a fresh socket to the router on \a conn. A router known by name is resolved through the DNS cache when
+    /// there is one, and only without a cache is the name handed to the client to look up
+    /// @return false if the name didn't resolve or the router didn't answer
+    bool _connect(PeplinkAPI_Connection *conn);
+
+    /// @brief Borrow a pooled connection and send a request on it, reconnecting once if the router reset a kept-alive connection
+    /// @note  The connection remains borrowed on return so the response can be read. Hand it back with _endRequest()
+    /// @param conn Set to the borrowed connection, or NULL if none was available
+    /// @param headerKeys Optional list of response headers to collect
+    /// @return HTTP response code, or a negative HTTPC_ERROR_* value on fail
+    int _beginRequest(PeplinkAPI_Connection *&conn, PeplinkAPI_HTTPRequest_t type, String &endpoint, const char *body,
+                      const char **headerKeys = NULL, size_t headerCount = 0);
+
+    /// @brief Return a connection borrowed by _beginRequest() to the pool
+    /// @param ok Whether the request completed. Failed connections are closed rather than kept alive
+    void _endRequest(PeplinkAPI_Connection *conn, bool ok);
+    
+    /// @brief Send an HTTP request, parse the JSON response straight off the connection and handle any authentication errors
+    /// @param type HTTP request type. Either GET or POST
+    /// @param endpoint URL of the API endpoint to send the request to
+    /// @param body If sending a POST request, this parameter becomes the body content of the request
+    /// @param recvDoc Receives the parsed response
+    /// @param filter Optional ArduinoJson filter selecting the response fields to keep. The status fields are always kept
+    /// @return true if the router reports the operation succeeded
+    /// @return false on fail
+    bool _sendJsonRequest(PeplinkAPI_HTTPRequest_t type, String &endpoint, const char *body, JsonDocument &recvDoc, JsonDocument *filter = NULL);
+
+    /// @brief Send several GET requests on one connection, pipelined if PEPLINK_HTTP_PIPELINING is defined
+    /// @param recvDocs Receives the parsed response of each endpoint, in the same order
+    /// @param filters Filter for each endpoint's response
+    /// @return true if the router reports all the operations succeeded
+    bool _sendJsonRequests(String *endpoints, JsonDocument *recvDocs, JsonDocument *filters, size_t count);
+
+    /// @brief Write all the GET requests to one connection, then read the responses in order
+    /// @return Number of responses parsed before the first failure. Their operation status is not checked
+    size_t _sendPipelinedRequests(String *endpoints, JsonDocument *recvDocs, JsonDocument *filters, size_t count);
+
+    /// @brief Parse one response body and leave the connection at the start of the next response
+    bool _parseJsonResponse(PeplinkAPI_ResponseStream &bodyStream, JsonDocument &recvDoc, JsonDocument *filter);
+
+    /// @brief Check the operation status of a parsed response, renewing the cookie or token on authentication errors
+    bool _checkOperationStatus(JsonDocument &recvDoc);
+
+    /// @brief Update the local WAN list in place from a WAN status response, then sort it by priority.
+    /// The changes of each listed WAN are flagged against its previous copy
+    /// @param id ID the response was requested for. 0 means the response lists every WAN, so any WAN missing from it is dropped
+    void _parseWanList(JsonDocument &recvDoc, uint8_t id = 0);
+
+    /// @brief Copy the bandwidth in a traffic response into the matching WANs of the local list
+    /// @param id Only update the WAN with this ID. 0 updates all of them
+    void _parseWanTraffic(JsonDocument &recvDoc, uint8_t id = 0);
+
+    /// @brief Extract the device information from a system info response
+    void _parseInfo(JsonDocument &recvDoc);
+
+    /// @brief Extract the location from a location response
+    void _parseLocation(JsonDocument &recvDoc);
+
+    /// @brief Extract the information for ethernet-type WAN into \a wan
+    void _parseEthernetWAN(JsonObject wanInfo, PeplinkAPI_WAN &wan);
+
+    /// @brief Extract the information for cellular-type WAN into \a wan
+    void _parseCellularWAN(JsonObject wanInfo, PeplinkAPI_WAN &wan);
+
+    /// @brief Extract the information for WiFi-type WAN into \a wan
+    void _parseWiFiWAN(JsonObject wanInfo, PeplinkAPI_WAN &wan);
+
+    /// @brief Create a clent with a given \a name and permissions.
+    /// @note   Multiple clients can be created with the same name since the router will assing each one a unique ID 
+    /// @return On success, id and secret populated
+    /// @return On fail, empty PeplinkAPI_ClientInfo
+    PeplinkAPI_ClientInfo _createClient(String name, PeplinkAPI_ClientScope_t scope);
+    
+    /// @brief Delete a specified client from the local list as well as from the router
+    bool _deleteClient(PeplinkAPI_ClientInfo &client);
+    
+    /// @brief Request an access token for an existing client
+    bool _grantClientToken(PeplinkAPI_ClientInfo &client);
+    
+    /// @brief  Refresh the access token used for non-admin API access by creating a new client.
+    /// @note   By default, the access token used for API acccess is one granted in the most recent call to _grantClientToken()
+    bool _refreshToken();
+
+private:
+    PeplinkRouterInfo _info;
+    PeplinkRouterLocation _location;
+    bool _available;
+    uint32_t _lastRefresh = 0;
+    String _ip;
+    uint16_t _port;
+    DnsCache *_dns = NULL;
+    String _cookie;
+    String _token;
+    bool _tokenExpiryKnown = false;
+    uint32_t _tokenExpiryMs = 0;        // millis() at which the token expires
+    PeplinkAPI_ClientInfo _client;      // Client the fob created, which the token is granted to
+    String _clientName = CLIENT_NAME_DEFAULT;
+    PeplinkAPI_ClientScope_t _clientScope = CLIENT_SCOPE_DEFAULT;
+    bool _pruneClients = false;
+    bool _renewingToken = false;
+    PeplinkAPI_WANTable _wan;
+    std::vector<PeplinkAPI_ClientInfo> _clients;
+    PeplinkAPI_ConnectionPool _pool;
+    SemaphoreHandle_t _lock;    // Recursive, since requests renew the cookie or token from within
+    uint8_t _lockDepth = 0;     // Holds of _lock taken by its current holder
+    bool _authFailed = false;   // A login failed under the lock, and is logged when the lock is released
+    int _authFailCode = 0;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,391 @@
+#include "M5StickCPlus2.h"
+#include <WiFi.h>
+
+#include "RouterCache.h"
+#include "utils.h"
+#include "config.h"
+
+#if CONFIG_FREERTOS_UNICORE
+#define ARDUINO_RUNNING_CORE 0
+#else
+#define ARDUINO_RUNNING_CORE 1
+#endif
+
+/// @brief Event group bit set when the last refresh failed
+#define ROUTER_CACHE_FAILED_BIT (1 << 7)
+
+/// @brief Number of cached parts, one per PeplinkAPI_StatePart_t bit
+#define ROUTER_CACHE_PART_COUNT 4
+
+/// @brief Time-to-live of each part, in PeplinkAPI_StatePart_t bit order
+static const uint32_t partTtlMs[ROUTER_CACHE_PART_COUNT] = {
+    ROUTER_CACHE_WAN_STATUS_TTL_MS,
+    ROUTER_CACHE_WAN_TRAFFIC_TTL_MS,
+    ROUTER_CACHE_INFO_TTL_MS,
+    ROUTER_CACHE_LOCATION_TTL_MS,
+};
+
+/// @brief Parts polled in the background even when nobody is reading them, so state changes are noticed
+/// and the WAN history keeps filling
+#define ROUTER_POLL_PARTS (PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC)
+
+RouterStateCache::RouterStateCache()
+{
+  _router = NULL;
+  _task = NULL;
+  _lock = xSemaphoreCreateMutex();
+  _events = xEventGroupCreate();
+  _wanted = 0;
+  _focusWan = 0;
+  _wantedFocus = 0;
+  _focusAttempted = 0;
+  _lastFlap = 0;
+  memset(_attempted, 0, sizeof(_attempted));
+  memset(_watchCount, 0, sizeof(_watchCount));
+  memset(_subscribers, 0, sizeof(_subscribers));
+}
+
+void RouterStateCache::begin(PeplinkRouter *router)
+{
+  _router = router;
+  if (!_task)
+    xTaskCreatePinnedToCore(_refreshTask, "Router Cache", 8192, this, 1, &_task, ARDUINO_RUNNING_CORE);
+}
+
+void RouterStateCache::watch(uint8_t parts)
+{
+  lock();
+  for (size_t i = 0; i < ROUTER_CACHE_PART_COUNT; ++i)
+    if (parts & (1 << i))
+      _watchCount[i]++;
+  _want(parts);
+  unlock();
+}
+
+void RouterStateCache::unwatch(uint8_t parts)
+{
+  lock();
+  for (size_t i = 0; i < ROUTER_CACHE_PART_COUNT; ++i)
+    if ((parts & (1 << i)) && _watchCount[i])
+      _watchCount[i]--;
+  unlock();
+}
+
+void RouterStateCache::focus(uint8_t wanId)
+{
+  lock();
+  if (wanId != _focusWan)
+  {
+    _focusWan = wanId;
+    _wantedFocus = 0;
+    _focusAttempted = 0;
+  }
+  unlock();
+}
+
+bool RouterStateCache::subscribe(TaskHandle_t task)
+{
+  bool subscribed = false;
+  lock();
+  for (TaskHandle_t &subscriber : _subscribers)
+  {
+    if (!subscriber || subscriber == task)
+    {
+      subscriber = task;
+      subscribed = true;
+      break;
+    }
+  }
+  unlock();
+  return subscribed;
+}
+
+uint32_t RouterStateCache::pollInterval()
+{
+  bool watched = false;
+  lock();
+  for (uint8_t count : _watchCount)
+    watched |= (count > 0);
+  bool flapping = _lastFlap && (millis() - _lastFlap < ROUTER_POLL_FLAP_HOLD_MS);
+  unlock();
+
+  if (watched || flapping)
+    return ROUTER_POLL_FAST_MS;
+  if (M5.Power.isCharging() == m5::Power_Class::is_discharging)
+    return ROUTER_POLL_BATTERY_MS;
+  return ROUTER_POLL_IDLE_MS;
+}
+
+bool RouterStateCache::waitFor(uint8_t parts, uint32_t timeoutMs)
+{
+  lock();
+  _want(parts);
+  uint8_t missing = parts & ~xEventGroupGetBits(_events);
+  if (missing)
+  {
+    // A page asking for something never fetched retries straight away, even if the last attempt just failed
+    xEventGroupClearBits(_events, ROUTER_CACHE_FAILED_BIT);
+    _want(missing, true);
+  }
+  unlock();
+
+  uint32_t start = millis();
+  while (missing)
+  {
+    uint32_t elapsed = millis() - start;
+    if (elapsed >= timeoutMs)
+      return false;
+
+    EventBits_t bits = xEventGroupWaitBits(_events, missing | ROUTER_CACHE_FAILED_BIT, pdFALSE, pdFALSE, pdMS_TO_TICKS(timeoutMs - elapsed));
+    missing = parts & ~bits;
+    if (missing && (bits & ROUTER_CACHE_FAILED_BIT))
+      return false;
+  }
+  return true;
+}
+
+PeplinkRouterInfo RouterStateCache::info()
+{
+  lock();
+  _want(PEPLINKAPI_STATE_INFO);
+  PeplinkRouterInfo info = _info;
+  unlock();
+  return info;
+}
+
+PeplinkRouterLocation RouterStateCache::location()
+{
+  lock();
+  _want(PEPLINKAPI_STATE_LOCATION);
+  PeplinkRouterLocation location = _location;
+  unlock();
+  return location;
+}
+
+const PeplinkAPI_WANTable &RouterStateCache::wans()
+{
+  _want(PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC);
+  return _wans;
+}
+
+void RouterStateCache::clearWanChanges()
+{
+  for (PeplinkAPI_WAN &wan : _wans)
+    wan.changes = 0;
+}
+
+void RouterStateCache::_want(uint8_t parts, bool force)
+{
+  uint32_t now = millis();
+
+  // While a WAN is in focus its parts are fetched for it alone, until the full list is due at the idle pace
+  bool focused = _focusWan && !force && _attempted[0] && now - _attempted[0] < ROUTER_POLL_IDLE_MS;
+
+  uint8_t due = 0;
+  uint8_t focusDue = 0;
+  for (size_t i = 0; i < ROUTER_CACHE_PART_COUNT; ++i)
+  {
+    if (!(parts & (1 << i)))
+      continue;
+    if (focused && ((1 << i) & ROUTER_POLL_PARTS))
+    {
+      if (!_focusAttempted || now - _focusAttempted >= partTtlMs[i])
+        focusDue |= (1 << i);
+    }
+    else if (force || !_attempted[i] || now - _attempted[i] >= partTtlMs[i])
+      due |= (1 << i);
+  }
+
+  // Parts already queued will be fetched by the pending refresh
+  due &= ~_wanted;
+  focusDue &= ~_wantedFocus;
+  if (!due && !focusDue)
+    return;
+
+  _wanted |= due;
+  _wantedFocus |= focusDue;
+  if (_task)
+    xTaskNotifyGive(_task);
+}
+
+void RouterStateCache::_refreshTask(void *arg)
+{
+  RouterStateCache *cache = (RouterStateCache *)arg;
+  for (;;)
+  {
+    // Woken early when a reader wants a stale part, otherwise poll on schedule
+    if (!ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(cache->pollInterval())))
+    {
+      // Polling before the router has granted a token would only earn authentication errors
+      if (WiFi.status() != WL_CONNECTED || !cache->_router || !cache->_router->token().length())
+        continue;
+
+      uint8_t parts = ROUTER_POLL_PARTS;
+      cache->lock();
+      for (size_t i = 0; i < ROUTER_CACHE_PART_COUNT; ++i)
+        if (cache->_watchCount[i])
+          parts |= (1 << i);
+      cache->_want(parts);
+      cache->unlock();
+    }
+    cache->_refresh();
+
+    // Clients left over from earlier sessions are deleted once the router has answered a poll, off the boot path
+    if (cache->_router && cache->_router->clientsNeedPruning() && cache->available(ROUTER_POLL_PARTS))
+      cache->_router->pruneClients();
+  }
+}
+
+void RouterStateCache::_refresh()
+{
+  lock();
+  uint8_t parts = _wanted;
+  uint8_t wanId = _focusWan;
+  // Parts also fetched for every WAN needn't be fetched again for the focused one
+  uint8_t focusParts = wanId ? (_wantedFocus & ~parts) : 0;
+  _wanted = 0;
+  _wantedFocus = 0;
+  uint32_t now = millis();
+  for (size_t i = 0; i < ROUTER_CACHE_PART_COUNT; ++i)
+    if (parts & (1 << i))
+      _attempted[i] = now;
+  if (focusParts)
+    _focusAttempted = now;
+  unlock();
+
+  if ((!parts && !focusParts) || !_router)
+    return;
+
+  // Renew the access token ahead of its expiry, so the requests below don't fail on it first
+  _router->renewTokenIfExpiring();
+
+  uint8_t changed = 0;
+  if (parts)
+    changed |= _fetch(parts, 0);
+  if (focusParts)
+    changed |= _fetch(focusParts, wanId);
+
+  if (!changed)
+    return;
+
+  lock();
+  TaskHandle_t subscribers[ROUTER_CACHE_MAX_SUBSCRIBERS];
+  memcpy(subscribers, _subscribers, sizeof(subscribers));
+  unlock();
+
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.printf("Router state changed: 0x%02x\n", changed);
+#endif
+  for (TaskHandle_t subscriber : subscribers)
+    if (subscriber)
+      xTaskNotify(subscriber, changed, eSetBits);
+}
+
+uint8_t RouterStateCache::_fetch(uint8_t parts, uint8_t wanId)
+{
+#ifdef PEPLINK_DEBUG_LOG
+  Serial.printf("Router cache refreshing parts 0x%02x of WAN %u\n", parts, wanId);
+#endif
+
+  // Serve the old copies while the router is asked, rather than holding the cache for the whole request
+  if (!_router->refresh(parts, wanId))
+  {
+    xEventGroupSetBits(_events, ROUTER_CACHE_FAILED_BIT);
+    return 0;
+  }
+
+  PeplinkRouterInfo info = _router->info();
+  PeplinkRouterLocation location = _router->location();
+
+  // A part fetched for the first time counts as changed. One WAN alone doesn't make the WAN list cached
+  uint8_t changed = wanId ? 0 : parts & ~xEventGroupGetBits(_events);
+
+  // The router's WAN list is copied out before the cache is held. The router stays held by other tasks
+  // through whole requests, which readers of the cache mustn't wait for
+  bool wanParts = parts & (PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC);
+  PeplinkAPI_WANTable wans;
+  if (wanParts)
+  {
+    _router->lock();
+    wans = _router->wanStatus();
+    _router->unlock();
+  }
+
+  // Logging writes to flash, so transitions are only collected under the lock
+  WanTransition transitions[PEPLINK_MAX_WANS];
+  size_t transitionCount = 0;
+
+  lock();
+  if (wanParts)
+  {
+    changed |= _copyWans(wans, parts, wanId, transitions, transitionCount) & parts;
+    // The history samples every WAN at the same moment, so only full listings go in
+    if (!wanId)
+      _history.record(wans, parts);
+  }
+  if (parts & PEPLINKAPI_STATE_INFO)
+  {
+    if (info.name != _info.name || info.uptime != _info.uptime || info.serial != _info.serial || info.fwVersion != _info.fwVersion)
+      changed |= PEPLINKAPI_STATE_INFO;
+    _info = info;
+  }
+  if (parts & PEPLINKAPI_STATE_LOCATION)
+  {
+    if (location.latitude != _location.latitude || location.longitude != _location.longitude || location.altitude != _location.altitude)
+      changed |= PEPLINKAPI_STATE_LOCATION;
+    _location = location;
+  }
+  unlock();
+
+  for (size_t i = 0; i < transitionCount; ++i)
+    logEvent(EVENT_LOG_WAN_CHANGE, 0, transitions[i].id, transitions[i].led);
+
+  if (!wanId)
+    xEventGroupSetBits(_events, parts);
+  return changed;
+}
+
+uint8_t RouterStateCache::_copyWans(const PeplinkAPI_WANTable &wans, uint8_t parts, uint8_t wanId, WanTransition *transitions,
+                                    size_t &transitionCount)
+{
+  transitionCount = 0;
+  uint8_t fresh = 0;
+  if (parts & PEPLINKAPI_STATE_WAN_STATUS)
+    fresh |= PEPLINKAPI_WAN_CHANGED_ALL & ~PEPLINKAPI_WAN_CHANGED_TRAFFIC;
+  if (parts & PEPLINKAPI_STATE_WAN_TRAFFIC)
+    fresh |= PEPLINKAPI_WAN_CHANGED_TRAFFIC;
+
+  // Changes the reader hasn't cleared yet carry over to the same WAN, wherever the new sort puts it
+  uint8_t pending[PEPLINK_MAX_WANS];
+  bool moved = wans.size() != _wans.size();
+  for (size_t i = 0; i < wans.size(); ++i)
+  {
+    const PeplinkAPI_WAN *cached = _wans.find(wans.wans[i].id);
+    pending[i] = cached ? cached->changes : PEPLINKAPI_WAN_CHANGED_ALL;
+    moved |= (i >= _wans.size() || _wans.wans[i].id != wans.wans[i].id);
+  }
+  // The first list fetched isn't a state change
+  bool hadWans = _wans.size() > 0;
+  bool flapped = moved && hadWans;
+
+  uint8_t changed = moved ? (PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC) : 0;
+  _wans = wans;
+  for (size_t i = 0; i < _wans.size(); ++i)
+  {
+    PeplinkAPI_WAN &wan = _wans.wans[i];
+    uint8_t changes = (!wanId || wan.id == wanId) ? wan.changes & fresh : 0;
+    if (changes & ~PEPLINKAPI_WAN_CHANGED_TRAFFIC)
+      changed |= PEPLINKAPI_STATE_WAN_STATUS;
+    if (changes & PEPLINKAPI_WAN_CHANGED_TRAFFIC)
+      changed |= PEPLINKAPI_STATE_WAN_TRAFFIC;
+    if (hadWans && (changes & (PEPLINKAPI_WAN_CHANGED_STATUS | PEPLINKAPI_WAN_CHANGED_LED)))
+      flapped = true;
+    if (hadWans && (changes & PEPLINKAPI_WAN_CHANGED_LED))
+      transitions[transitionCount++] = {(uint8_t)wan.id, WanHistory::led(wan.statusLED)};
+    wan.changes = changes | pending[i];
+  }
+
+  if (flapped)
+    _lastFlap = millis();
+  return changed;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file  RouterCache.h
+ * @brief Shared, time-limited copy of the router state read by the UI pages
+ */
+
+#ifndef _STARLINKFOB_ROUTERCACHE_H_
+#define _STARLINKFOB_ROUTERCACHE_H_
+
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <freertos/semphr.h>
+#include <freertos/event_groups.h>
+
+#include "PeplinkAPI.h"
+#include "WanHistory.h"
+#include "config.h"
+
+/// @brief Holds the last router state fetched for each PeplinkAPI_StatePart_t.
+/// Reads always return the cached copy straight away. A part older than its TTL is still returned
+/// but also queued for a background refresh, so the router sees at most one request per part per TTL
+/// no matter how many pages read it.
+/// A single background task also polls the router on its own, faster while something is watching
+/// or a WAN keeps changing state, and notifies subscribed tasks of the parts that changed
+class RouterStateCache
+{
+public:
+    RouterStateCache();
+
+    /// @brief Start the background task that polls \a router and fetches stale parts on demand
+    void begin(PeplinkRouter *router);
+
+    /// @brief Poll \a parts at the fast interval while something is displaying them. Pair each call with unwatch()
+    void watch(uint8_t parts);
+
+    /// @brief Stop a watch started with watch()
+    void unwatch(uint8_t parts);
+
+    /// @brief Fetch the status and traffic of only the WAN with ID \a wanId while a page is showing it.
+    /// The full WAN list is still fetched, but only at the idle poll pace, to keep the history and the other WANs current
+    /// @param wanId ID of the WAN shown. 0 to go back to fetching every WAN
+    void focus(uint8_t wanId);
+
+    /// @brief Notify \a task whenever cached parts change.
+    /// The PeplinkAPI_StatePart_t bits of the parts that changed are set in its notification value,
+    /// so the task should only be sent eSetBits notifications
+    /// @return false if ROUTER_CACHE_MAX_SUBSCRIBERS tasks are already subscribed
+    bool subscribe(TaskHandle_t task);
+
+    /// @brief Return the millisecond interval the router is currently polled at
+    uint32_t pollInterval();
+
+    /// @brief Block until all the requested \a parts have been fetched at least once
+    /// @note  Parts already cached return at once, even when stale
+    /// @return true if the parts are cached
+    /// @return false if fetching them failed or timed out
+    bool waitFor(uint8_t parts, uint32_t timeoutMs = ROUTER_CACHE_WAIT_TIMEOUT_MS);
+
+    /// @brief Return the cached router device information
+    PeplinkRouterInfo info();
+
+    /// @brief Return the cached router location
+    PeplinkRouterLocation location();
+
+    /// @brief Hold the cache while reading the list returned by wans(), so a refresh can't replace it mid-read
+    void lock() { xSemaphoreTake(_lock, portMAX_DELAY); }
+
+    /// @brief Release the cache after reading the WAN list
+    void unlock() { xSemaphoreGive(_lock); }
+
+    /// @brief Return the cached WAN list, sorted by priority, with the bandwidth of each WAN.
+    /// The changes flagged on each WAN build up across refreshes until clearWanChanges() is called
+    /// @note  Only valid between lock() and unlock()
+    const PeplinkAPI_WANTable &wans();
+
+    /// @brief Clear the change flags of the cached WANs once the reader displaying them has caught up
+    /// @note  Only valid between lock() and unlock()
+    void clearWanChanges();
+
+    /// @brief Return the history of the WAN readings the cache has fetched
+    WanHistory &history() { return _history; }
+
+    /// @brief Return whether all the requested \a parts are cached
+    bool available(uint8_t parts) { return (xEventGroupGetBits(_events) & parts) == parts; }
+
+private:
+    /// @brief Queue \a parts for a background refresh if they are stale. Must be called with the cache held
+    /// @param force Queue them even if they were attempted within their TTL
+    void _want(uint8_t parts, bool force = false);
+
+    /// @brief Poll the router every pollInterval(), and fetch wanted parts whenever woken
+    static void _refreshTask(void *arg);
+
+    /// @brief Fetch the wanted stale parts, then those of the focused WAN, and notify subscribers of any changes
+    void _refresh();
+
+    /// @brief Fetch \a parts in one batch and copy them in
+    /// @param wanId Only fetch the WAN parts of the WAN with this ID. 0 fetches every WAN
+    /// @return PeplinkAPI_StatePart_t bits of the parts that changed
+    uint8_t _fetch(uint8_t parts, uint8_t wanId);
+
+    /// @brief A WAN whose status LED changed in a fetch, logged once the cache is released
+    struct WanTransition
+    {
+        uint8_t id;
+        uint8_t led;
+    };
+
+    /// @brief Replace the cached WAN list with a freshly fetched one, keeping the changes not yet cleared
+    /// @param parts Parts the list was fetched for. The router's change flags for other parts are out of date
+    /// @param wanId ID of the only WAN fetched, whose change flags alone are up to date. 0 if all were fetched
+    /// @param transitions Filled with the WANs whose status LED changed. Holds PEPLINK_MAX_WANS entries
+    /// @param transitionCount Set to the number of entries filled in \a transitions
+    /// @return PeplinkAPI_StatePart_t bits of the WAN parts that changed
+    uint8_t _copyWans(const PeplinkAPI_WANTable &wans, uint8_t parts, uint8_t wanId, WanTransition *transitions,
+                      size_t &transitionCount);
+
+    PeplinkRouter *_router;
+    TaskHandle_t _task;
+    SemaphoreHandle_t _lock;
+    EventGroupHandle_t _events;     // One bit per cached part, plus a bit set when a refresh fails
+    uint8_t _wanted;                // Parts read since they went stale
+    uint8_t _focusWan;              // ID of the WAN fetched on its own. 0 if none
+    uint8_t _wantedFocus;           // WAN parts of the focused WAN read since they went stale
+    uint32_t _focusAttempted;       // millis() at which the focused WAN was last requested. 0 if never
+    uint32_t _attempted[4];         // millis() at which each part was last requested, in PeplinkAPI_StatePart_t bit order. 0 if never
+    uint8_t _watchCount[4];         // Number of watchers of each part, in PeplinkAPI_StatePart_t bit order
+    uint32_t _lastFlap;             // millis() at which a WAN last changed state. 0 if never
+    TaskHandle_t _subscribers[ROUTER_CACHE_MAX_SUBSCRIBERS];
+    PeplinkRouterInfo _info;
+    PeplinkRouterLocation _location;
+    PeplinkAPI_WANTable _wans;
+    WanHistory _history;
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include "Sparkline.h"
+
+#define SPARKLINE_BACKGROUND_COLOUR TFT_BLACK
+#define SPARKLINE_PRIMARY_COLOUR    TFT_DARKCYAN
+#define SPARKLINE_SECONDARY_COLOUR  TFT_YELLOW
+
+/// @brief Shortest graph worth drawing, in pixels above the strip
+#define SPARKLINE_MIN_PLOT_HEIGHT   8
+
+/// @brief Return the smallest 1, 2 or 5 times a power of ten that is at least \a value
+static uint32_t niceCeiling(uint32_t value)
+{
+  uint32_t decade = 1;
+  while (decade <= UINT32_MAX / 10 && decade * 10 <= value)
+    decade *= 10;
+  if (value <= decade)
+    return decade;
+  if (value <= 2 * decade)
+    return 2 * decade;
+  if (value <= 5 * decade)
+    return 5 * decade;
+  return (decade <= UINT32_MAX / 10) ? 10 * decade : UINT32_MAX;
+}
+
+Sparkline::Sparkline()
+{
+  place(0, 0, 0, 0);
+}
+
+void Sparkline::place(int x, int y, int w, int h, int columnWidth, int stripHeight)
+{
+  _x = x;
+  _y = y;
+  _w = w;
+  _h = h;
+  _columnWidth = columnWidth > 0 ? columnWidth : 1;
+  _stripHeight = stripHeight;
+  _columns = min((size_t)(w / _columnWidth), (size_t)SPARKLINE_MAX_COLUMNS);
+  if (h - stripHeight - 1 < SPARKLINE_MIN_PLOT_HEIGHT)
+    _columns = 0;
+  _head = 0;
+  _count = 0;
+  _scale = 1;
+}
+
+void Sparkline::add(uint32_t primary, uint32_t secondary, uint16_t strip)
+{
+  if (!_columns)
+    return;
+
+  size_t slot = (_head + _count) % _columns;
+  if (_count < _columns)
+    _count++;
+  else
+    _head = (_head + 1) % _columns;
+  _primary[slot] = primary;
+  _secondary[slot] = secondary;
+  _strip[slot] = strip;
+}
+
+void Sparkline::push(lgfx::LovyanGFX *gfx, uint32_t primary, uint32_t secondary, uint16_t strip)
+{
+  if (!_columns)
+    return;
+
+  add(primary, secondary, strip);
+  if (_rescale())
+  {
+    draw(gfx);
+    return;
+  }
+
+  // Scroll what is on screen, then fill the column freed on the right
+  int width = _columns * _columnWidth;
+  gfx->copyRect(_x, _y, width - _columnWidth, _h, _x + _columnWidth, _y);
+  _drawColumn(gfx, _count - 1);
+}
+
+void Sparkline::draw(lgfx::LovyanGFX *gfx)
+{
+  if (!_columns)
+    return;
+
+  _rescale();
+  gfx->fillRect(_x, _y, _columns * _columnWidth, _h, SPARKLINE_BACKGROUND_COLOUR);
+  for (size_t i = 0; i < _count; ++i)
+    _drawColumn(gfx, i);
+}
+
+void Sparkline::_drawColumn(lgfx::LovyanGFX *gfx, size_t index)
+{
+  size_t slot = (_head + index) % _columns;
+  int x = _x + (_columns - _count + index) * _columnWidth;
+  int plotHeight = _h - _stripHeight - 1;
+
+  gfx->fillRect(x, _y, _columnWidth, plotHeight, SPARKLINE_BACKGROUND_COLOUR);
+  int bar = (uint64_t)min(_primary[slot], _scale) * plotHeight / _scale;
+  if (bar)
+    gfx->fillRect(x, _y + plotHeight - bar, _columnWidth, bar, SPARKLINE_PRIMARY_COLOUR);
+  int line = (uint64_t)min(_secondary[slot], _scale) * (plotHeight - 1) / _scale;
+  gfx->fillRect(x, _y + plotHeight - 1 - line, _columnWidth, 1, SPARKLINE_SECONDARY_COLOUR);
+
+  if (_stripHeight)
+    gfx->fillRect(x, _y + _h - _stripHeight, _columnWidth, _stripHeight, _strip[slot]);
+}
+
+bool Sparkline::_rescale()
+{
+  uint32_t peak = 1;
+  for (size_t i = 0; i < _count; ++i)
+  {
+    size_t slot = (_head + i) % _columns;
+    peak = max(peak, max(_primary[slot], _secondary[slot]));
+  }
+
+  // Grow as soon as a value doesn't fit, but only shrink once the peak has fallen well below the scale,
+  // so a graph hovering around a step isn't drawn afresh on every value
+  uint32_t scale = niceCeiling(peak);
+  if (scale > _scale || scale * 4 <= _scale)
+  {
+    _scale = scale;
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file  Sparkline.h
+ * @brief Scrolling throughput graph with a signal strip, drawn a column at a time
+ */
+
+#ifndef _STARLINKFOB_SPARKLINE_H_
+#define _STARLINKFOB_SPARKLINE_H_
+
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <M5GFX.h>
+
+/// @brief Largest number of columns a sparkline keeps, enough for the full LCD width at one pixel per column
+#define SPARKLINE_MAX_COLUMNS   240
+
+/// @brief Graph of two series, e.g. download filled in and upload as a line over it, above a strip of colours,
+/// e.g. signal level. Columns scroll in from the right.
+/// A new column shifts the pixels already drawn rather than drawing them again, so only one column is drawn
+/// per value, unless the scale has to change to fit the values shown
+class Sparkline
+{
+public:
+    Sparkline();
+
+    /// @brief Set where the graph is drawn and forget its values. Nothing is drawn if \a h is too small
+    /// @param columnWidth Width in pixels of each value
+    /// @param stripHeight Height in pixels of the colour strip along the bottom. 0 for none
+    void place(int x, int y, int w, int h, int columnWidth = 2, int stripHeight = 3);
+
+    /// @brief Return whether the graph is placed at \a y with height \a h
+    bool placedAt(int y, int h) const { return _y == y && _h == h; }
+
+    /// @brief Add a column without drawing it, e.g. to fill the graph from history before the first draw()
+    void add(uint32_t primary, uint32_t secondary, uint16_t strip);
+
+    /// @brief Add a column and draw it, scrolling the graph one column left
+    void push(lgfx::LovyanGFX *gfx, uint32_t primary, uint32_t secondary, uint16_t strip);
+
+    /// @brief Draw every column afresh
+    void draw(lgfx::LovyanGFX *gfx);
+
+    /// @brief Return the value the top of the graph stands for
+    uint32_t scale() const { return _scale; }
+
+private:
+    /// @brief Draw the column holding the \a index-th oldest value
+    void _drawColumn(lgfx::LovyanGFX *gfx, size_t index);
+
+    /// @brief Pick a scale fitting the values kept
+    /// @return true if it differs from the current one
+    bool _rescale();
+
+    uint32_t _primary[SPARKLINE_MAX_COLUMNS];
+    uint32_t _secondary[SPARKLINE_MAX_COLUMNS];
+    uint16_t _strip[SPARKLINE_MAX_COLUMNS];
+    size_t _head;           // Slot of the oldest value
+    size_t _count;          // Values kept, at most the number of columns that fit
+    size_t _columns;
+    int _x, _y, _w, _h;
+    int _columnWidth;
+    int _stripHeight;
+    uint32_t _scale;
+};
+
+#endif
@@ -0,0 +1,263 @@
+#include "WanHistory.h"
+#include "config.h"
+
+#define WAN_HISTORY_SAMPLES_PER_MINUTE (60000 / WAN_HISTORY_SAMPLE_MS)
+
+static_assert(60000 % WAN_HISTORY_SAMPLE_MS == 0, "WAN_HISTORY_SAMPLE_MS must divide a minute");
+static_assert(WAN_HISTORY_RECENT_SLOTS >= WAN_HISTORY_SAMPLES_PER_MINUTE, "The recent history must hold a minute");
+static_assert(WAN_HISTORY_MINUTE_SLOTS >= 60, "The minute history must hold an hour");
+
+/// @brief Number of sample periods after which every slot of every tier has been overwritten
+#define WAN_HISTORY_SPAN_PERIODS ((uint32_t)WAN_HISTORY_HOUR_SLOTS * 60 * WAN_HISTORY_SAMPLES_PER_MINUTE)
+
+/// @brief Average the \a count slots of \a ring ending at slot number \a last into one coarser slot
+static WanHistory_Slot mergeSlots(const WanHistory_Slot *ring, size_t size, uint32_t last, size_t count)
+{
+  uint64_t download = 0, upload = 0;
+  int32_t signal = 0;
+  uint32_t trafficSlots = 0, statusSlots = 0;
+  WanHistory_Slot merged = {};
+  for (size_t i = 0; i < count; ++i)
+  {
+    const WanHistory_Slot &slot = ring[(last - i) % size];
+    if (slot.trafficSamples)
+    {
+      download += slot.downloadKbps;
+      upload += slot.uploadKbps;
+      trafficSlots++;
+    }
+    if (slot.statusSamples)
+    {
+      signal += slot.signal;
+      statusSlots++;
+    }
+    if (slot.led > merged.led)
+      merged.led = slot.led;
+  }
+
+  merged.trafficSamples = trafficSlots;
+  merged.statusSamples = statusSlots;
+  if (trafficSlots)
+  {
+    merged.downloadKbps = download / trafficSlots;
+    merged.uploadKbps = upload / trafficSlots;
+  }
+  merged.signal = statusSlots ? signal / (int32_t)statusSlots : -1;
+  return merged;
+}
+
+WanHistory::WanHistory()
+{
+  _lock = xSemaphoreCreateMutex();
+  _period = 0;
+  memset(_wans, 0, sizeof(_wans));
+}
+
+void WanHistory::record(const PeplinkAPI_WANTable &wans, uint8_t parts)
+{
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _advance();
+  for (const PeplinkAPI_WAN &wan : wans)
+  {
+    WanHistory_Wan *history = _find(wan.id);
+    if (!history)
+    {
+      // Take a free history, or else the one of the WAN listed longest ago
+      history = &_wans[0];
+      for (WanHistory_Wan &candidate : _wans)
+      {
+        if (!candidate.id)
+        {
+          history = &candidate;
+          break;
+        }
+        if (candidate.lastSeen < history->lastSeen)
+          history = &candidate;
+      }
+      memset(history, 0, sizeof(*history));
+      history->id = wan.id;
+    }
+    history->lastSeen = _period;
+
+    if ((parts & PEPLINKAPI_STATE_WAN_TRAFFIC) && history->trafficSamples < UINT8_MAX)
+    {
+      history->downloadSum += kbps(wan.download, wan.unit);
+      history->uploadSum += kbps(wan.upload, wan.unit);
+      history->trafficSamples++;
+    }
+    if ((parts & PEPLINKAPI_STATE_WAN_STATUS) && history->statusSamples < UINT8_MAX)
+    {
+      if (wan.type == PEPLINKAPI_WAN_TYPE_CELLULAR)
+        history->signalSum += wan.cellular.signalLevel;
+      else if (wan.type == PEPLINKAPI_WAN_TYPE_WIFI)
+        history->signalSum += wan.wifi.strength;
+      else
+        history->signalSum += -1;
+      uint8_t colour = led(wan.statusLED);
+      if (colour > history->led)
+        history->led = colour;
+      history->statusSamples++;
+    }
+  }
+  xSemaphoreGive(_lock);
+}
+
+size_t WanHistory::read(int id, WanHistory_Tier_t tier, WanHistory_Slot *slots, size_t maxSlots)
+{
+  if (tier >= WAN_HISTORY_TIER_COUNT)
+    return 0;
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _advance();
+  WanHistory_Wan *history = _find(id);
+  if (!history)
+  {
+    xSemaphoreGive(_lock);
+    return 0;
+  }
+
+  const WanHistory_Slot *ring;
+  uint32_t closed;      // Number of slots of the tier that have ended since boot
+  if (tier == WAN_HISTORY_RECENT)
+  {
+    ring = history->recent;
+    closed = _period;
+  }
+  else if (tier == WAN_HISTORY_MINUTES)
+  {
+    ring = history->minutes;
+    closed = _period / WAN_HISTORY_SAMPLES_PER_MINUTE;
+  }
+  else
+  {
+    ring = history->hours;
+    closed = _period / (60 * WAN_HISTORY_SAMPLES_PER_MINUTE);
+  }
+
+  size_t size = capacity(tier);
+  size_t count = min(size, maxSlots);
+  for (size_t i = 0; i < count; ++i)
+  {
+    // Slots from before boot are gaps
+    size_t age = count - i;
+    if (age > closed)
+      memset(&slots[i], 0, sizeof(slots[i]));
+    else
+      slots[i] = ring[(closed - age) % size];
+  }
+  xSemaphoreGive(_lock);
+  return count;
+}
+
+uint32_t WanHistory::kbps(long value, const char *unit)
+{
+  if (value <= 0)
+    return 0;
+  switch (tolower(unit[0]))
+  {
+  case 'g': return value * 1000000UL;
+  case 'm': return value * 1000UL;
+  case 'b': return value / 1000;
+  default:  return value;
+  }
+}
+
+uint8_t WanHistory::led(const char *statusLED)
+{
+  if (!strcmp(statusLED, "green"))
+    return WAN_HISTORY_LED_GREEN;
+  if (!strcmp(statusLED, "yellow") || !strcmp(statusLED, "orange"))
+    return WAN_HISTORY_LED_YELLOW;
+  if (!strcmp(statusLED, "red"))
+    return WAN_HISTORY_LED_RED;
+  return WAN_HISTORY_LED_NONE;
+}
+
+uint32_t WanHistory::period(WanHistory_Tier_t tier)
+{
+  switch (tier)
+  {
+  case WAN_HISTORY_RECENT: return WAN_HISTORY_SAMPLE_MS;
+  case WAN_HISTORY_MINUTES: return 60000;
+  case WAN_HISTORY_HOURS: return 3600000;
+  default: return 0;
+  }
+}
+
+size_t WanHistory::capacity(WanHistory_Tier_t tier)
+{
+  switch (tier)
+  {
+  case WAN_HISTORY_RECENT: return WAN_HISTORY_RECENT_SLOTS;
+  case WAN_HISTORY_MINUTES: return WAN_HISTORY_MINUTE_SLOTS;
+  case WAN_HISTORY_HOURS: return WAN_HISTORY_HOUR_SLOTS;
+  default: return 0;
+  }
+}
+
+void WanHistory::_advance()
+{
+  uint32_t now = millis() / WAN_HISTORY_SAMPLE_MS;
+  if (now - _period > WAN_HISTORY_SPAN_PERIODS)
+  {
+    // Nothing was read for longer than the history covers, so every slot would be a gap anyway
+    for (WanHistory_Wan &wan : _wans)
+    {
+      int id = wan.id;
+      memset(&wan, 0, sizeof(wan));
+      wan.id = id;
+      wan.lastSeen = now;
+    }
+    _period = now;
+    return;
+  }
+
+  for (; _period < now; ++_period)
+    for (WanHistory_Wan &wan : _wans)
+      if (wan.id)
+        _close(wan, _period);
+}
+
+void WanHistory::_close(WanHistory_Wan &wan, uint32_t period)
+{
+  WanHistory_Slot &slot = wan.recent[period % WAN_HISTORY_RECENT_SLOTS];
+  memset(&slot, 0, sizeof(slot));
+  slot.trafficSamples = wan.trafficSamples;
+  slot.statusSamples = wan.statusSamples;
+  slot.led = wan.led;
+  slot.signal = -1;
+  if (wan.trafficSamples)
+  {
+    slot.downloadKbps = wan.downloadSum / wan.trafficSamples;
+    slot.uploadKbps = wan.uploadSum / wan.trafficSamples;
+  }
+  if (wan.statusSamples)
+    slot.signal = wan.signalSum / (int32_t)wan.statusSamples;
+
+  wan.downloadSum = 0;
+  wan.uploadSum = 0;
+  wan.signalSum = 0;
+  wan.led = WAN_HISTORY_LED_NONE;
+  wan.trafficSamples = 0;
+  wan.statusSamples = 0;
+
+  // Cascade into the coarser tiers as each minute and hour ends
+  if ((period + 1) % WAN_HISTORY_SAMPLES_PER_MINUTE)
+    return;
+  uint32_t minute = period / WAN_HISTORY_SAMPLES_PER_MINUTE;
+  wan.minutes[minute % WAN_HISTORY_MINUTE_SLOTS] =
+    mergeSlots(wan.recent, WAN_HISTORY_RECENT_SLOTS, period, WAN_HISTORY_SAMPLES_PER_MINUTE);
+
+  if ((minute + 1) % 60)
+    return;
+  uint32_t hour = minute / 60;
+  wan.hours[hour % WAN_HISTORY_HOUR_SLOTS] = mergeSlots(wan.minutes, WAN_HISTORY_MINUTE_SLOTS, minute, 60);
+}
+
+WanHistory_Wan *WanHistory::_find(int id)
+{
+  for (WanHistory_Wan &wan : _wans)
+    if (wan.id && wan.id == id)
+      return &wan;
+  return NULL;
+}
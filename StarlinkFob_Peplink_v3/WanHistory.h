@@ -0,0 +1,107 @@
+/**
+ * @file  WanHistory.h
+ * @brief Fixed-size history of the bandwidth, signal and status of each router WAN
+ */
+
+#ifndef _STARLINKFOB_WANHISTORY_H_
+#define _STARLINKFOB_WANHISTORY_H_
+
+#include <stdint.h>
+
+#include <Arduino.h>
+#include <freertos/semphr.h>
+
+#include "PeplinkAPI.h"
+#include "config.h"
+
+/// @brief Resolutions the history is kept at, finest first
+typedef enum
+{
+    WAN_HISTORY_RECENT = 0,     // WAN_HISTORY_SAMPLE_MS slots
+    WAN_HISTORY_MINUTES,        // One-minute slots
+    WAN_HISTORY_HOURS,          // One-hour slots
+    WAN_HISTORY_TIER_COUNT
+} WanHistory_Tier_t;
+
+/// @brief Status LED colours, ordered by severity so a slot can keep the worst seen
+typedef enum
+{
+    WAN_HISTORY_LED_NONE = 0,   // Grey, off or not reported
+    WAN_HISTORY_LED_GREEN,
+    WAN_HISTORY_LED_YELLOW,
+    WAN_HISTORY_LED_RED,
+} WanHistory_Led_t;
+
+/// @brief Readings of a WAN averaged over one slot. Only the position in the tier says when the slot was
+typedef struct
+{
+    uint32_t downloadKbps;
+    uint32_t uploadKbps;
+    int8_t signal;          // Cellular signal level or Wi-Fi strength. -1 for wired WANs
+    uint8_t led;            // Worst WanHistory_Led_t seen
+    uint8_t trafficSamples; // Bandwidth readings averaged. The slot is a gap if neither kind of reading was taken
+    uint8_t statusSamples;  // Signal and status LED readings averaged
+} WanHistory_Slot;
+
+/// @brief History of one WAN, one ring of slots per tier
+typedef struct
+{
+    int id;                 // Router-assigned WAN ID. 0 if unused
+    uint32_t lastSeen;      // Sample period in which the WAN was last listed
+    uint32_t downloadSum;   // Readings taken so far in the current sample period
+    uint32_t uploadSum;
+    int32_t signalSum;
+    uint8_t led;
+    uint8_t trafficSamples;
+    uint8_t statusSamples;
+    WanHistory_Slot recent[WAN_HISTORY_RECENT_SLOTS];
+    WanHistory_Slot minutes[WAN_HISTORY_MINUTE_SLOTS];
+    WanHistory_Slot hours[WAN_HISTORY_HOUR_SLOTS];
+} WanHistory_Wan;
+
+/// @brief Keeps the WAN readings of the router cache as three rings per WAN: recent samples,
+/// minutes averaged from them, and hours averaged from the minutes.
+/// Every ring advances on the same clock, so slot i of a tier is the same time for all WANs
+/// and no timestamp is stored per slot
+class WanHistory
+{
+public:
+    WanHistory();
+
+    /// @brief Add a reading of every listed WAN to the current sample period
+    /// @param parts PeplinkAPI_StatePart_t bits of the WAN parts \a wans was just fetched for
+    void record(const PeplinkAPI_WANTable &wans, uint8_t parts);
+
+    /// @brief Copy the history of WAN \a id at resolution \a tier into \a slots, oldest first.
+    /// The newest slot is the last period to have ended
+    /// @return Number of slots copied. 0 if the WAN has no history
+    size_t read(int id, WanHistory_Tier_t tier, WanHistory_Slot *slots, size_t maxSlots);
+
+    /// @brief Convert a bandwidth reading in the router's \a unit to kbps
+    static uint32_t kbps(long value, const char *unit);
+
+    /// @brief Convert a status LED colour reported by the router to a WanHistory_Led_t
+    static uint8_t led(const char *statusLED);
+
+    /// @brief Return the millisecond period of each slot of \a tier
+    static uint32_t period(WanHistory_Tier_t tier);
+
+    /// @brief Return the number of slots kept for \a tier
+    static size_t capacity(WanHistory_Tier_t tier);
+
+private:
+    /// @brief Close every sample period that has ended, cascading into the coarser tiers. Must be called with the history held
+    void _advance();
+
+    /// @brief Close sample period \a period of \a wan
+    void _close(WanHistory_Wan &wan, uint32_t period);
+
+    /// @brief Return the history of WAN \a id, or NULL. Must be called with the history held
+    WanHistory_Wan *_find(int id);
+
+    SemaphoreHandle_t _lock;
+    uint32_t _period;           // Number of the current sample period since boot
+    WanHistory_Wan _wans[WAN_HISTORY_MAX_WANS];
+};
+
+#endif
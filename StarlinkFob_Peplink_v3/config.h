@@ -1,112 +1,254 @@
-/**
- * @file config.h
- * @brief Contains compile-time known definitions that override the functionality of the device
- */
-
-#ifndef _PEPLINK_ESP32_CONF_H_
-#define _PEPLINK_ESP32_CONF_H_
-
-#include <Arduino.h>
-#include "PeplinkAPI.h"
-#include "TZ.h"         // Contains timezone definitions Source: https://github.com/esp8266/Arduino/blob/master/cores/esp8266/TZ.h
-
-// Uncomment the following line to enable verbose debug logging
-// #define ENABLE_VERBOSE_DEBUG_LOG
-#ifdef ENABLE_VERBOSE_DEBUG_LOG
-#define PEPLINK_DEBUG_LOG
-#define UI_DEBUG_LOG
-#define WEBSERVER_DEBUG_LOG
-#endif
-
-// Uncomment the following line to enable beeping on every button press
-// #define UI_BEEP
-
-// Uncomment to use Logo instead of text on splash screen
-#define USE_LOGO
-
-/// @brief Name used as the Wi-Fi hostname and device name
-#define PEPLINK_FOB_NAME        "PeplinkFob"
-
-/// @brief Name used when creating a new router client
-#define CLIENT_NAME_DEFAULT     "Client1"
-/// @brief Access rights used for a new created client
-#define CLIENT_SCOPE_DEFAULT    CLIENT_SCOPE_READ_WRITE
-
-/// @brief Millisecond duration to wait for Wi-Fi to connect in station mode before timing out
-#define WIFI_TIMEOUT_DEFAULT    300000
-
-/// @brief Maximum length used for Wi-Fi SSID's and WWW host names
-#define NAME_MAX_LEN            32 
-
-/// @brief Maximum length used for passwords 
-#define PASSWORD_MAX_LEN        64
-
-/// @brief Maximum length of an IPV4 address
-#define IPV4_MAX_LEN            16
-
-/// @brief Port used for the device's local HTTP server
-#define HTTP_PORT               80
-
-/// @brief Uncomment this to enable HTTPS
-//#define PEPLINK_USE_HTTPS
-
-#ifdef PEPLINK_USE_HTTPS
-    #define ROUTER_PORT_DEFAULT 8443
-#else
-    #define ROUTER_PORT_DEFAULT 88
-#endif
-
-/// @brief Namespace where router-assigned credentials (cookies and tokens) are stored in NVS
-/// A separate namespace is used since for router-assigned credentials
-/// since they are modified under different conditions from user-defined credentials
-#define COOKIES_NAMESPACE       "cookie-jar"
-
-/// @brief Namespace where user-defined credentials are stored in NVS
-#define PREFERENCES_NAMESPACE   "settings"
-
-/// @brief Namespace where timestamps are stored in NVS
-#define TIMESTAMP_NAMESPACE   "timestamps"
-
-/// @brief Namespace where over-temperature alert logs are stored in NVS
-#define TEMPERATURE_ALERT_NAMESPACE   "alert-log"
-
-#define TEMPERATURE_ALERT_THRESH_F      120.f // Degrees farenheight
-
-/// @brief Define NTP servers for time sync
-#define NTP_SERVER1             "pool.ntp.org"
-#define NTP_SERVER2             "time.nist.gov"
-
-/// @brief Offset from GMT time in seconds
-#define GMT_OFFSET_SEC          (3 * 3600)  
-
-/// @brief Daylight saving time
-#define DAYLIGHT_OFFSET_SEC     0     
-
-/// @brief Timezone definition
-#define TIMEZONE                TZ_America_Chicago
-
-
-/// @brief Define the default text size for the menu system
-///        This also defines the default length of the mennu item main and auxiliary text
-#define TEXT_SIZE_DEFAULT 2
-
-#if (TEXT_SIZE_DEFAULT == 2)
-#define MINU_MAIN_TEXT_LEN 15
-#define MINU_AUX_TEXT_LEN 5
-#define MINU_ITEM_MAX_COUNT 6
-#elif (TEXT_SIZE_DEFAULT == 3)
-#define MINU_MAIN_TEXT_LEN 9
-#define MINU_AUX_TEXT_LEN 3
-#define MINU_ITEM_MAX_COUNT 3
-#else
-#error "TEXT_SIZE_DEFAULT must be defined with a value of either 2 or 3"
-#endif
-
-#define LONG_PRESS_THRESHOLD_MS     300
-#define SHUTDOWN_PRESS_THRESHOLD_MS 1000
-
-#define WIFI_COUNTDOWN_SECONDS      5 * 60
-#define SHUTDOWN_COUNTDOWN_SECONDS  5
-#define REBOOT_COUNTDOWN_SECONDS    5
-
+/**
+ * @file config.h
+ * @brief Contains compile-time known definitions that override the functionality of the device
+ */
+
+#ifndef _PEPLINK_ESP32_CONF_H_
+#define _PEPLINK_ESP32_CONF_H_
+
+#include <Arduino.h>
+#include "TZ.h"         // Contains timezone definitions Source: https://github.com/esp8266/Arduino/blob/master/cores/esp8266/TZ.h
+
+// Uncomment the following line to enable verbose debug logging
+// #define ENABLE_VERBOSE_DEBUG_LOG
+#ifdef ENABLE_VERBOSE_DEBUG_LOG
+#define PEPLINK_DEBUG_LOG
+#define UI_DEBUG_LOG
+#define WEBSERVER_DEBUG_LOG
+#define DNS_DEBUG_LOG
+#endif
+
+// Uncomment the following line to enable beeping on every button press
+// #define UI_BEEP
+
+// Uncomment to use Logo instead of text on splash screen
+#define USE_LOGO
+
+/// @brief Name used as the Wi-Fi hostname and device name
+#define PEPLINK_FOB_NAME        "PeplinkFob"
+
+/// @brief Name used when creating a new router client
+#define CLIENT_NAME_DEFAULT     "Client1"
+/// @brief Access rights used for a new created client
+#define CLIENT_SCOPE_DEFAULT    CLIENT_SCOPE_READ_WRITE
+
+/// @brief Millisecond duration to wait for Wi-Fi to connect in station mode before timing out
+#define WIFI_TIMEOUT_DEFAULT    300000
+
+/// @brief Maximum length used for Wi-Fi SSID's and WWW host names
+#define NAME_MAX_LEN            32 
+
+/// @brief Maximum length used for passwords 
+#define PASSWORD_MAX_LEN        64
+
+/// @brief Maximum length of an IPV4 address
+#define IPV4_MAX_LEN            16
+
+/// @brief Port used for the device's local HTTP server
+#define HTTP_PORT               80
+
+/// @brief Uncomment this to enable HTTPS
+//#define PEPLINK_USE_HTTPS
+
+#ifdef PEPLINK_USE_HTTPS
+    #define ROUTER_PORT_DEFAULT 8443
+#else
+    #define ROUTER_PORT_DEFAULT 88
+#endif
+
+/// @brief Maximum number of router WANs tracked. Any further WANs the router reports are ignored
+#define PEPLINK_MAX_WANS                    8
+
+/// @brief Maximum number of SIM slots tracked per cellular WAN
+#define PEPLINK_MAX_SIMS                    4
+
+/// @brief Number of kept-alive connections held open to the router.
+/// Each HTTPS connection holds a TLS session (~40KB of heap). Every PeplinkRouter request holds the router
+/// for its whole length, so only one connection is ever in use and more would only take up heap
+#define PEPLINK_HTTP_POOL_SIZE              1
+
+/// @brief Millisecond duration after which an unused router connection is closed instead of being reused
+#define PEPLINK_HTTP_IDLE_TIMEOUT_MS        10000
+
+/// @brief Millisecond duration to wait for a free router connection before failing a request
+#define PEPLINK_HTTP_ACQUIRE_TIMEOUT_MS     15000
+
+/// @brief Seconds before the router API access token expires at which it is renewed in the background.
+/// Must exceed the slowest poll interval, so the poller gets to it before requests start failing
+#define PEPLINK_TOKEN_RENEW_MARGIN_S        300
+
+/// @brief Send the requests of a router refresh back-to-back on one connection before reading any response.
+/// Comment out if the router mishandles pipelined requests; the refresh then sends them one by one
+#define PEPLINK_HTTP_PIPELINING
+
+/// @brief Millisecond duration for which the cached WAN status, including SIM cards, is served before asking the router again
+#define ROUTER_CACHE_WAN_STATUS_TTL_MS      5000
+
+/// @brief Millisecond duration for which the cached WAN bandwidth is served before asking the router again
+#define ROUTER_CACHE_WAN_TRAFFIC_TTL_MS     2000
+
+/// @brief Millisecond duration for which the cached router device info is served before asking the router again
+#define ROUTER_CACHE_INFO_TTL_MS            30000
+
+/// @brief Millisecond duration for which the cached router location is served before asking the router again
+#define ROUTER_CACHE_LOCATION_TTL_MS        60000
+
+/// @brief Millisecond duration a page waits for router state that has never been fetched before showing it as unavailable
+#define ROUTER_CACHE_WAIT_TIMEOUT_MS        15000
+
+/// @brief Millisecond interval between router polls while a page shows router data or a WAN has recently changed state
+#define ROUTER_POLL_FAST_MS                 2000
+
+/// @brief Millisecond interval between router polls while nothing is watching and the fob is on external power
+#define ROUTER_POLL_IDLE_MS                 15000
+
+/// @brief Millisecond interval between router polls while nothing is watching and the fob is on battery
+#define ROUTER_POLL_BATTERY_MS              60000
+
+/// @brief Millisecond duration after a WAN changes state during which the router keeps being polled at the fast interval
+#define ROUTER_POLL_FLAP_HOLD_MS            60000
+
+/// @brief Millisecond delay before pinging an unreachable router again. Doubles after each failed ping
+#define ROUTER_CHECK_BACKOFF_MIN_MS         1000
+
+/// @brief Longest millisecond delay between pings of an unreachable router
+#define ROUTER_CHECK_BACKOFF_MAX_MS         60000
+
+/// @brief Millisecond interval at which the connection is looked at between Wi-Fi events,
+/// e.g. to catch the router failing a request or a countdown that held back the reconnect countdown ending
+#define CONNECTION_SUPERVISE_MS             2000
+
+/// @brief Maximum number of tasks notified of router state changes
+#define ROUTER_CACHE_MAX_SUBSCRIBERS        4
+
+/// @brief Number of WANs whose history is kept. WANs beyond this replace the one seen longest ago
+#define WAN_HISTORY_MAX_WANS                4
+
+/// @brief Millisecond period of each slot of the recent WAN history. Must divide a minute.
+/// Readings within a period are averaged, and a period without any leaves a gap
+#define WAN_HISTORY_SAMPLE_MS               15000
+
+/// @brief Number of WAN_HISTORY_SAMPLE_MS slots kept, 10 minutes by default
+#define WAN_HISTORY_RECENT_SLOTS            40
+
+/// @brief Number of one-minute slots kept. At least 60, since each hour slot is averaged from them
+#define WAN_HISTORY_MINUTE_SLOTS            60
+
+/// @brief Number of one-hour slots kept
+#define WAN_HISTORY_HOUR_SLOTS              24
+
+/// @brief Echo requests sent to each network diagnostics target per sweep
+#define NETDIAG_PINGS_PER_TARGET            5
+
+/// @brief Millisecond interval between the rounds of echo requests of a sweep
+#define NETDIAG_PING_INTERVAL_MS            100
+
+/// @brief Millisecond duration replies are waited for after the last round of a sweep
+#define NETDIAG_PING_TIMEOUT_MS             1000
+
+/// @brief Maximum number of targets pinged in one sweep
+#define NETDIAG_MAX_TARGETS                 16
+
+/// @brief Number of host names kept in the DNS cache
+#define DNS_CACHE_SIZE                      8
+
+/// @brief Longest host name the DNS cache holds, including the terminator
+#define DNS_CACHE_HOST_MAX_LEN              64
+
+/// @brief Millisecond duration a resolved address is reused for before the name is looked up again
+#define DNS_CACHE_TTL_MS                    300000
+
+/// @brief Millisecond duration a failed lookup is remembered for, so a dead name isn't looked up on every ping
+#define DNS_CACHE_NEGATIVE_TTL_MS           30000
+
+/// @brief A name read within this many milliseconds of its expiry is looked up again in the background
+#define DNS_CACHE_PREFETCH_MS               60000
+
+/// @brief Millisecond interval at which the link monitor probes every ping target once
+#define LINK_MONITOR_INTERVAL_MS            2000
+
+/// @brief Millisecond duration the link monitor waits for a reply before counting the probe as lost.
+/// Must be shorter than LINK_MONITOR_INTERVAL_MS
+#define LINK_MONITOR_TIMEOUT_MS             1000
+
+/// @brief Millisecond duration of the window the link statistics cover
+#define LINK_MONITOR_WINDOW_MS              300000
+
+/// @brief Number of epochs the window is split into. The window rolls forward one epoch at a time
+#define LINK_MONITOR_EPOCHS                 5
+
+/// @brief Largest number of ping targets the link monitor probes
+#define LINK_MONITOR_MAX_TARGETS            8
+
+/// @brief File holding the event log. SPIFFS is mounted under /spiffs
+#define EVENT_LOG_PATH                      "/spiffs/events.log"
+
+/// @brief Longest event log path, including the terminator
+#define EVENT_LOG_PATH_MAX_LEN              32
+
+/// @brief Number of events kept. Each takes 16 bytes of flash
+#define EVENT_LOG_CAPACITY                  1024
+
+/// @brief Namespace where router-assigned credentials (cookies and tokens) are stored in NVS
+/// A separate namespace is used since for router-assigned credentials
+/// since they are modified under different conditions from user-defined credentials
+#define COOKIES_NAMESPACE       "cookie-jar"
+
+/// @brief Millisecond delay after router credentials last changed before they are written to NVS,
+/// so a login followed by a token grant costs one flash write
+#define CREDENTIAL_FLUSH_DELAY_MS       5000
+
+/// @brief Longest millisecond delay before changed router credentials are written to NVS, however often they change
+#define CREDENTIAL_FLUSH_MAX_DELAY_MS   60000
+
+/// @brief Namespace where user-defined credentials are stored in NVS
+#define PREFERENCES_NAMESPACE   "settings"
+
+#define TEMPERATURE_ALERT_THRESH_F      120.f // Degrees farenheight
+
+/// @brief Define NTP servers for time sync
+#define NTP_SERVER1             "pool.ntp.org"
+#define NTP_SERVER2             "time.nist.gov"
+
+/// @brief Offset from GMT time in seconds
+#define GMT_OFFSET_SEC          (3 * 3600)  
+
+/// @brief Daylight saving time
+#define DAYLIGHT_OFFSET_SEC     0     
+
+/// @brief Timezone definition
+#define TIMEZONE                TZ_America_Chicago
+
+
+/// @brief Define the default text size for the menu system
+///        This also defines the default length of the mennu item main and auxiliary text
+#define TEXT_SIZE_DEFAULT 2
+
+#if (TEXT_SIZE_DEFAULT == 2)
+#define MINU_MAIN_TEXT_LEN 15
+#define MINU_AUX_TEXT_LEN 5
+#define MINU_ITEM_MAX_COUNT 6
+#elif (TEXT_SIZE_DEFAULT == 3)
+#define MINU_MAIN_TEXT_LEN 9
+#define MINU_AUX_TEXT_LEN 3
+#define MINU_ITEM_MAX_COUNT 3
+#else
+#error "TEXT_SIZE_DEFAULT must be defined with a value of either 2 or 3"
+#endif
+
+#define LONG_PRESS_THRESHOLD_MS     300
+#define SHUTDOWN_PRESS_THRESHOLD_MS 1000
+
+/// @brief Time a button pin must be stable after an edge before the edge is believed
+#define BUTTON_DEBOUNCE_MS          30
+
+/// @brief Active-low button pins of the M5StickC Plus2
+#define BUTTON_A_PIN                37
+#define BUTTON_B_PIN                39
+#define BUTTON_C_PIN                35
+
+#define WIFI_COUNTDOWN_SECONDS      5 * 60
+#define SHUTDOWN_COUNTDOWN_SECONDS  5
+#define REBOOT_COUNTDOWN_SECONDS    5
+
 #endif
\ No newline at end of file
@@ -1,3414 +1,3414 @@
-#ifndef _LOGO_1SIMPLECONNECT_H_
-#define _LOGO_1SIMPLECONNECT_H_
-
-#include "stdint.h"
-
-#define LOGO_GREEN 0x7e08
-
-constexpr uint8_t logo[] PROGMEM = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xBD, 0xEF, 0x38, 0xD7, 0xD4, 0xB6, 0x4F, 0x9E, 0x2B, 0x8E, 0x09, 0x7E, 0x08, 0x7E, 
-0x0A, 0x86, 0x4D, 0x96, 0xB2, 0xAE, 0x17, 0xCF, 0x9C, 0xE7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x5A, 0xDF, 
-0x91, 0xA6, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x70, 0x9E, 0x39, 0xD7, 0xDE, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xE7, 0x6F, 0x9E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 
-0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xF5, 0xC6, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0x09, 0x7E, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 
-0x09, 0x7E, 0xD4, 0xBE, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x92, 0xAE, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 
-0x09, 0x86, 0x70, 0xA6, 0xF5, 0xC6, 0x59, 0xDF, 0x9C, 0xE7, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
-0xBD, 0xEF, 0x9B, 0xE7, 0x59, 0xD7, 0xF5, 0xBE, 0x6F, 0x9E, 0xE9, 0x85, 0x08, 0x7E, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x91, 0xA6, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDE, 0xF7, 0x70, 0xA6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x8E, 0xF5, 0xC6, 
-0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0xF6, 0xC6, 0x2C, 0x8E, 
-0x09, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x6F, 0x9E, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xB2, 0xB6, 0x08, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0xD4, 0xBE, 0xDD, 0xEF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 
-0xF5, 0xBE, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x91, 0xAE, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x17, 0xCF, 0xE9, 0x7D, 0x08, 0x7E, 0x0B, 0x8E, 0x79, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0xD5, 0xBE, 0x6F, 0x9E, 0x0B, 0x8E, 0x09, 0x86, 0x0A, 0x86, 
-0x2C, 0x8E, 0x90, 0xA6, 0xF6, 0xC6, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x7A, 0xDF, 0x2D, 0x8E, 0x08, 0x7E, 0xE8, 0x7D, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 
-0x0B, 0x86, 0x08, 0x7E, 0x2C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9B, 0xE7, 0x91, 0xA6, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x91, 0xAE, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x4E, 0x96, 0x08, 0x7E, 0x0A, 0x86, 0x9B, 0xE7, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 
-0x09, 0x7E, 0x2B, 0x86, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0xCF, 
-0x09, 0x86, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xE9, 0x7D, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 0x16, 0xC7, 0xFE, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x2C, 0x8E, 0x08, 0x7E, 0x91, 0xAE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x0A, 0x7E, 
-0xE9, 0x7D, 0x59, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xD4, 0xBE, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xF5, 0xC6, 0x5A, 0xDF, 0x9B, 0xE7, 0xBD, 0xEF, 0xBD, 0xEF, 
-0x9B, 0xE7, 0x5A, 0xDF, 0xF5, 0xC6, 0x4E, 0x96, 0xE9, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0xD4, 0xB6, 
-0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xDF, 0xEA, 0x85, 0x09, 0x7E, 0x9B, 0xE7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 
-0xB4, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF6, 0xC6, 0xE9, 0x7D, 0x08, 0x7E, 
-0x6F, 0x9E, 0x7A, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7A, 0xDF, 0x70, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0xF6, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0xC7, 0x09, 0x7E, 0xB3, 0xB6, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x4F, 0x96, 0x2B, 0x8E, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x09, 0x7E, 0x09, 0x7E, 0xF5, 0xBE, 
-0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xF5, 0xBE, 0x09, 0x7E, 
-0x09, 0x7E, 0x7A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x4E, 0x9E, 0x0B, 0x86, 
-0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xEF, 0xEA, 0x7D, 0x18, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x4F, 0x9E, 0x09, 0x7E, 0x17, 0xCF, 0xFE, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0xCF, 
-0x09, 0x7E, 0x70, 0x9E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xD7, 0x08, 0x7E, 
-0x7B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0x2D, 0x96, 0xDD, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xDF, 0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0xF5, 0xC6, 0x70, 0xA6, 0x2D, 0x96, 0x2D, 0x96, 
-0x90, 0xA6, 0xF5, 0xC6, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xF5, 0xBE, 0x09, 0x7E, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x4E, 0x96, 
-0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xCF, 0x16, 0xC7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xAE, 0x4E, 0x9E, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDE, 0xF7, 0xD5, 0xBE, 0xEA, 0x85, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 0xD4, 0xBE, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDE, 0xF7, 0x6E, 0x9E, 0xB3, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x17, 0xCF, 
-0xF4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC6, 0xDC, 0xEF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x2D, 0x8E, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xF7, 0x70, 0xA6, 0x09, 0x7E, 0x2C, 0x8E, 0xD5, 0xBE, 0x59, 0xDF, 0x7B, 0xE7, 0x7B, 0xE7, 
-0x59, 0xDF, 0xF5, 0xBE, 0x2D, 0x96, 0x08, 0x7E, 0x4F, 0x9E, 0xDD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x7A, 0xDF, 0x2D, 0x96, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 
-0xB4, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x71, 0xA6, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x92, 0xAE, 0x0A, 0x7E, 0x16, 0xC7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x17, 0xC7, 0x0A, 0x86, 0x71, 0xAE, 0xFE, 0xF7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x71, 0xA6, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0x59, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 
-0xEA, 0x85, 0x79, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xDF, 0x0A, 0x86, 0x59, 0xD7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xDF, 0x7B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xA6, 
-0x18, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x58, 0xD7, 0x4F, 0x9E, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x9C, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 
-0x7A, 0xDF, 0x17, 0xCF, 0xD5, 0xBE, 0xD3, 0xB6, 0xB2, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
-0x92, 0xAE, 0x92, 0xAE, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 0x71, 0xA6, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xAE, 0xDC, 0xEF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0xF6, 0xC6, 0x4F, 0x9E, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 0x5A, 0xDF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x7A, 0xDF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDE, 0xFF, 0x59, 0xD7, 0x70, 0xA6, 0xE9, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7B, 0xEF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x7A, 0xDF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xD4, 0xB6, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE7, 0x4E, 0x9E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xDF, 0x2C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x38, 0xD7, 0xD5, 0xBE, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xF5, 0xC6, 0xFF, 0xFF, 0xBC, 0xEF, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0x59, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x7A, 0xE7, 0x17, 0xCF, 0xD5, 0xBE, 0xD4, 0xB6, 
-0xF5, 0xBE, 0x38, 0xCF, 0xBB, 0xEF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x9C, 0xE7, 0x38, 0xCF, 0xF5, 0xBE, 0xD4, 0xBE, 0xD4, 0xBE, 0x17, 0xCF, 0x7A, 0xDF, 
-0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xBD, 0xEF, 0xB4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD5, 0xBE, 0x37, 0xCF, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xDF, 0xD3, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xB4, 0xB6, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDD, 0xF7, 
-0x59, 0xDF, 0xF6, 0xC6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
-0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x0B, 0x86, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0xB2, 0xAE, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4E, 0x96, 0xFE, 0xFF, 0x9B, 0xDF, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xF7, 0x17, 0xCF, 0x2C, 0x8E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x4F, 0x9E, 0x79, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 
-0x70, 0x9E, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 
-0x2C, 0x8E, 0x16, 0xC7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x4F, 0x9E, 0x79, 0xDF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x09, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x08, 0x7E, 0x9A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xF6, 0xC6, 0x0B, 0x86, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4F, 0x96, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xBC, 0xEF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x85, 0xD4, 0xBE, 0xF5, 0xBE, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x9E, 0xBB, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9C, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xF5, 0xBE, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xEF, 0x6F, 0x9E, 0xE9, 0x7D, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDD, 0xEF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x7B, 0xDF, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4F, 0x96, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 
-0x2C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x2C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9C, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x4F, 0x9E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x92, 0xAE, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xF7, 0x2D, 0x96, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 0x9B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x4E, 0x96, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0xDD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9C, 0xEF, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE9, 0x7D, 0x59, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x09, 0x76, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x39, 0xD7, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x16, 0xC7, 0x08, 0x7E, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4E, 0x96, 0xFE, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xBE, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD4, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9C, 0xE7, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x2D, 0x96, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xE7, 0xE9, 0x85, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0xE8, 0x7D, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 
-0x2D, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x37, 0xCF, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 
-0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 
-0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x58, 0xD7, 0x90, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 
-0x4E, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x0B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x51, 0xA6, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x0A, 0x86, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x0A, 0x86, 0x0B, 0x8E, 
-0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2B, 0x86, 0x09, 0x86, 0xE8, 0x7D, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 0xBC, 0xEF, 0xFF, 0xFF, 
-0x9C, 0xEF, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x0C, 0x8E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE8, 0x7D, 0x08, 0x7E, 0x58, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0x0A, 0x86, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x0B, 0x8E, 0x9C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0xCF, 
-0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 
-0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 0x79, 0xDF, 
-0xFE, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xCF, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xF5, 0xC6, 0xDD, 0xF7, 0xFE, 0xF7, 
-0x9B, 0xE7, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 0x9B, 0xDF, 0xFE, 0xF7, 0xDD, 0xF7, 0x16, 0xCF, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x16, 0xC7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xF7, 0xBC, 0xEF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD3, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xA6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0xD5, 0xBE, 0xFD, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x2D, 0x8E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 
-0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xB3, 0xB6, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x09, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDD, 0xEF, 0x2D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x2D, 0x8E, 0xDC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x16, 0xC7, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x92, 0xAE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9B, 0xE7, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x0B, 0x86, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 
-0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xB2, 0xAE, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x9E, 0x09, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x0A, 0x7E, 0xDC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x16, 0xC7, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 
-0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x9E, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x0A, 0x86, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xAE, 0xE9, 0x7D, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 
-0x09, 0x86, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x85, 0x37, 0xCF, 
-0xBC, 0xEF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9A, 0xDF, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x71, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xA6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0xB3, 0xB6, 0xBC, 0xEF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFF, 0xFF, 0xDD, 0xF7, 0x0A, 0x86, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x0B, 0x8E, 0x70, 0xA6, 0x37, 0xCF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xDC, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
-0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
-0xDD, 0xEF, 0xDC, 0xEF, 0x79, 0xDF, 0x2D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0xE9, 0x85, 0x9B, 0xE7, 0x7A, 0xDF, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
-0x37, 0xCF, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x79, 0xDF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE9, 0x7D, 0xE9, 0x7D, 0xE8, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 
-0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 
-0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0x5A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0x16, 0xC7, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDE, 0xF7, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xEA, 0x85, 0x38, 0xD7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0x08, 0x7E, 0x4E, 0x96, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xBE, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xB2, 0xAE, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x9B, 0xE7, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 
-0x9B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE9, 0x85, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0xE8, 0x7D, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0x2D, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x4E, 0x9E, 0xFE, 0xF7, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0x16, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x4D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x4C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0xD5, 0xBE, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x59, 0xDF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x09, 0x7E, 0x0A, 0x86, 0x37, 0xCF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xBB, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0xBB, 0xE7, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDD, 0xF7, 0x5A, 0xDF, 0x17, 0xCF, 
-0xF6, 0xC6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0xF4, 0xBE, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x0A, 0x7E, 0xB2, 0xB6, 0x9C, 0xE7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x0C, 0x8E, 0xF4, 0xBE, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0xF6, 0xC6, 0xBD, 0xF7, 0x2A, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0x4F, 0x9E, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x70, 0x9E, 
-0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 
-0x16, 0xCF, 0x17, 0xCF, 0x17, 0xCF, 0x7A, 0xDF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE9, 0x7D, 0x9B, 0xE7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4F, 0x9E, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x2C, 0x8E, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x09, 0x7E, 0x9A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBD, 0xEF, 
-0xF6, 0xC6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0xF6, 0xC6, 0xD5, 0xBE, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0x7A, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xB3, 0xB6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0xF6, 0xC6, 0xF6, 0xC6, 0x7A, 0xE7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x0C, 0x8E, 0xF5, 0xBE, 0xF6, 0xC6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
-0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0xF6, 0xC6, 0xBD, 0xEF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
-0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 
-0x09, 0x7E, 0x79, 0xDF, 0xFF, 0xFF, 0x9B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 
-0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
-0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x4F, 0x9E, 0xFE, 0xF7, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
-0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
-0x9B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
-0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 0x39, 0xD7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x38, 0xD7, 0x09, 0x86, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
-0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x7A, 0xDF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x38, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
-0x9B, 0xE7, 0xE8, 0x7D, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0x2C, 0x96, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
-0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0xE9, 0x7D, 0x0B, 0x8E, 0x6F, 0xA6, 0x37, 0xCF, 0xDE, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xDF, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0xE8, 0x7D, 0x08, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0xEC, 0x8D, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xD7, 0xE8, 0x7D, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x37, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0x0D, 0x8E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x2E, 0x96, 0xFE, 0xF7, 
-0x9B, 0xE7, 0xE9, 0x7D, 0xE9, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0xD4, 0xBE, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0xE9, 0x7D, 0x08, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x17, 0xCF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0x17, 0xCF, 
-0x6F, 0xA6, 0x0A, 0x86, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
-0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0x9B, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xDD, 0xEF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
-0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFE, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 0x97, 0xF6, 
-0x13, 0xF6, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 
-0xB1, 0xF5, 0xB1, 0xF5, 0xD2, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x96, 0xF6, 0xF2, 0xF5, 0x91, 0xF5, 
-0xB1, 0xF5, 0x55, 0xF6, 0x3A, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9C, 0xF7, 0x19, 0xF7, 0xB8, 0xF6, 0xB7, 0xF6, 0xD8, 0xF6, 
-0x3A, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x5B, 0xF7, 0xD9, 0xF6, 0xB7, 0xF6, 0xB8, 0xF6, 
-0xF9, 0xF6, 0x7B, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
-0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x70, 0xED, 0x44, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xDF, 0xFF, 0xF9, 0xF6, 0x2D, 0xF5, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xCA, 0xEC, 0x96, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDE, 0xFF, 0xB7, 0xF6, 0x2C, 0xED, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0x88, 0xEC, 0xD2, 0xED, 0x5B, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xF7, 0x7C, 0xF7, 0xF3, 0xF5, 0x88, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x0C, 0xED, 0x76, 0xF6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDE, 0xFF, 0xD7, 0xF6, 0xB1, 0xF5, 0xCB, 0xF4, 0x88, 0xF4, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
-0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x87, 0xEC, 
-0x2D, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xDE, 0xFF, 0xF8, 0xF6, 0xF2, 0xF5, 0x0C, 0xF5, 0xA9, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
-0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x87, 0xF4, 0x7C, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xF6, 0x87, 0xEC, 0x87, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
-0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
-0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x76, 0xF6, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xBD, 0xFF, 0xD1, 0xED, 0x44, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x2E, 0xED, 0x7B, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 
-0x0C, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x34, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF7, 
-0x55, 0xF6, 0x67, 0xEC, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xEC, 0xEC, 0x3A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xFF, 
-0x2D, 0xED, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xF8, 0xF6, 0xEB, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBE, 0xFF, 
-0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xAA, 0xEC, 0x7B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x67, 0xEC, 
-0x23, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x23, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x8F, 0xED, 0xBD, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xB1, 0xF5, 
-0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xF4, 0xD7, 0xF6, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xEC, 0xEC, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x13, 0xF6, 
-0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x19, 0xF7, 0x45, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 
-0x45, 0xF4, 0x44, 0xF4, 0xAA, 0xE4, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xF5, 
-0x44, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xEC, 0xEC, 
-0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x67, 0xEC, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xF5, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x44, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 
-0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x19, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEE, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x34, 0xF6, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x7C, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDE, 0xFF, 0xEC, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xEC, 0xD2, 0xF5, 
-0x19, 0xF7, 0x9C, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 
-0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0xA9, 0xEC, 0x75, 0xF6, 0x5B, 0xF7, 0xBD, 0xFF, 
-0x9C, 0xF7, 0xB7, 0xF6, 0x0C, 0xED, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 
-0x14, 0xEE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xCB, 0xEC, 0x23, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 0x4E, 0xED, 0x13, 0xF6, 0x34, 0xF6, 0xD2, 0xF5, 
-0xA9, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x97, 0xF6, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF6, 0x24, 0xF4, 0x23, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x89, 0xF4, 0xD1, 0xF5, 0x55, 0xF6, 0x14, 0xF6, 
-0x4F, 0xF5, 0x46, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0xAA, 0xEC, 
-0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x88, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x0D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 
-0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 
-0xB1, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x45, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0xEC, 0xF4, 0x2D, 0xF5, 0x2D, 0xF5, 
-0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2E, 0xED, 0x9B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x2E, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 
-0x2D, 0xF5, 0x0D, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x67, 0xF4, 0x2E, 0xF5, 
-0x2E, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x19, 0xF7, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xF4, 0xF8, 0xF6, 0xFF, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xEB, 0xEC, 0x24, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x4F, 0xED, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xF3, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x46, 0xF4, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x44, 0xF4, 0x0D, 0xF5, 0x5A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDD, 0xFF, 0x75, 0xEE, 0x45, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0xA9, 0xEC, 
-0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xEB, 0xEC, 0x24, 0xF4, 0x44, 0xEC, 
-0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x34, 0xF6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x7B, 0xF7, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x34, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x45, 0xEC, 0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x2D, 0xF5, 0x23, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0x24, 0xF4, 0x67, 0xF4, 0x76, 0xF6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xED, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x54, 0xF6, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0xCA, 0xEC, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x90, 0xED, 0x23, 0xF4, 0x44, 0xEC, 0x23, 0xF4, 
-0x24, 0xF4, 0x76, 0xF6, 0xFF, 0xFF, 0xFE, 0xFF, 0x0D, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x0C, 0xF5, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xF8, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0x76, 0xEE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 
-0xAA, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0xA9, 0xEC, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x23, 0xF4, 0x46, 0xF4, 0x19, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xF7, 
-0xC9, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x88, 0xEC, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0xB7, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x45, 0xF4, 0x44, 0xEC, 0x23, 0xF4, 
-0x24, 0xF4, 0x4F, 0xF5, 0xFF, 0xFF, 0xBC, 0xFF, 0x45, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x44, 0xEC, 0x1A, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x6F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x13, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x55, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x43, 0xF4, 0x2D, 0xED, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x45, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xB6, 0xF6, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x55, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x34, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 
-0x45, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x6F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x45, 0xEC, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEB, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x89, 0xEC, 0xDE, 0xFF, 0x5B, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xA9, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x75, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEC, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 0x45, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xA9, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 
-0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 
-0x4F, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x6F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 
-0x45, 0xF4, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xF7, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x13, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xF5, 0x23, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xA8, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x45, 0xF4, 0xDE, 0xFF, 0x3A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x4E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0x96, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xB1, 0xED, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xAA, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x17, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 
-0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xB1, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x87, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x66, 0xEC, 0xDE, 0xFF, 0x3A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x44, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x67, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x4D, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0x38, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
-0x67, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xCB, 0xF4, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x44, 0xF4, 0x3A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x67, 0xEC, 0x44, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x0C, 0xF5, 0xFE, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x90, 0xED, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xCB, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xCA, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x09, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x4F, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xB8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x43, 0xF4, 0xB1, 0xF5, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xF6, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF3, 0xED, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7C, 0xF7, 0x45, 0xEC, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x46, 0xEC, 0x2D, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 
-0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 
-0xD2, 0xED, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x90, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0x5B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x0A, 0x86, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x76, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x0C, 0xED, 0xBE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x66, 0xEC, 0x24, 0xF4, 
-0x44, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x67, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x45, 0xEC, 0x18, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x76, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0xF3, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x9C, 0xFF, 0x67, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2E, 0xF5, 0x5A, 0xF7, 
-0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD1, 0xED, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x45, 0xEC, 0x13, 0xF6, 0x9D, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBE, 0xFF, 0x96, 0xF6, 0x68, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x2D, 0xED, 0xDE, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0xA9, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x5B, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x45, 0xF4, 0xF8, 0xF6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0x34, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x25, 0xF4, 
-0x0D, 0xED, 0xD1, 0xF5, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 
-0xF2, 0xED, 0xF2, 0xF5, 0x13, 0xEE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xFF, 0xA8, 0xEC, 
-0x24, 0xF4, 0x43, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x87, 0xEC, 0x6F, 0xF5, 0xD2, 0xED, 
-0x90, 0xED, 0x88, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 
-0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xB6, 0xF6, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x13, 0xF6, 0x7B, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x09, 0x7E, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDE, 0xFF, 0x0D, 0xF5, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 
-0x45, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xEC, 0x55, 0xF6, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x88, 0xEC, 0x24, 0xF4, 
-0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x89, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 
-0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xEC, 
-0x4E, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x46, 0xF4, 0x44, 0xF4, 
-0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x45, 0xF4, 0x88, 0xEC, 0xAA, 0xEC, 0xCA, 0xF4, 
-0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xEC, 0xCA, 0xEC, 0x7B, 0xF7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x92, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 0x0C, 0xF5, 0x24, 0xF4, 0x44, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
-0xF8, 0xF6, 0x67, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xEC, 0x23, 0xF4, 0x45, 0xEC, 0x54, 0xF6, 0xDE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x34, 0xF6, 0x24, 0xF4, 
-0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x96, 0xF6, 0x44, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xD2, 0xF5, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFE, 0xFF, 0x7B, 0xF7, 0x4F, 0xED, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0xEC, 0xEC, 0x19, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x0C, 0xED, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x75, 0xF6, 
-0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x91, 0xA6, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xFF, 0x34, 0xF6, 0x0C, 0xED, 
-0x67, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x44, 0xEC, 0x44, 0xEC, 0x44, 0xEC, 0x44, 0xEC, 
-0x44, 0xEC, 0x24, 0xF4, 0x89, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x1A, 0xF7, 0xF3, 0xF5, 0xEB, 0xEC, 0x45, 0xF4, 0x24, 0xF4, 
-0x44, 0xF4, 0xA9, 0xEC, 0xB1, 0xF5, 0xF8, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x6E, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x96, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xED, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xFF, 
-0x6F, 0xED, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0x39, 0xF7, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
-0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFE, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x2B, 0x86, 
-0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 
-0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xB3, 0xB6, 0x4D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x9B, 0xE7, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 
-0xDE, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 
-0x9D, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 
-0xBD, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0xB8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 0xB8, 0xF6, 
-0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF7, 0xD8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 
-0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0xB8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 
-0xD8, 0xF6, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0xF7, 0xD8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 
-0xD8, 0xF6, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xDE, 0xFF, 0x1A, 0xF7, 0x13, 0xEE, 0x6F, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 
-0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0C, 0xF5, 
-0x90, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDE, 0xFF, 0x5B, 0xF7, 0x76, 0xF6, 0xB1, 0xF5, 0x2E, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 
-0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xED, 0x9B, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xDD, 0xFF, 0x2D, 0xED, 0x0C, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x13, 0xF6, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x09, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xF5, 0xBE, 0xDF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
-0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x6F, 0xA6, 0xDE, 0xF7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x2D, 0x96, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x2C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x4F, 0x9E, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
-0xB3, 0xB6, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x79, 0xDF, 
-0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x37, 0xCF, 0xDE, 0xF7, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
-0x09, 0x7E, 0x0B, 0x86, 0xB2, 0xB6, 0x79, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x96, 0x4B, 0x86, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
-0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x4D, 0x96, 0x6F, 0xA6, 0xB3, 0xB6, 0x16, 0xCF, 
-0x7A, 0xDF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
-
-constexpr uint8_t loading[] PROGMEM = 
-{
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
-
-constexpr uint8_t loading30[] PROGMEM = 
-{
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF
-};
-
-constexpr uint8_t bars0[] PROGMEM =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0xA6, 0x31, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xE3, 0x18, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
-    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xCB, 0x5A
-};
-
-constexpr uint8_t bars1[] PROGMEM =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
-    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x49, 0x4A, 0x49, 0x4A, 0x49, 0x4A, 0xC7, 0x39, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x25, 0x29, 0xA6, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xA3, 0x18, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
-    0x1D, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52
-};
-
-constexpr uint8_t bars2[] PROGMEM =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
-    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x69, 0x4A, 0x69, 0x4A, 0x69, 0x4A, 0xE7, 0x39, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x92, 0x10, 0xB6, 0x10, 0xB6, 0x10, 0xB6, 0x10, 0x4D, 0x08, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x71, 0x08, 0x92, 0x10, 0x92, 0x10, 0x71, 0x08, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
-    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
-    0x1D, 0x21, 0x00, 0x00, 0xD9, 0x18, 0x1E, 0x21, 0x1E, 0x21, 0x1E, 0x21, 0x93, 0x10, 0x86, 0x31, 
-    0xAA, 0x52, 0xAA, 0x52, 0xAA, 0x52, 0x28, 0x42, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
-    0x8A, 0x52
-};
-constexpr uint8_t bars3[] PROGMEM =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
-    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x08, 0xFA, 0x18, 0xFA, 0x18, 0xFA, 0x18, 0xB5, 0x10, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x08, 0x94, 0x10, 0x94, 0x10, 0x94, 0x10, 0x0A, 0x00, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
-    0x1D, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
-    0xAA, 0x52
-};
-
-constexpr uint8_t bars4[] PROGMEM =
-{
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x20, 0x1E, 0x21, 0x1E, 0x21, 
-    0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x08, 0xFA, 0x18, 0xFA, 0x18, 0xFA, 0x18, 0xB5, 0x10, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x08, 0x94, 0x10, 0x94, 0x10, 0x94, 0x10, 0x0A, 0x00, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
-    0x1D, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
-    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
-    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
-    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
-    0x1E, 0x21
-};
-
+#ifndef _LOGO_1SIMPLECONNECT_H_
+#define _LOGO_1SIMPLECONNECT_H_
+
+#include "stdint.h"
+
+#define LOGO_GREEN 0x7e08
+
+constexpr uint8_t logo[] PROGMEM = {
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xBD, 0xEF, 0x38, 0xD7, 0xD4, 0xB6, 0x4F, 0x9E, 0x2B, 0x8E, 0x09, 0x7E, 0x08, 0x7E, 
+0x0A, 0x86, 0x4D, 0x96, 0xB2, 0xAE, 0x17, 0xCF, 0x9C, 0xE7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x5A, 0xDF, 
+0x91, 0xA6, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x70, 0x9E, 0x39, 0xD7, 0xDE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xE7, 0x6F, 0x9E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 
+0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xF5, 0xC6, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0x09, 0x7E, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 
+0x09, 0x7E, 0xD4, 0xBE, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x92, 0xAE, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 
+0x09, 0x86, 0x70, 0xA6, 0xF5, 0xC6, 0x59, 0xDF, 0x9C, 0xE7, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
+0xBD, 0xEF, 0x9B, 0xE7, 0x59, 0xD7, 0xF5, 0xBE, 0x6F, 0x9E, 0xE9, 0x85, 0x08, 0x7E, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x91, 0xA6, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xF7, 0x70, 0xA6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x8E, 0xF5, 0xC6, 
+0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0xF6, 0xC6, 0x2C, 0x8E, 
+0x09, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x6F, 0x9E, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xB2, 0xB6, 0x08, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0xD4, 0xBE, 0xDD, 0xEF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 
+0xF5, 0xBE, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x91, 0xAE, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x17, 0xCF, 0xE9, 0x7D, 0x08, 0x7E, 0x0B, 0x8E, 0x79, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0xD5, 0xBE, 0x6F, 0x9E, 0x0B, 0x8E, 0x09, 0x86, 0x0A, 0x86, 
+0x2C, 0x8E, 0x90, 0xA6, 0xF6, 0xC6, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x7A, 0xDF, 0x2D, 0x8E, 0x08, 0x7E, 0xE8, 0x7D, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 
+0x0B, 0x86, 0x08, 0x7E, 0x2C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9B, 0xE7, 0x91, 0xA6, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x91, 0xAE, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x4E, 0x96, 0x08, 0x7E, 0x0A, 0x86, 0x9B, 0xE7, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 
+0x09, 0x7E, 0x2B, 0x86, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0xCF, 
+0x09, 0x86, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xE9, 0x7D, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 0x16, 0xC7, 0xFE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x2C, 0x8E, 0x08, 0x7E, 0x91, 0xAE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x0A, 0x7E, 
+0xE9, 0x7D, 0x59, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xD4, 0xBE, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xF5, 0xC6, 0x5A, 0xDF, 0x9B, 0xE7, 0xBD, 0xEF, 0xBD, 0xEF, 
+0x9B, 0xE7, 0x5A, 0xDF, 0xF5, 0xC6, 0x4E, 0x96, 0xE9, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0xD4, 0xB6, 
+0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xDF, 0xEA, 0x85, 0x09, 0x7E, 0x9B, 0xE7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 
+0xB4, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF6, 0xC6, 0xE9, 0x7D, 0x08, 0x7E, 
+0x6F, 0x9E, 0x7A, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7A, 0xDF, 0x70, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0xF6, 0xC6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0xC7, 0x09, 0x7E, 0xB3, 0xB6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x4F, 0x96, 0x2B, 0x8E, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x09, 0x7E, 0x09, 0x7E, 0xF5, 0xBE, 
+0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xF5, 0xBE, 0x09, 0x7E, 
+0x09, 0x7E, 0x7A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x4E, 0x9E, 0x0B, 0x86, 
+0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xEF, 0xEA, 0x7D, 0x18, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x4F, 0x9E, 0x09, 0x7E, 0x17, 0xCF, 0xFE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x17, 0xCF, 
+0x09, 0x7E, 0x70, 0x9E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xD7, 0x08, 0x7E, 
+0x7B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0x2D, 0x96, 0xDD, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xDF, 0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0xF5, 0xC6, 0x70, 0xA6, 0x2D, 0x96, 0x2D, 0x96, 
+0x90, 0xA6, 0xF5, 0xC6, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xF5, 0xBE, 0x09, 0x7E, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x4E, 0x96, 
+0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xCF, 0x16, 0xC7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xAE, 0x4E, 0x9E, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xF7, 0xD5, 0xBE, 0xEA, 0x85, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 0xD4, 0xBE, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xF7, 0x6E, 0x9E, 0xB3, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x17, 0xCF, 
+0xF4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC6, 0xDC, 0xEF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x2D, 0x8E, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDD, 0xF7, 0x70, 0xA6, 0x09, 0x7E, 0x2C, 0x8E, 0xD5, 0xBE, 0x59, 0xDF, 0x7B, 0xE7, 0x7B, 0xE7, 
+0x59, 0xDF, 0xF5, 0xBE, 0x2D, 0x96, 0x08, 0x7E, 0x4F, 0x9E, 0xDD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x7A, 0xDF, 0x2D, 0x96, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 
+0xB4, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x71, 0xA6, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x92, 0xAE, 0x0A, 0x7E, 0x16, 0xC7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x17, 0xC7, 0x0A, 0x86, 0x71, 0xAE, 0xFE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0x71, 0xA6, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0x59, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 
+0xEA, 0x85, 0x79, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xDF, 0x0A, 0x86, 0x59, 0xD7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xDF, 0x7B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xA6, 
+0x18, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x58, 0xD7, 0x4F, 0x9E, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x9C, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 
+0x7A, 0xDF, 0x17, 0xCF, 0xD5, 0xBE, 0xD3, 0xB6, 0xB2, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0xAE, 
+0x92, 0xAE, 0x92, 0xAE, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 0x71, 0xA6, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xAE, 0xDC, 0xEF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0xF6, 0xC6, 0x4F, 0x9E, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 0x5A, 0xDF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x7A, 0xDF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0x59, 0xD7, 0x70, 0xA6, 0xE9, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7B, 0xEF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x7A, 0xDF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xD4, 0xB6, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xE7, 0x4E, 0x9E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xDF, 0x2C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x38, 0xD7, 0xD5, 0xBE, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xF5, 0xC6, 0xFF, 0xFF, 0xBC, 0xEF, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0x59, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x7A, 0xE7, 0x17, 0xCF, 0xD5, 0xBE, 0xD4, 0xB6, 
+0xF5, 0xBE, 0x38, 0xCF, 0xBB, 0xEF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0x9C, 0xE7, 0x38, 0xCF, 0xF5, 0xBE, 0xD4, 0xBE, 0xD4, 0xBE, 0x17, 0xCF, 0x7A, 0xDF, 
+0xDE, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBD, 0xEF, 0xB4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD5, 0xBE, 0x37, 0xCF, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xDF, 0xD3, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xB4, 0xB6, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDD, 0xF7, 
+0x59, 0xDF, 0xF6, 0xC6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 
+0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xD4, 0xB6, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x0B, 0x86, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0xB2, 0xAE, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4E, 0x96, 0xFE, 0xFF, 0x9B, 0xDF, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xF7, 0x17, 0xCF, 0x2C, 0x8E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x4F, 0x9E, 0x79, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 
+0x70, 0x9E, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 
+0x2C, 0x8E, 0x16, 0xC7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x4F, 0x9E, 0x79, 0xDF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x09, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x08, 0x7E, 0x9A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xF6, 0xC6, 0x0B, 0x86, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4F, 0x96, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xBC, 0xEF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x85, 0xD4, 0xBE, 0xF5, 0xBE, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x9E, 0xBB, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9C, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xF5, 0xBE, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xEF, 0x6F, 0x9E, 0xE9, 0x7D, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDD, 0xEF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x7B, 0xDF, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4F, 0x96, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 
+0x2C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x2C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9C, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x4F, 0x9E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x92, 0xAE, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDD, 0xF7, 0x2D, 0x96, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 0x9B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x4E, 0x96, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0xDD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9C, 0xEF, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE9, 0x7D, 0x59, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x09, 0x76, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x39, 0xD7, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x16, 0xC7, 0x08, 0x7E, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4E, 0x96, 0xFE, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xBE, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD4, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9C, 0xE7, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x2D, 0x96, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xE7, 0xE9, 0x85, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0xE8, 0x7D, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 
+0x2D, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x37, 0xCF, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 
+0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 
+0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x58, 0xD7, 0x90, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 
+0x4E, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x0B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x51, 0xA6, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x0A, 0x86, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x0A, 0x86, 0x0B, 0x8E, 
+0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2B, 0x86, 0x09, 0x86, 0xE8, 0x7D, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 0xBC, 0xEF, 0xFF, 0xFF, 
+0x9C, 0xEF, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x0C, 0x8E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE8, 0x7D, 0x08, 0x7E, 0x58, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0x0A, 0x86, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x0B, 0x8E, 0x9C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0xCF, 
+0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 
+0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 0x79, 0xDF, 
+0xFE, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0xCF, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xF5, 0xC6, 0xDD, 0xF7, 0xFE, 0xF7, 
+0x9B, 0xE7, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 0x9B, 0xDF, 0xFE, 0xF7, 0xDD, 0xF7, 0x16, 0xCF, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x16, 0xC7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xF7, 0xBC, 0xEF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD3, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xA6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0xD5, 0xBE, 0xFD, 0xF7, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x2D, 0x8E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 
+0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xB3, 0xB6, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x09, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDD, 0xEF, 0x2D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x2D, 0x8E, 0xDC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x16, 0xC7, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x92, 0xAE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x9B, 0xE7, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x0B, 0x86, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xE7, 
+0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xB2, 0xAE, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x9E, 0x09, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x0A, 0x7E, 0xDC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0x16, 0xC7, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 
+0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x9E, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x0A, 0x86, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xAE, 0xE9, 0x7D, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 
+0x09, 0x86, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x85, 0x37, 0xCF, 
+0xBC, 0xEF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9A, 0xDF, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x71, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xA6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0xB3, 0xB6, 0xBC, 0xEF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFF, 0xFF, 0xDD, 0xF7, 0x0A, 0x86, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x0B, 0x8E, 0x70, 0xA6, 0x37, 0xCF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDC, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
+0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
+0xDD, 0xEF, 0xDC, 0xEF, 0x79, 0xDF, 0x2D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0xE9, 0x85, 0x9B, 0xE7, 0x7A, 0xDF, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 
+0x37, 0xCF, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x79, 0xDF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE9, 0x7D, 0xE9, 0x7D, 0xE8, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 
+0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 
+0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0x5A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xEF, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0x16, 0xC7, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xF7, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xEA, 0x85, 0x38, 0xD7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0x08, 0x7E, 0x4E, 0x96, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xBE, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0xB2, 0xAE, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x9B, 0xE7, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 
+0x9B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE9, 0x85, 0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0xE8, 0x7D, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 0x2D, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x4E, 0x9E, 0xFE, 0xF7, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0x16, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x4D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x4C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0xD5, 0xBE, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x59, 0xDF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x09, 0x7E, 0x0A, 0x86, 0x37, 0xCF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xBB, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0xBB, 0xE7, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDD, 0xF7, 0x5A, 0xDF, 0x17, 0xCF, 
+0xF6, 0xC6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0xF4, 0xBE, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x0A, 0x7E, 0xB2, 0xB6, 0x9C, 0xE7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x0C, 0x8E, 0xF4, 0xBE, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0xF6, 0xC6, 0xBD, 0xF7, 0x2A, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0xE9, 0x7D, 0x4F, 0x9E, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x70, 0x9E, 
+0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 0x16, 0xCF, 
+0x16, 0xCF, 0x17, 0xCF, 0x17, 0xCF, 0x7A, 0xDF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE9, 0x7D, 0x9B, 0xE7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x0A, 0x86, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4F, 0x9E, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x2C, 0x8E, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x09, 0x7E, 0x9A, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBD, 0xEF, 
+0xF6, 0xC6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0xF6, 0xC6, 0xD5, 0xBE, 0x0B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0xD4, 0xBE, 0xFF, 0xFF, 0x7A, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xB3, 0xB6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0xF6, 0xC6, 0xF6, 0xC6, 0x7A, 0xE7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x0C, 0x8E, 0xF5, 0xBE, 0xF6, 0xC6, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 
+0x16, 0xC7, 0x16, 0xC7, 0x16, 0xC7, 0xF6, 0xC6, 0xBD, 0xEF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
+0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 
+0x09, 0x7E, 0x79, 0xDF, 0xFF, 0xFF, 0x9B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xE8, 0x7D, 0xE8, 0x7D, 
+0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
+0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x4F, 0x9E, 0xFE, 0xF7, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0x2E, 0x96, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
+0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x86, 
+0x9B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xDF, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
+0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0A, 0x86, 0x39, 0xD7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x38, 0xD7, 0x09, 0x86, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBC, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
+0xE9, 0x7D, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x7A, 0xDF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xE7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xF6, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0B, 0x86, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xD7, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x38, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0x0C, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4E, 0x96, 0xFF, 0xFF, 
+0x9B, 0xE7, 0xE8, 0x7D, 0x09, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x17, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xDF, 0x2C, 0x96, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0xBB, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xE7, 
+0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0xE9, 0x7D, 0x0B, 0x8E, 0x6F, 0xA6, 0x37, 0xCF, 0xDE, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xDF, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0xF5, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x9E, 0xE8, 0x7D, 0x08, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0xEC, 0x8D, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xD7, 0xE8, 0x7D, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x37, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0x0D, 0x8E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x2E, 0x96, 0xFE, 0xF7, 
+0x9B, 0xE7, 0xE9, 0x7D, 0xE9, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0xD4, 0xBE, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC6, 0xE9, 0x7D, 0x08, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x17, 0xCF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0x17, 0xCF, 
+0x6F, 0xA6, 0x0A, 0x86, 0xE9, 0x7D, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 
+0x09, 0x7E, 0x09, 0x7E, 0x09, 0x7E, 0xE9, 0x7D, 0x9B, 0xE7, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDD, 0xEF, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDE, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 
+0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xDD, 0xF7, 0xFE, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 0x97, 0xF6, 
+0x13, 0xF6, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 0xB1, 0xF5, 
+0xB1, 0xF5, 0xB1, 0xF5, 0xD2, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x96, 0xF6, 0xF2, 0xF5, 0x91, 0xF5, 
+0xB1, 0xF5, 0x55, 0xF6, 0x3A, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9C, 0xF7, 0x19, 0xF7, 0xB8, 0xF6, 0xB7, 0xF6, 0xD8, 0xF6, 
+0x3A, 0xF7, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x5B, 0xF7, 0xD9, 0xF6, 0xB7, 0xF6, 0xB8, 0xF6, 
+0xF9, 0xF6, 0x7B, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
+0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
+0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
+0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 
+0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0xDE, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x70, 0xED, 0x44, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDF, 0xFF, 0xF9, 0xF6, 0x2D, 0xF5, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xCA, 0xEC, 0x96, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xB7, 0xF6, 0x2C, 0xED, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0x88, 0xEC, 0xD2, 0xED, 0x5B, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xF7, 0x7C, 0xF7, 0xF3, 0xF5, 0x88, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x0C, 0xED, 0x76, 0xF6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xD7, 0xF6, 0xB1, 0xF5, 0xCB, 0xF4, 0x88, 0xF4, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
+0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x87, 0xEC, 
+0x2D, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xDE, 0xFF, 0xF8, 0xF6, 0xF2, 0xF5, 0x0C, 0xF5, 0xA9, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
+0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x87, 0xF4, 0x7C, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0xF6, 0x87, 0xEC, 0x87, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
+0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 
+0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x88, 0xEC, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x76, 0xF6, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xBD, 0xFF, 0xD1, 0xED, 0x44, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x2E, 0xED, 0x7B, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 
+0x0C, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x34, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xF7, 
+0x55, 0xF6, 0x67, 0xEC, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xEC, 0xEC, 0x3A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xFF, 
+0x2D, 0xED, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xF8, 0xF6, 0xEB, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBE, 0xFF, 
+0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xAA, 0xEC, 0x7B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x67, 0xEC, 
+0x23, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x23, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x8F, 0xED, 0xBD, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xB1, 0xF5, 
+0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xF4, 0xD7, 0xF6, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xEC, 0xEC, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x13, 0xF6, 
+0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x19, 0xF7, 0x45, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 0x45, 0xF4, 
+0x45, 0xF4, 0x44, 0xF4, 0xAA, 0xE4, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xF5, 
+0x44, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xEC, 0xEC, 
+0xBD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x67, 0xEC, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xF5, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x44, 0xF4, 0x44, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 
+0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x19, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0xEE, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x34, 0xF6, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x7C, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xFF, 0xEC, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xEC, 0xD2, 0xF5, 
+0x19, 0xF7, 0x9C, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 
+0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0xA9, 0xEC, 0x75, 0xF6, 0x5B, 0xF7, 0xBD, 0xFF, 
+0x9C, 0xF7, 0xB7, 0xF6, 0x0C, 0xED, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 
+0x14, 0xEE, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xCB, 0xEC, 0x23, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 0x4E, 0xED, 0x13, 0xF6, 0x34, 0xF6, 0xD2, 0xF5, 
+0xA9, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x97, 0xF6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF6, 0x24, 0xF4, 0x23, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x89, 0xF4, 0xD1, 0xF5, 0x55, 0xF6, 0x14, 0xF6, 
+0x4F, 0xF5, 0x46, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0xAA, 0xEC, 
+0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x88, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x0D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 
+0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 
+0xB1, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x45, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0xEC, 0xF4, 0x2D, 0xF5, 0x2D, 0xF5, 
+0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2E, 0xED, 0x9B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x2E, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 
+0x2D, 0xF5, 0x0D, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x67, 0xF4, 0x2E, 0xF5, 
+0x2E, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2D, 0xF5, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x19, 0xF7, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x46, 0xF4, 0xF8, 0xF6, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xF7, 0xEB, 0xEC, 0x24, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0x23, 0xF4, 0x4F, 0xED, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xF3, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x46, 0xF4, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x44, 0xF4, 0x0D, 0xF5, 0x5A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDD, 0xFF, 0x75, 0xEE, 0x45, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0xA9, 0xEC, 
+0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xEB, 0xEC, 0x24, 0xF4, 0x44, 0xEC, 
+0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x34, 0xF6, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0x7B, 0xF7, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x34, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x45, 0xEC, 0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x2D, 0xF5, 0x23, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0x24, 0xF4, 0x67, 0xF4, 0x76, 0xF6, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xED, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x54, 0xF6, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0xCA, 0xEC, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0x90, 0xED, 0x23, 0xF4, 0x44, 0xEC, 0x23, 0xF4, 
+0x24, 0xF4, 0x76, 0xF6, 0xFF, 0xFF, 0xFE, 0xFF, 0x0D, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x0C, 0xF5, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xF6, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xF8, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0x76, 0xEE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xDE, 0xF7, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 
+0xAA, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0xA9, 0xEC, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x23, 0xF4, 0x46, 0xF4, 0x19, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDE, 0xF7, 
+0xC9, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x88, 0xEC, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0xB7, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x45, 0xF4, 0x44, 0xEC, 0x23, 0xF4, 
+0x24, 0xF4, 0x4F, 0xF5, 0xFF, 0xFF, 0xBC, 0xFF, 0x45, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x44, 0xEC, 0x1A, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x6F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x13, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x55, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x43, 0xF4, 0x2D, 0xED, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x45, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xB6, 0xF6, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x55, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x34, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 
+0x45, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x6F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x45, 0xEC, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEB, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x89, 0xEC, 0xDE, 0xFF, 0x5B, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xA9, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x75, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEC, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 0x45, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xA9, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 
+0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 0xCA, 0xEC, 
+0x4F, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x6F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 
+0x45, 0xF4, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xD5, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xF7, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x13, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xF5, 0x23, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xA8, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x45, 0xF4, 0xDE, 0xFF, 0x3A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x4E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0x96, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xB1, 0xED, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xAA, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x17, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 
+0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xB1, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x87, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x66, 0xEC, 0xDE, 0xFF, 0x3A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x44, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x67, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x4D, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0x38, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 
+0x67, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xCB, 0xF4, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x44, 0xF4, 0x3A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x67, 0xEC, 0x44, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x0C, 0xF5, 0xFE, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x90, 0xED, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xCB, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xCA, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x09, 0x7E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x4F, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xB8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x43, 0xF4, 0xB1, 0xF5, 0xDF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xF6, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF3, 0xED, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7C, 0xF7, 0x45, 0xEC, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x46, 0xEC, 0x2D, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 
+0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 0x4F, 0xF5, 
+0xD2, 0xED, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x90, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0x5B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x0A, 0x86, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x76, 0xF6, 0x44, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x0C, 0xED, 0xBE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0x66, 0xEC, 0x24, 0xF4, 
+0x44, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xF7, 0x67, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x45, 0xEC, 0x18, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x76, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0xF3, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x70, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x9C, 0xFF, 0x67, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x2E, 0xF5, 0x5A, 0xF7, 
+0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD1, 0xED, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x45, 0xEC, 0x13, 0xF6, 0x9D, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBE, 0xFF, 0x96, 0xF6, 0x68, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x2D, 0xED, 0xDE, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0xA9, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x5B, 0xF7, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x45, 0xF4, 0xF8, 0xF6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0x34, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x25, 0xF4, 
+0x0D, 0xED, 0xD1, 0xF5, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 0xF2, 0xED, 
+0xF2, 0xED, 0xF2, 0xF5, 0x13, 0xEE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xFF, 0xA8, 0xEC, 
+0x24, 0xF4, 0x43, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x87, 0xEC, 0x6F, 0xF5, 0xD2, 0xED, 
+0x90, 0xED, 0x88, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x45, 0xF4, 
+0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0xB6, 0xF6, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xDE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xED, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x46, 0xEC, 0x13, 0xF6, 0x7B, 0xF7, 0xDE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x09, 0x7E, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0x0D, 0xF5, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 
+0x45, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xEC, 0x55, 0xF6, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x88, 0xEC, 0x24, 0xF4, 
+0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x89, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 
+0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xEC, 
+0x4E, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0xF7, 0x46, 0xF4, 0x44, 0xF4, 
+0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x45, 0xF4, 0x88, 0xEC, 0xAA, 0xEC, 0xCA, 0xF4, 
+0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xF4, 0xCA, 0xEC, 0xCA, 0xEC, 0x7B, 0xF7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x92, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF7, 0x0C, 0xF5, 0x24, 0xF4, 0x44, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 
+0xF8, 0xF6, 0x67, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xEC, 0x23, 0xF4, 0x45, 0xEC, 0x54, 0xF6, 0xDE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x34, 0xF6, 0x24, 0xF4, 
+0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x96, 0xF6, 0x44, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0x7A, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xD2, 0xF5, 0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x89, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFE, 0xFF, 0x7B, 0xF7, 0x4F, 0xED, 0x44, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0xEC, 0xEC, 0x19, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x97, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0x0C, 0xED, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x75, 0xF6, 
+0x45, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xEC, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x4F, 0x9E, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB6, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x91, 0xA6, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xFF, 0x34, 0xF6, 0x0C, 0xED, 
+0x67, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x44, 0xF4, 0x44, 0xEC, 0x44, 0xEC, 0x44, 0xEC, 0x44, 0xEC, 
+0x44, 0xEC, 0x24, 0xF4, 0x89, 0xEC, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x1A, 0xF7, 0xF3, 0xF5, 0xEB, 0xEC, 0x45, 0xF4, 0x24, 0xF4, 
+0x44, 0xF4, 0xA9, 0xEC, 0xB1, 0xF5, 0xF8, 0xF6, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEB, 0xEC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF6, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x6E, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xF5, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x96, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xED, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xFF, 
+0x6F, 0xED, 0x24, 0xF4, 0x23, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0xEC, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0x39, 0xF7, 0x4E, 0xED, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 
+0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x7B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xBD, 0xFF, 0x66, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x24, 0xF4, 0x90, 0xF5, 0xFE, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x2B, 0x86, 
+0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 
+0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xD3, 0xB6, 0xB3, 0xB6, 0x4D, 0x96, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x9B, 0xE7, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDE, 0xFF, 
+0xDE, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 0x9D, 0xFF, 
+0x9D, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xBD, 0xFF, 0xBD, 0xFF, 
+0xBD, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xF7, 0xB8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 0xB8, 0xF6, 
+0xF9, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF7, 0xD8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 
+0x19, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xF7, 0xB8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 
+0xD8, 0xF6, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0xF7, 0xD8, 0xF6, 0xD8, 0xF6, 0xD8, 0xF6, 
+0xD8, 0xF6, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xDE, 0xFF, 0x1A, 0xF7, 0x13, 0xEE, 0x6F, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 
+0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0C, 0xF5, 
+0x90, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDE, 0xFF, 0x5B, 0xF7, 0x76, 0xF6, 0xB1, 0xF5, 0x2E, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 
+0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xED, 0x9B, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xDD, 0xFF, 0x2D, 0xED, 0x0C, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x13, 0xF6, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xE9, 0x7D, 0x09, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0xF5, 0xBE, 0xDF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 
+0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x6F, 0xA6, 0xDE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 0x2D, 0x96, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x0C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x2C, 0x8E, 0x9B, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x4F, 0x9E, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x09, 0x7E, 
+0xB3, 0xB6, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0xE8, 0x7D, 0x08, 0x7E, 0x09, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x79, 0xDF, 
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x2D, 0x96, 0x37, 0xCF, 0xDE, 0xF7, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x8E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 0x08, 0x7E, 
+0x09, 0x7E, 0x0B, 0x86, 0xB2, 0xB6, 0x79, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x96, 0x4B, 0x86, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 
+0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x2B, 0x8E, 0x4D, 0x96, 0x6F, 0xA6, 0xB3, 0xB6, 0x16, 0xCF, 
+0x7A, 0xDF, 0xDD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+constexpr uint8_t loading[] PROGMEM = 
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+constexpr uint8_t loading30[] PROGMEM = 
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0xFF
+};
+
+constexpr uint8_t bars0[] PROGMEM =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0xA6, 0x31, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0xC7, 0x39, 0xC7, 0x39, 0xC7, 0x39, 0xE3, 0x18, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 
+    0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0x00, 0x00, 0x28, 0x42, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xC7, 0x39, 0xC7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x28, 0x42, 0x00, 0x00, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xCB, 0x5A
+};
+
+constexpr uint8_t bars1[] PROGMEM =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
+    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x49, 0x4A, 0x49, 0x4A, 0x49, 0x4A, 0xC7, 0x39, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x29, 0xA6, 0x31, 0xA6, 0x31, 0xA6, 0x31, 0xA3, 0x18, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
+    0x1D, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x49, 0x4A, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0xA7, 0x39, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52
+};
+
+constexpr uint8_t bars2[] PROGMEM =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
+    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x69, 0x4A, 0x69, 0x4A, 0x69, 0x4A, 0xE7, 0x39, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x92, 0x10, 0xB6, 0x10, 0xB6, 0x10, 0xB6, 0x10, 0x4D, 0x08, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x71, 0x08, 0x92, 0x10, 0x92, 0x10, 0x71, 0x08, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 
+    0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0xA7, 0x39, 0xCB, 0x5A, 0xCB, 0x5A, 0xCB, 0x5A, 0x49, 0x4A, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
+    0x1D, 0x21, 0x00, 0x00, 0xD9, 0x18, 0x1E, 0x21, 0x1E, 0x21, 0x1E, 0x21, 0x93, 0x10, 0x86, 0x31, 
+    0xAA, 0x52, 0xAA, 0x52, 0xAA, 0x52, 0x28, 0x42, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
+    0x8A, 0x52
+};
+constexpr uint8_t bars3[] PROGMEM =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x8A, 0x52, 0x8A, 0x52, 
+    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x08, 0xFA, 0x18, 0xFA, 0x18, 0xFA, 0x18, 0xB5, 0x10, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x08, 0x94, 0x10, 0x94, 0x10, 0x94, 0x10, 0x0A, 0x00, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
+    0x1D, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 0xAA, 0x52, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0xAA, 0x52, 0xCB, 0x5A, 0xCB, 0x5A, 
+    0xAA, 0x52
+};
+
+constexpr uint8_t bars4[] PROGMEM =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x20, 0x1E, 0x21, 0x1E, 0x21, 
+    0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x08, 0xFA, 0x18, 0xFA, 0x18, 0xFA, 0x18, 0xB5, 0x10, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x08, 0x94, 0x10, 0x94, 0x10, 0x94, 0x10, 0x0A, 0x00, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x21, 
+    0x1D, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 
+    0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 
+    0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x1E, 0x21, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21, 0x00, 0x00, 0xDA, 0x18, 0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xB4, 0x10, 0x94, 0x10, 
+    0x1F, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0xDA, 0x18, 0x00, 0x00, 0x1E, 0x21, 0x1F, 0x21, 0x1F, 0x21, 
+    0x1E, 0x21
+};
+
 #endif
\ No newline at end of file
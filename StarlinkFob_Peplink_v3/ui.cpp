@@ -1,1801 +1,2693 @@
-#include "M5StickCPlus2.h"
-#include <WiFi.h>
-#include <ArduinoUniqueID.h>
-
-#include "Minu/minu.hpp"
-#include "ui.h"
-#include "utils.h"
-#include "config.h"
-#include "logo.h"
-
-#if CONFIG_FREERTOS_UNICORE
-#define ARDUINO_RUNNING_CORE 0
-#else
-#define ARDUINO_RUNNING_CORE 1
-#endif
-
-/// @brief Conditions that trigger the countdown page
-typedef enum
-{
-  UI_COUNTDOWN_TYPE_WIFI = 1,     // Wi-Fi STA connecting countdown
-  UI_COUNTDOWN_TYPE_ROUTER,
-  UI_COUNTDOWN_TYPE_SHUTDOWN,
-  UI_COUNTDOWN_TYPE_REBOOT,
-  UI_COUNTDOWN_TYPE_FACTORY_RESET,
-} UiCountdownType;
-
-/// @brief Defines the data to be fetched periodically
-typedef enum
-{
-  UI_UPDATE_TYPE_TIME = 1,
-  UI_UPDATE_TYPE_SENSORS,
-  UI_UPDATE_TYPE_WAN_INFO,
-  UI_UPDATE_TYPE_FOB_INFO,
-  UI_UPDATE_TYPE_PING,
-  UI_UPDATE_TYPE_WAN_SUMMARY
-} UiUpdateType;
-
-/// @brief Information about a Wi-Fi network found during a Wi-Fi scan
-typedef struct
-{
-  String ssid;
-  int32_t rssi;
-  uint8_t encType;
-  uint8_t mac[10];
-  int channel;
-} UiWiFiScannedNetwork;
-
-size_t homePageId;
-size_t wifiPageId;
-size_t wifiPromptPageId;
-size_t scanResultPageId;
-size_t saveSSIDAsPageId;
-size_t pingTargetsPageId;
-size_t routerPageId;
-size_t routerInfoPageId;
-size_t routerLocationPageId;
-size_t routerUnavailablePageId;
-size_t routerWANListPageId;
-size_t routerWANInfoPageId;
-size_t routerWANSummaryPageId;
-size_t timePageId;
-size_t sensorsPageId;
-size_t countdownPageId;
-size_t fobInfoPageId;
-size_t factoryResetPageId;
-size_t simListPageId;
-size_t simInfoPageId;
-size_t lastVisitedPageId;
-
-static size_t wifiStatusItem;
-static ssize_t homepageWifiItem;
-
-static String tempSSID;
-static String lastSelectedWAN;
-static size_t lastSelectedSim;
-
-void buttonWatchTask(void *arg);
-void screenWatchTask(void *arg);
-void screenUpdateTask(void *arg);
-void countdownTask(void *arg);
-void dataUpdateTask(void *arg);
-void wifiWatchTask(void* arg);
-void routerConnectTask(void* arg);
-
-void goToFobInfoPage(void *arg = NULL)
-{
-  fob.menu.goToPage(fobInfoPageId);
-}
-
-void goToHomePage(void *arg = NULL)
-{
-  fob.booting = false;
-  fob.menu.goToPage(homePageId);
-}
-
-void goToWiFiPage(void *arg = NULL)
-{
-  fob.wifi.usePrimarySsid = true;
-  fob.menu.goToPage(wifiPageId);
-}
-
-void goToTimePage(void *arg = NULL)
-{
-  fob.menu.goToPage(timePageId);
-}
-
-void goToSensorsPage(void *arg = NULL)
-{
-  fob.menu.goToPage(sensorsPageId);
-}
-
-void goToWiFiPromptPage(void *arg = NULL)
-{
-  fob.wifi.usePrimarySsid = true;
-  fob.menu.goToPage(wifiPromptPageId);
-}
-
-void goToScanResultPage(void *arg = NULL)
-{
-  fob.menu.goToPage(scanResultPageId);
-}
-
-void goToCountdownPage(void *arg = NULL)
-{
-  fob.menu.goToPage(countdownPageId);
-}
-
-void goToRouterPage(void *arg = NULL)
-{
-  fob.menu.goToPage(routerPageId);
-}
-
-void goToRouterInfoPage(void *arg = NULL)
-{
-  fob.menu.goToPage(routerInfoPageId);
-}
-
-void goToRouterLocationPage(void *arg = NULL)
-{
-  fob.menu.goToPage(routerLocationPageId);
-}
-
-void goToRouterUnavailablePage(void *arg = NULL)
-{
-  fob.menu.goToPage(routerUnavailablePageId);
-}
-
-void goToRouterWANListPage(void *arg = NULL)
-{
-  fob.menu.goToPage(routerWANListPageId);
-}
-
-void goToRouterWANInfoPage(void *arg = NULL)
-{
-  fob.menu.goToPage(routerWANInfoPageId);
-}
-
-void goToWANSummaryPage(void* arg = NULL)
-{
-  fob.menu.goToPage(routerWANSummaryPageId);
-}
-
-void goToPingTargetsPage(void *arg = NULL)
-{
-  fob.menu.goToPage(pingTargetsPageId);
-}
-
-void goToFactoryResetPage(void* arg = NULL)
-{
-  fob.menu.goToPage(factoryResetPageId);
-}
-
-void goToSimListPage(void* arg = NULL)
-{
-  fob.menu.goToPage(simListPageId);
-}
-
-void goToSimInfoPage(void* arg = NULL)
-{
-  fob.menu.goToPage(simInfoPageId);
-}
-
-/// @brief Generic function to be called just after the current active page changes
-/// @param arg A pointer to the currently active page is passed
-void pageOpenedCallback(void *arg)
-{
-  if (!arg)
-    return;
-  MinuPage *thisPage = (MinuPage *)arg;
-  thisPage->highlightItem(0);
-  Serial.printf("Opened page: %s\n", thisPage->title());
-}
-
-/// @brief Generic function to be called just before the current active page changes
-/// @param arg A pointer to the old active page is passed
-void pageClosedCallback(void *arg)
-{
-  if (!arg)
-    return;
-  MinuPage *thisPage = (MinuPage *)arg;
-
-  Serial.printf("Closed page: %s\n", thisPage->title());
-}
-
-/// @brief Generic function called when the current active page is rendered
-/// @param arg A pointer to the currently active page is passed
-void pageRenderedCallback(void *arg)
-{
-  if (!arg)
-    return;
-  MinuPage *thisPage = (MinuPage *)arg;
-
-  Serial.printf("Rendered page: %s\n", thisPage->title());
-}
-
-/// @brief Changes the colour of the Wi-Fi status indicator on the homepage
-/// AP  (active) = Green
-/// STA (not connected) = Red
-/// STA (connected) = Green
-/// Wi-Fi not initialized = Grey
-void updateWiFiItem(void *arg)
-{
-  if (!arg)
-    return;
-
-  MinuPageItem *thisItem = (MinuPageItem *)arg;
-
-  if (WiFi.getMode() == WIFI_MODE_AP)
-    thisItem->setAuxTextBackground(GREEN);
-  else if (WiFi.getMode() == WIFI_MODE_STA)
-  {
-    if (WiFi.status() == WL_CONNECTED)
-      thisItem->setAuxTextBackground(GREEN);
-    else
-      thisItem->setAuxTextBackground(RED);
-  }
-  else
-    thisItem->setAuxTextBackground(TFT_GREY);
-}
-
-/// @brief Prints the Wi-Fi status and details when the Wi-Fi status item (<--) on the Wi-Fi page is highlighted
-void lcdPrintWiFiStatus(void *page)
-{
-  if (page)
-    if (fob.menu.currentPageId() == wifiPageId && (*(MinuPage *)page).highlightedIndex() != wifiStatusItem)
-      return;
-
-  M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-  if (WiFi.getMode() == WIFI_MODE_NULL)
-  {
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("WiFi not INIT!");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-    return;
-  }
-  else
-    M5.Lcd.printf("\n%s:", WiFi.getMode() == WIFI_MODE_AP ? "(AP) " : "(STA)");
-
-  if ((WiFi.status() == WL_CONNECTED) || WiFi.getMode() == WIFI_MODE_AP)
-  {
-    M5.Lcd.setTextColor(BLACK, GREEN);
-    M5.Lcd.println(" ");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-
-    M5.Lcd.print("SSID :");
-    M5.Lcd.println((WiFi.getMode() == WIFI_MODE_AP) ? WiFi.softAPSSID().c_str() : WiFi.SSID().c_str());
-
-    M5.Lcd.print("IPAdr:");
-    M5.Lcd.println((WiFi.getMode() == WIFI_MODE_AP) ? WiFi.softAPIP().toString().c_str() : WiFi.localIP().toString().c_str());
-
-    return;
-  }
-  M5.Lcd.setTextColor(BLACK, RED);
-  M5.Lcd.println(" ");
-  M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-}
-
-/// @brief Fetch and print the router hardware information
-void lcdPrintRouterInfo(void *arg = NULL)
-{
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-
-  M5.Lcd.drawBitmap(0, cursorY, 40, 40, loading, 0);
-
-  if (!fob.routers.router.checkAvailable() || !fob.routers.router.getInfo())
-  {
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("Unavailable!");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-    return;
-  }
-  M5.Lcd.setCursor(cursorX, cursorY);
-  M5.Lcd.printf("Name  :%s\n", fob.routers.router.info().name.c_str());
-  M5.Lcd.printf("Uptime:%ld\n", fob.routers.router.info().uptime);
-  M5.Lcd.printf("Serial:%s\n", fob.routers.router.info().serial.c_str());
-  M5.Lcd.printf("Fw Ver:%s\n", fob.routers.router.info().fwVersion.c_str());
-  M5.Lcd.printf("P Code:%s\n", fob.routers.router.info().productCode.c_str());
-  M5.Lcd.printf("hw Rev:%s\n", fob.routers.router.info().hardwareRev.c_str());
-}
-
-/// @brief Fetch and print the router location information
-void lcdPrintRouterLocation(void *arg = NULL)
-{
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-
-  M5.Lcd.println("Fetching...");
-
-  if (!fob.routers.router.checkAvailable() || !fob.routers.router.getLocation())
-  {
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("Unavailable!");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-    return;
-  }
-  
-  M5.Lcd.setCursor(cursorX, cursorY);
-  M5.Lcd.printf("Longitude:%s\n", fob.routers.router.location().longitude.c_str());
-  M5.Lcd.printf("Latitude :%s\n", fob.routers.router.location().latitude.c_str());
-  M5.Lcd.printf("Altitude :%s\n", fob.routers.router.location().altitude.c_str());
-}
-
-void lcdPrintRouterUnavailable(void *arg = NULL)
-{
-  fob.booting = true;
-  M5.Lcd.println(" Router Unavailable!\n Unable to continue.\n Please reboot"); 
-}
-
-/// @brief Fetch and print the selected WAN information
-void lcdPrintRouterWANInfo(void *arg = NULL)
-{
-  std::vector<PeplinkAPI_WAN *> wanList = fob.routers.router.wanStatus();
-  if (!wanList.size())
-  {
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("No WAN found!");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-    return;
-  }
-
-  for (PeplinkAPI_WAN *wan : wanList)
-  {
-    if (wan->name == lastSelectedWAN)
-    {
-      if(!fob.routers.router.getWanStatus(wan->id))
-      {
-        M5.Lcd.setTextColor(RED, BLACK);
-        M5.Lcd.println("Unavailable!");
-        M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-        return;
-      }
-      else
-      {
-        M5.Lcd.printf("Name:%s      \n", wan->name.c_str());
-        M5.Lcd.print("Type:");
-        switch (wan->type)
-        {
-        case PEPLINKAPI_WAN_TYPE_ETHERNET:
-          M5.Lcd.print("ETHERNET\n");
-          break;
-        case PEPLINKAPI_WAN_TYPE_CELLULAR:
-          M5.Lcd.print("CELLULAR\n");
-          M5.Lcd.printf("Carr:%s ",((PeplinkAPI_WAN_Cellular *)wan)->carrier.c_str());
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_BLUE);
-          M5.Lcd.printf("%s", ((PeplinkAPI_WAN_Cellular *)wan)->networkType.c_str());
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-          switch (((PeplinkAPI_WAN_Cellular *)wan)->signalLevel)
-          {
-            case 0: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars0, 0); break;
-            case 1: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars1, 0); break;
-            case 2: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars2, 0); break;
-            case 3: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars3, 0); break;
-            default: M5.Lcd.drawBitmap(M5.Lcd.getCursorX()+ 10, M5.Lcd.getCursorY() - 5, 20, 21, bars4, 0); break;
-          }
-          M5.Lcd.println(" ");
-          break;
-        case PEPLINKAPI_WAN_TYPE_WIFI:
-          M5.Lcd.print("WIFI\n");
-          break;
-        }
-        M5.Lcd.printf("Stat:%s\n", wan->status.c_str());
-
-        if(wan->status == "Disabled")
-          break;
-        M5.Lcd.printf("IP  :%s\n", wan->ip.c_str());
-        M5.Lcd.print("U/D :");
-        M5.Lcd.printf("%ld/%ld %s     \n", wan->upload, wan->download, wan->unit);
-      }
-      break;
-    }
-  }
-}
-
-/// @brief Sync RTC time with NTP server and RTC time
-void lcdPrintTime(void *arg = NULL)
-{
-	syncNtpToRtc(TIMEZONE);
-  auto dt = M5.Rtc.getDateTime();
-  Serial.printf("%02d:%02d:%02dH\n%02d/%02d/%04d\n",
-                dt.time.hours, dt.time.minutes, dt.time.seconds,
-                dt.date.date, dt.date.month, dt.date.year);
-  M5.Lcd.printf("Time:%02d:%02d:%02dH\nDate:%02d/%02d/%04d\n",
-                dt.time.hours, dt.time.minutes, dt.time.seconds,
-                dt.date.date, dt.date.month, dt.date.year);
-
-  if(fob.timestamps.lastShutdownTime.length())  
-    M5.Lcd.printf("Last PWR:%s\n", fob.timestamps.lastShutdownTime.c_str());
-  else
-    M5.Lcd.println("Last PWR:Unknown");
-
-  if (fob.timestamps.lastShutdownRuntime)
-    M5.Lcd.printf("Last Run:%04d:%02d", (fob.timestamps.lastShutdownRuntime/1000)/3600, ((fob.timestamps.lastShutdownRuntime/1000) % 3600)/60);
-  else
-    M5.Lcd.println("Last Run:Unknown");
-}
-
-void lcdPrintSensors(void* arg = NULL)
-{
-  if(fob.sensors.shtAvailable && fob.sensors.sht.update())
-  {
-    if(fob.sensors.sht.fTemp > TEMPERATURE_ALERT_THRESH_F)
-    {
-      M5.Lcd.fillScreen(RED);
-      M5.Lcd.setCursor(0, 0);
-      M5.Lcd.setTextColor(WHITE, RED);
-      M5.Lcd.setTextSize(TEXT_SIZE_DEFAULT);
-      M5.Lcd.println("__OVER TEMPERATURE__\n");
-      M5.Lcd.printf("  Threshold: %dF\n\n", TEMPERATURE_ALERT_THRESH_F);
-      M5.Lcd.setTextSize(5);
-      M5.Lcd.printf(" %.2fF\n\n", fob.sensors.sht.fTemp);
-      M5.Lcd.setTextSize(TEXT_SIZE_DEFAULT);
-      M5.Lcd.setTextColor(WHITE, BLACK);
-      
-      AlertTimestamp_t aTime;
-      auto dt = M5.Rtc.getDateTime();
-      snprintf(aTime.lastTempAlertTime, sizeof(aTime.lastTempAlertTime), "%02d/%02d/%04d %02d:%02dH",
-                dt.date.date, dt.date.month, dt.date.year,
-                dt.time.hours, dt.time.minutes);
-      aTime.lastTempAlertTemp = fob.sensors.sht.fTemp;
-      aTime.lastTempAlertThresh = TEMPERATURE_ALERT_THRESH_F;
-
-      Serial.printf("Over-temperature alert\n\tThreshold: %dF\n\tTemperature: %fF\n\tTimestamp: %s\n",
-                    TEMPERATURE_ALERT_THRESH_F, aTime.lastTempAlertTemp, aTime.lastTempAlertTime);
-
-      Preferences alertPrefs;
-      if (alertPrefs.begin(TEMPERATURE_ALERT_NAMESPACE, false))
-      {
-          alertPrefs.clear();
-          if(alertPrefs.putBytes(TEMPERATURE_ALERT_NAMESPACE, &aTime, sizeof(aTime)))
-            Serial.println("Saved alert timestamp to NVS!");
-      }
-      alertPrefs.end();
-      delay(100);
-      return;
-    }
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setCursor(0, 0);
-    M5.Lcd.println("______SENSORS_______\n");
-    M5.Lcd.printf("%%RH :%.2f%% @ %.2fF\n", fob.sensors.sht.humidity, fob.sensors.sht.fTemp);
-  }
-  else
-    M5.Lcd.println("\nSHT sensor unavailable!");
-
-  if(fob.sensors.qmpAvailable && fob.sensors.qmp.update())
-  {
-    M5.Lcd.printf("Temp:%.4f C\n", fob.sensors.qmp.cTemp);
-    M5.Lcd.printf("Pres:%.4f Pa\n", fob.sensors.qmp.pressure);
-    M5.Lcd.printf("Alt :%.4f m\n", fob.sensors.qmp.altitude);
-  }
-  else
-    M5.Lcd.println("QMP sensor unavailable!\n");
-}
-
-/// @brief Get the status of WAN connections
-void printRouterWanStatus(void* arg = NULL)
-{
-  Serial.println("Getting WAN list - ");
-  M5.Lcd.setCursor(0, 0, 1);
-  M5.Lcd.println("_____WAN SUMMARY____\n");
-
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-  M5.Lcd.drawBitmap(200, cursorY, 40, 40, loading, 0);
-
-  if (!fob.routers.router.checkAvailable() || !fob.routers.router.getWanStatus())
-  {
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.fillRect(0, cursorY, M5.Lcd.width(), M5.Lcd.height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("Unavailable!");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-    return;
-  }
-  else
-  {
-    M5.Lcd.fillRect(0, cursorY, M5.Lcd.width(), M5.Lcd.height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
-    M5.Lcd.setCursor(cursorX, cursorY);
-    std::vector<PeplinkAPI_WAN *> wanList = fob.routers.router.wanStatus();
-    Serial.println(String(wanList.size()) + " elements:");
-    for (PeplinkAPI_WAN *wan : wanList)
-    {
-      Serial.print("\tname : " + wan->name);
-      Serial.print("\tstatus : " + wan->status);
-      // Serial.print("\tstatusLed : " + wan->statusLED);
-      // M5.Lcd.print(wan->name +" " + wan->status + " " + wan->statusLED + "\n");
-      if (wan->status != "Disabled")
-      {
-        // M5.Lcd.print(wan->name +" " + wan->statusLED + "\n");
-        if (wan->statusLED == "red")
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_RED);
-        if (wan->statusLED == "yellow")
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_YELLOW);
-        if (wan->statusLED == "green")
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_GREEN);
-        if (wan->statusLED == "flash")
-          M5.Lcd.setTextColor(TFT_BLACK, TFT_WHITE);
-        M5.Lcd.print(" ");
-        // M5.Lcd.print(wan->name);
-        if(wan->managementOnly)
-        {
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_ORANGE);
-          M5.Lcd.print("+");
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-          M5.Lcd.println(" " + wan->name);
-        }
-        else
-        {
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-          M5.Lcd.println("  " + wan->name);
-        }
-        M5.Lcd.println(wan->status);
-        // M5.Lcd.print(wan->name +" " + wan->status + "\n");
-      }
-      else
-      {
-        // M5.Lcd.print(wan->name +" " + wan->statusLED +" " + wan->status + "\n");
-        M5.Lcd.setTextColor(TFT_BLACK, TFT_GREY);
-        M5.Lcd.print(" ");
-        if(!wan->managementOnly)
-        {
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_ORANGE);
-          M5.Lcd.print("+");
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-          M5.Lcd.println(" " + wan->name);
-        }
-        else
-        {
-          M5.Lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-          M5.Lcd.println("  " + wan->name);
-        }
-        // M5.Lcd.setTextColor(TFT_BLACK,TFT_WHITE);
-        // M5.Lcd.print(wan->name);
-        // M5.Lcd.print(" " + wan->status + "\n");
-      }
-      switch (wan->type)
-      {
-      case PEPLINKAPI_WAN_TYPE_ETHERNET:
-        Serial.print("\ttype : ethernet");
-        if (wan->status != "Disabled")
-          Serial.print("\tip : " + wan->ip);
-        // M5.Lcd.print("IP: " + wan->ip + "\n");
-        break;
-      case PEPLINKAPI_WAN_TYPE_CELLULAR:
-      {
-        Serial.print("\ttype : cellular");
-        if (wan->status != "Disabled")
-        {
-          Serial.print("\tip : " + wan->ip);
-          Serial.print("\tcarrier: " + ((PeplinkAPI_WAN_Cellular *)wan)->carrier);
-          Serial.printf("\trssi: %d\n" + ((PeplinkAPI_WAN_Cellular *)wan)->rssi);
-          if (((PeplinkAPI_WAN_Cellular *)wan)->carrier != "")
-          {
-            M5.Lcd.print(((PeplinkAPI_WAN_Cellular *)wan)->carrier + " " );
-            M5.Lcd.setTextColor(TFT_WHITE, TFT_BLUE);
-            M5.Lcd.print(((PeplinkAPI_WAN_Cellular *)wan)->networkType);
-            M5.Lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-            switch (((PeplinkAPI_WAN_Cellular *)wan)->signalLevel)
-            {
-            case 0: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars0, 0); break;
-            case 1: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars1, 0); break;
-            case 2: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars2, 0); break;
-            case 3: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars3, 0); break;
-            default: M5.Lcd.drawBitmap(M5.Lcd.getCursorX() + 10, M5.Lcd.getCursorY() - 5, 20, 21, bars4, 0); break;
-            }
-          }
-          printSimCards(((PeplinkAPI_WAN_Cellular *)wan)->simCards);
-        }
-      }
-      break;
-      case PEPLINKAPI_WAN_TYPE_WIFI:
-      {
-        Serial.print("\ttype : wifi");
-        if (wan->status != "Disabled")
-        {
-          Serial.print("\tip : " + wan->ip);
-          Serial.print("\tstrength: " + ((PeplinkAPI_WAN_WiFi *)wan)->strength);
-          Serial.print("\tssid: " + ((PeplinkAPI_WAN_WiFi *)wan)->ssid);
-          Serial.print("\tbssid: " + ((PeplinkAPI_WAN_WiFi *)wan)->bssid);
-        }
-      }
-      break;
-      }
-      Serial.println();
-    }
-  }
-}
-
-/// @brief Print information about the fob's current status
-void lcdPrintFobInfo(void *arg = NULL)
-{
-  M5.Lcd.printf("Name:" PEPLINK_FOB_NAME "\n");
-  M5.Lcd.printf("Time:%ld\n", millis());
-  M5.Lcd.printf("HWID:0x");
-  for (size_t i = 0; i < UniqueIDsize; i++)
-    M5.Lcd.print(UniqueID[i], HEX);
-  M5.Lcd.printf("\nBATT:%u%%\n", M5.Power.getBatteryLevel());
-}
-
-/// @brief Stop the task that periodically performs HTTP requests
-void stopDataUpdate(void *arg = NULL)
-{
-  if (fob.tasks.dataUpdate)
-  {
-    vTaskDelete(fob.tasks.dataUpdate);
-    fob.tasks.dataUpdate = NULL;
-  }
-}
-
-/// @brief Check whether ping targets can be reached
-void updatePingTargetsStatus(void *arg = NULL)
-{
-  size_t targetCount = fob.pingTargets.size();
-  Serial.printf("Pinging %d targets...\n", targetCount);
-
-  for (size_t i = 0; i < targetCount; ++i)
-  {
-    if (fob.pingTargets[i].useIP)
-      fob.pingTargets[i].pingOK = Ping.ping(fob.pingTargets[i].pingIP, 5);
-    else
-      fob.pingTargets[i].pingOK = Ping.ping(fob.pingTargets[i].fqn.c_str(), 5);
-    fob.pingTargets[i].pinged = true;
-
-    if (fob.pingTargets[i].pingOK)
-      fob.menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(GREEN);
-    else
-      fob.menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(RED);
-    Serial.printf("Target %d(%s) -> ping %s\n", i, fob.pingTargets[i].pingIP.toString().c_str(), (fob.pingTargets[i].pingOK) ? "OK" : "FAIL");
-    if (fob.tasks.screenUpdate)
-      xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-  }
-}
-
-/// @brief Starts the task that periodically performs HTTP requests
-void startDataUpdate(void *arg = NULL)
-{
-  UiUpdateType ut;
-  if (fob.menu.currentPageId() == timePageId)
-    ut = UI_UPDATE_TYPE_TIME;
-  else if (fob.menu.currentPageId() == sensorsPageId)
-  {
-    ut = UI_UPDATE_TYPE_SENSORS;
-    
-    fob.sensors.shtAvailable = fob.sensors.sht.begin(&Wire, SHT3X_I2C_ADDR, 0, 26, 400000U);
-    fob.sensors.qmpAvailable = fob.sensors.qmp.begin(&Wire, QMP6988_SLAVE_ADDRESS_L, 0, 26, 400000U);
-  }
-  else if (fob.menu.currentPageId() == routerWANInfoPageId)
-    ut = UI_UPDATE_TYPE_WAN_INFO;
-  else if (fob.menu.currentPageId() == fobInfoPageId)
-    ut = UI_UPDATE_TYPE_FOB_INFO;
-  else if (fob.menu.currentPageId() == pingTargetsPageId)
-  {
-    ut = UI_UPDATE_TYPE_PING;
-    for (auto item : fob.menu.currentPage()->items())
-      item.setAuxTextBackground(MINU_BACKGROUND_COLOUR_DEFAULT);
-    fob.menu.currentPage()->highlightItem(0);
-    if (fob.tasks.screenUpdate)
-      xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-  }
-  else if(fob.menu.currentPageId() == routerWANSummaryPageId)
-    ut = UI_UPDATE_TYPE_WAN_SUMMARY;
-  else
-    return;
-
-  // If the data update task is already running, delete and create it afresh
-  stopDataUpdate();
-  xTaskCreatePinnedToCore(dataUpdateTask, "Data Update", 4096, (void *)ut, 2, &fob.tasks.dataUpdate, ARDUINO_RUNNING_CORE);
-}
-
-void startWiFiConnectCountdown(void *arg = NULL)
-{
-  if (WiFi.status() == WL_CONNECTED)
-  {
-    goToHomePage();
-    return;
-  }
-  fob.menu.pages()[countdownPageId]->setTitle("WAITING FOR WIFI");
-
-  fob.wifi.timedOut = false;
-  if (fob.menu.currentPageId() != countdownPageId)
-    goToCountdownPage();
-
-  if (fob.tasks.countdown)
-    vTaskDelete(fob.tasks.countdown);
-  xTaskCreatePinnedToCore(countdownTask, "WiFi Countdown", 4096, (void *)UI_COUNTDOWN_TYPE_WIFI, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
-
-  if (WiFi.getMode() != WIFI_MODE_STA)
-  {
-    WiFi.mode(WIFI_MODE_NULL);
-    delay(100);
-    WiFi.mode(WIFI_MODE_STA);
-
-    if (fob.wifi.usePrimarySsid)
-    {
-      Serial.printf("Connecting to Wi-Fi: SSID - '%s', Pass - '%s'\n", fob.wifi.ssidStaPrimary.c_str(), fob.wifi.passwordStaPrimary.c_str());
-      WiFi.begin(fob.wifi.ssidStaPrimary.c_str(), fob.wifi.passwordStaPrimary.c_str());
-    }
-    else
-    {
-      Serial.printf("Connecting to Wi-Fi: SSID - '%s', Pass - '%s'\n", fob.wifi.ssidStaSecondary.c_str(), fob.wifi.passwordStaSecondary.c_str());
-      WiFi.begin(fob.wifi.ssidStaSecondary.c_str(), fob.wifi.passwordStaSecondary.c_str());
-    }
-  }
-}
-
-void startRouterConnectCountdown(void *arg = NULL)
-{
-  fob.menu.pages()[countdownPageId]->setTitle("CONNECTING ROUTER");
-
-  if (fob.menu.currentPageId() != countdownPageId)
-    goToCountdownPage();
-
-  vTaskDelay(2000);
-
-  if (fob.tasks.countdown)
-    vTaskDelete(fob.tasks.countdown);
-  xTaskCreatePinnedToCore(countdownTask, "Router Countdown", 8192, (void *)UI_COUNTDOWN_TYPE_ROUTER, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
-
-}
-
-/// @brief Start the Wi-Fi access point
-void startWiFiAP(void *arg)
-{
-  if (WiFi.getMode() != WIFI_MODE_AP)
-  {
-    WiFi.mode(WIFI_MODE_NULL);
-    delay(100);
-    WiFi.mode(WIFI_MODE_AP);
-    Serial.printf("Starting softAP...\tSSID:'%s'\tPassword:'%s'\n", fob.wifi.ssidSoftAp.c_str(), fob.wifi.passwordSoftAp.c_str());
-    WiFi.softAP(fob.wifi.ssidSoftAp.c_str(), fob.wifi.passwordSoftAp.c_str());
-    fob.wifi.timedOut = true;
-  }
-  delay(1000);
-  if(!fob.servers.started)
-  {
-    fob.servers.started = true;
-    Serial.println("Starting HTTP Server");
-    startHttpServer();
-  }
-  goToWiFiPage();
-}
-
-/// @brief Fetch and display list of available sim cards
-void showSimList(void *arg)
-{
-  while (!fob.menu.rendered())
-    delay(10);
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-  Serial.println("Fetching SIM list");
-  
-  std::vector<PeplinkAPI_WAN *> wanList = fob.routers.router.wanStatus();
-  if (!wanList.size())
-  {
-    fob.menu.pages()[routerWANListPageId]->addItem(goToRouterPage, NULL, NULL);
-    Serial.println("No WAN found!");
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.println("No WAN found!");
-    return;
-  }
-  ssize_t thisItem;
-  for (PeplinkAPI_WAN *wan : wanList)
-  {
-    if(wan->type == PEPLINKAPI_WAN_TYPE_CELLULAR)
-    {
-      std::vector<PeplinkAPI_WAN_Cellular_SIM> &simList = ((PeplinkAPI_WAN_Cellular *)wan)->simCards;
-        ssize_t thisItem;
-      String simName = String();
-
-      for (auto it = 0; it < simList.size(); ++it)
-      {
-        char simId = it + 'A';
-        simName = "SIM " + String(simId);
-        simName += (simList[it].detected && simList[it].active) ? String(" (Active)") : String();
-        thisItem = fob.menu.pages()[simListPageId]->addItem(goToSimInfoPage, simName.c_str(), " ");
-        
-        if(!simList[it].detected)
-            fob.menu.pages()[simListPageId]->items()[thisItem].setAuxTextBackground(TFT_GREY);
-        else if (simList[it].active)
-            fob.menu.pages()[simListPageId]->items()[thisItem].setAuxTextBackground(GREEN);
-        else
-          fob.menu.pages()[simListPageId]->items()[thisItem].setAuxTextBackground(RED);
-      }    
-    }
-
-  }
-  fob.menu.pages()[simListPageId]->addItem(goToRouterPage, "<--", NULL);
-  fob.menu.pages()[simListPageId]->highlightItem(0);
-  if (fob.tasks.screenUpdate)
-    xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-}
-
-/// @brief Show information about a particular SIM card
-void showSimInfo(void* arg = NULL)
-{
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-  Serial.println("Fetching SIM INFO");
-  
-  std::vector<PeplinkAPI_WAN *> wanList = fob.routers.router.wanStatus();
-  if (!wanList.size())
-  {
-    Serial.println("No WAN found!");
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.println("No WAN found!");
-    return;
-  }
-  ssize_t thisItem;
-  for (PeplinkAPI_WAN *wan : wanList)
-  {
-    if(wan->type == PEPLINKAPI_WAN_TYPE_CELLULAR)
-    {
-      Serial.println("Got Cellular WAN");
-
-      std::vector<PeplinkAPI_WAN_Cellular_SIM> &simList = ((PeplinkAPI_WAN_Cellular *)wan)->simCards;
-
-      M5.Lcd.setCursor(cursorX, cursorY);
-      if(lastSelectedSim >= simList.size())
-      {
-        Serial.println("No SIM found!");
-        M5.Lcd.println("No SIM found!");
-        return;
-      }
-      M5.Lcd.printf("Name  :SIM %c\n", lastSelectedSim + 'A');
-      if(!simList[lastSelectedSim].detected)
-      {
-        M5.Lcd.setTextColor(RED, BLACK);
-        M5.Lcd.println(" (No Sim Detected)");
-        M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-        break;
-      }
-      M5.Lcd.printf("Active:%s\n", simList[lastSelectedSim].active ? "true" : "false");
-      M5.Lcd.printf("ICCID :%s\n", simList[lastSelectedSim].iccid.c_str());  
-      break;
-    }
-  }
-}
-
-/// @brief Create the list of available WANs
-void getWanList(void *arg)
-{
-  while (!fob.menu.rendered())
-    delay(10);
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-  Serial.println("Fetching WAN list");
-
-  if (!fob.routers.router.checkAvailable() || !fob.routers.router.getWanStatus())
-  {
-    Serial.println("Fetching WAN list failed!");
-    fob.menu.pages()[routerWANListPageId]->addItem(goToRouterPage, NULL, NULL);
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.setTextColor(RED, BLACK);
-    M5.Lcd.println("Unavailable!");
-    M5.Lcd.setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
-    return;
-  }
-
-  std::vector<PeplinkAPI_WAN *> wanList = fob.routers.router.wanStatus();
-  if (!wanList.size())
-  {
-    fob.menu.pages()[routerWANListPageId]->addItem(goToRouterPage, NULL, NULL);
-    Serial.println("No WAN found!");
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.println("No WAN found!");
-    return;
-  }
-  ssize_t thisItem;
-  for (PeplinkAPI_WAN *wan : wanList)
-  {
-    thisItem = fob.menu.pages()[routerWANListPageId]->addItem(goToRouterWANInfoPage, wan->name.c_str(), " ");
-
-    if (!strcmp(wan->statusLED.c_str(), "red"))
-      fob.menu.pages()[routerWANListPageId]->items()[thisItem].setAuxTextBackground(RED);
-    else if (!strcmp(wan->statusLED.c_str(), "yellow"))
-      fob.menu.pages()[routerWANListPageId]->items()[thisItem].setAuxTextBackground(YELLOW);
-    else if (!strcmp(wan->statusLED.c_str(), "green"))
-      fob.menu.pages()[routerWANListPageId]->items()[thisItem].setAuxTextBackground(GREEN);
-    else if (!strcmp(wan->statusLED.c_str(), "flash"))
-      fob.menu.pages()[routerWANListPageId]->items()[thisItem].setAuxTextBackground(WHITE);
-    else
-      fob.menu.pages()[routerWANListPageId]->items()[thisItem].setAuxTextBackground(TFT_GREY);
-  }
-  fob.menu.pages()[routerWANListPageId]->addItem(goToWANSummaryPage, "WAN Summary", NULL);
-  fob.menu.pages()[routerWANListPageId]->addItem(goToSimListPage, "SIM Cards", NULL);
-  fob.menu.pages()[routerWANListPageId]->addItem(goToRouterPage, "<--", NULL);
-  fob.menu.pages()[routerWANListPageId]->highlightItem(0);
-  if (fob.tasks.screenUpdate)
-    xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-}
-
-/// @brief Stop waiting for Wi-Fi to connect and go to homepage
-void cancelWiFiSetup(void *arg)
-{
-  fob.wifi.usePrimarySsid = true;
-  WiFi.mode(WIFI_MODE_NULL);
-  if(fob.booting || lastVisitedPageId == countdownPageId)
-    fob.menu.goToPage(homePageId);
-  else
-    fob.menu.goToPage(lastVisitedPageId);
-}
-
-/// @brief Save the selected SSID as primary or secondary
-void saveSSID(void *arg)
-{
-  if (!arg)
-    return;
-
-  MinuPageItem *thisItem = (MinuPageItem *)arg;
-
-  Serial.printf("Saved %s SSID: '%s'\n", thisItem->mainText(), tempSSID.c_str());
-  if (!strcmp(thisItem->mainText(), "Primary"))
-  {
-    fob.wifi.ssidStaPrimary = tempSSID;
-    fob.wifi.usePrimarySsid = true;
-  }
-  else
-    fob.wifi.ssidStaSecondary = tempSSID;
-  savePreferences();
-  goToWiFiPage();
-}
-
-/// @brief Save selected SSID
-void saveItemSSID(void *arg)
-{
-  if (!arg)
-    return;
-
-  MinuPageItem *thisItem = (MinuPageItem *)arg;
-  tempSSID = thisItem->mainText();
-
-  fob.menu.goToPage(saveSSIDAsPageId);
-}
-
-/// @brief Delete all child items of a menu page
-void deleteAllPageItems(void *arg)
-{
-  if (!arg)
-    return;
-
-  MinuPage *thisPage = (MinuPage *)arg;
-  thisPage->removeAllItems();
-}
-
-void wanListPageClosed(void *arg)
-{
-  if (!arg)
-    return;
-  MinuPage *thisPage = (MinuPage *)arg;
-  lastSelectedWAN = thisPage->highlightedItem().mainText();
-  deleteAllPageItems(arg);
-}
-
-void simListPageClosed(void *arg)
-{
-  if (!arg)
-    return;
-  MinuPage *thisPage = (MinuPage *)arg;
-  lastSelectedSim = thisPage->highlightedIndex();
-  deleteAllPageItems(arg);
-}
-
-/// @brief Perform a Wi-Fi scan
-void startWiFiScan(void *arg)
-{
-  goToScanResultPage();
-  if (fob.tasks.screenUpdate)
-    xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-  while (!fob.menu.rendered())
-    delay(10);
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-
-  fob.wifi.timedOut = true;
-  WiFi.mode(WIFI_MODE_NULL);
-  delay(100);
-  WiFi.mode(WIFI_MODE_STA);
-
-  M5.Lcd.println("Scanning...");
-  int n = WiFi.scanNetworks();
-  M5.Lcd.setCursor(cursorX, cursorY);
-  M5.Lcd.print("Scan ");
-
-  if (n == 0)
-    M5.Lcd.println("done. 0 found.");
-  else if (n < 0)
-    M5.Lcd.printf("error %d!\n", n);
-  else if (n > 0)
-  {
-    M5.Lcd.printf("done. %d found\n", n);
-
-    for (int i = 0; i < n; ++i)
-      fob.menu.pages()[scanResultPageId]->addItem(saveItemSSID, WiFi.SSID(i).c_str(), String(WiFi.RSSI(i)).c_str());
-
-    WiFi.scanDelete();
-  }
-    
-  delay(3000);
-  fob.menu.pages()[scanResultPageId]->addItem(goToWiFiPage, "<--", NULL);
-  if (fob.tasks.screenUpdate)
-    xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-    
-  while (!fob.menu.rendered())
-    delay(10);
-}
-
-void startShutdownCountdown(void *arg = NULL)
-{
-  fob.menu.pages()[countdownPageId]->setTitle("SHUTDOWN");
-  if (fob.menu.currentPageId() != countdownPageId)
-    goToCountdownPage();
-
-  if (fob.tasks.countdown)
-    vTaskDelete(fob.tasks.countdown);
-  xTaskCreatePinnedToCore(countdownTask, "Shutdown Countdown", 2048, (void *)UI_COUNTDOWN_TYPE_SHUTDOWN, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
-}
-
-void startRebootCountdown(void *arg = NULL)
-{
-  fob.menu.pages()[countdownPageId]->setTitle("REBOOT");
-  if (fob.menu.currentPageId() != countdownPageId)
-    goToCountdownPage();
-
-  if (fob.tasks.countdown)
-    vTaskDelete(fob.tasks.countdown);
-  xTaskCreatePinnedToCore(countdownTask, "Reboot Countdown", 2048, (void *)UI_COUNTDOWN_TYPE_REBOOT, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
-}
-
-void startFactoryResetCountdown(void *arg = NULL)
-{
-  fob.menu.pages()[countdownPageId]->setTitle("FACTORY RESET REBOOT");
-  if (fob.menu.currentPageId() != countdownPageId)
-    goToCountdownPage();
-
-  if (fob.tasks.countdown)
-    vTaskDelete(fob.tasks.countdown);
-  xTaskCreatePinnedToCore(countdownTask, "Reset Countdown", 2048, (void *)UI_COUNTDOWN_TYPE_FACTORY_RESET, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
-}
-
-void initiateFactoryReset(void *arg = NULL)
-{
-  resetPreferences();
-  savePreferences();
-  startFactoryResetCountdown();
-}
-
-void startRouterRemoteReboot(void *arg = NULL)
-{
-  fob.routers.router.remoterReboot();
-}
-
-void uiMenuInit(void)
-{
-  MinuPage countdownPage(NULL, fob.menu.numPages());
-  countdownPage.setOpenedCallback(pageOpenedCallback);
-  countdownPage.setClosedCallback(pageClosedCallback);
-  countdownPage.setRenderedCallback(pageRenderedCallback);
-  countdownPageId = fob.menu.addPage(countdownPage);
-
-  MinuPage homePage("1SIMPLECONNECT", fob.menu.numPages());
-  homepageWifiItem = homePage.addItem(goToWiFiPage, "Wi-Fi", " ", updateWiFiItem);
-  homePage.addItem(goToPingTargetsPage, "Network Diags", NULL);
-  homePage.addItem(goToRouterPage, "Router", NULL);
-  homePage.addItem(goToTimePage, "Time", NULL);
-  homePage.addItem(goToSensorsPage, "Sensors", NULL);
-  homePage.addItem(goToFobInfoPage, "Fob Info", NULL);
-  homePage.addItem(startShutdownCountdown, "ShutDown", NULL);
-  homePage.addItem(startRebootCountdown, "Reboot", NULL);
-  homePage.addItem(goToFactoryResetPage, "Factory Reset", NULL);
-  homePage.setOpenedCallback(pageOpenedCallback);
-  homePage.setClosedCallback(pageClosedCallback);
-  homePage.setRenderedCallback(pageRenderedCallback);
-  homePageId = fob.menu.addPage(homePage);
-
-  MinuPage wifiPage("WI-FI", fob.menu.numPages());
-  wifiPage.addItem(startWiFiConnectCountdown, "Connect STA", NULL);
-  wifiPage.addItem(startWiFiAP, "Start AP", NULL);
-  wifiPage.addItem(startWiFiScan, "Scan", NULL);
-  wifiStatusItem = wifiPage.addItem(goToHomePage, "<--", NULL);
-  wifiPage.setOpenedCallback(pageOpenedCallback);
-  wifiPage.setClosedCallback(pageClosedCallback);
-  wifiPage.setRenderedCallback(lcdPrintWiFiStatus);
-  wifiPageId = fob.menu.addPage(wifiPage);
-
-  MinuPage wifiPromptPage("WI-FI DISCON", fob.menu.numPages());
-  wifiPromptPage.addItem(startWiFiConnectCountdown, "Retry STA", NULL);
-  wifiPromptPage.addItem(startWiFiAP, "Start AP", NULL);
-  wifiPromptPage.addItem(cancelWiFiSetup, "Cancel", NULL);
-  wifiPromptPage.setOpenedCallback(pageOpenedCallback);
-  wifiPromptPage.setClosedCallback(pageClosedCallback);
-  wifiPromptPage.setRenderedCallback(pageRenderedCallback);
-  wifiPromptPageId = fob.menu.addPage(wifiPromptPage);
-
-  MinuPage saveSSIDAsPage("SAVE SSID AS", fob.menu.numPages());
-  saveSSIDAsPage.addItem(saveSSID, "Primary", NULL);
-  saveSSIDAsPage.addItem(saveSSID, "Secondary", NULL);
-  saveSSIDAsPage.addItem(goToWiFiPage, "<--", NULL);
-  saveSSIDAsPage.setOpenedCallback(pageOpenedCallback);
-  saveSSIDAsPage.setClosedCallback(pageClosedCallback);
-  saveSSIDAsPage.setRenderedCallback(pageRenderedCallback);
-  saveSSIDAsPageId = fob.menu.addPage(saveSSIDAsPage);
-
-  MinuPage scanResultPage("SCAN RESULT", fob.menu.numPages());
-  scanResultPage.setOpenedCallback(pageOpenedCallback);
-  scanResultPage.setClosedCallback(deleteAllPageItems);
-  scanResultPage.setRenderedCallback(pageRenderedCallback);
-  scanResultPageId = fob.menu.addPage(scanResultPage);
-
-  MinuPage pingTargetsPage("NETWORK DIAG", fob.menu.numPages());
-  for (PingTarget target : fob.pingTargets)
-    pingTargetsPage.addItem(NULL, target.displayHostname.c_str(), " ");
-  pingTargetsPage.addItem(goToHomePage, "<--", NULL);
-  pingTargetsPage.setOpenedCallback(startDataUpdate);
-  pingTargetsPage.setClosedCallback(stopDataUpdate);
-  pingTargetsPage.setRenderedCallback(pageRenderedCallback);
-  pingTargetsPageId = fob.menu.addPage(pingTargetsPage);
-
-  MinuPage routerPage("ROUTER", fob.menu.numPages());
-  routerPage.addItem(goToRouterInfoPage, "Info", NULL);
-  routerPage.addItem(goToRouterLocationPage, "Location", NULL);
-  routerPage.addItem(goToRouterWANListPage, "WAN Status", NULL);
-  routerPage.addItem(startRouterRemoteReboot, "Remote Reboot", NULL);
-  routerPage.addItem(goToHomePage, "<--", NULL);
-  routerPage.setOpenedCallback(pageOpenedCallback);
-  routerPage.setClosedCallback(pageClosedCallback);
-  routerPage.setRenderedCallback(pageRenderedCallback);
-  routerPageId = fob.menu.addPage(routerPage);
-
-  MinuPage routerInfoPage("ROUTER INFO", fob.menu.numPages(), true);
-  routerInfoPage.addItem(goToRouterPage, NULL, NULL);
-  routerInfoPage.setOpenedCallback(pageOpenedCallback);
-  routerInfoPage.setClosedCallback(pageClosedCallback);
-  routerInfoPage.setRenderedCallback(lcdPrintRouterInfo);
-  routerInfoPageId = fob.menu.addPage(routerInfoPage);
-
-  MinuPage routerLocationPage("ROUTER LOCATION", fob.menu.numPages(), true);
-  routerLocationPage.addItem(goToRouterPage, NULL, NULL);
-  routerLocationPage.setOpenedCallback(pageOpenedCallback);
-  routerLocationPage.setClosedCallback(pageClosedCallback);
-  routerLocationPage.setRenderedCallback(lcdPrintRouterLocation);
-  routerLocationPageId = fob.menu.addPage(routerLocationPage);
-
-  MinuPage routerUnavailablePage("ROUTER UNAVAILABLE", fob.menu.numPages(), true);
-  routerUnavailablePage.addItem(goToHomePage, NULL, NULL);
-  routerUnavailablePage.setOpenedCallback(pageOpenedCallback);
-  routerUnavailablePage.setClosedCallback(pageClosedCallback);
-  routerUnavailablePage.setRenderedCallback(lcdPrintRouterUnavailable);
-  routerUnavailablePageId = fob.menu.addPage(routerUnavailablePage);
-
-  MinuPage routerWANListPage("WAN LIST", fob.menu.numPages());
-  routerWANListPage.setOpenedCallback(getWanList);
-  routerWANListPage.setClosedCallback(wanListPageClosed);
-  routerWANListPage.setRenderedCallback(pageRenderedCallback);
-  routerWANListPageId = fob.menu.addPage(routerWANListPage);
-
-  MinuPage routerWANInfoPage("WAN STATUS", fob.menu.numPages(), true);
-  routerWANInfoPage.addItem(goToRouterWANListPage, NULL, NULL);
-  routerWANInfoPage.setOpenedCallback(pageOpenedCallback);
-  routerWANInfoPage.setClosedCallback(stopDataUpdate);
-  routerWANInfoPage.setRenderedCallback(startDataUpdate);
-  routerWANInfoPageId = fob.menu.addPage(routerWANInfoPage);
-
-  MinuPage routerWANSummaryPage("WAN STATUS", fob.menu.numPages(), true);
-  routerWANSummaryPage.addItem(goToRouterWANListPage, NULL, NULL);
-  routerWANSummaryPage.setOpenedCallback(pageOpenedCallback);
-  routerWANSummaryPage.setClosedCallback(stopDataUpdate);
-  routerWANSummaryPage.setRenderedCallback(startDataUpdate);
-  routerWANSummaryPageId = fob.menu.addPage(routerWANSummaryPage);
-
-  MinuPage simListPage("SIM LIST", fob.menu.numPages());
-  simListPage.setOpenedCallback(showSimList);
-  simListPage.setClosedCallback(simListPageClosed);
-  simListPage.setRenderedCallback(pageRenderedCallback);
-  simListPageId = fob.menu.addPage(simListPage);
-
-  MinuPage simInfoPage("SIM STATUS", fob.menu.numPages(), true);
-  simInfoPage.addItem(goToSimListPage, NULL, NULL);
-  simInfoPage.setOpenedCallback(pageOpenedCallback);
-  simInfoPage.setClosedCallback(pageClosedCallback);
-  simInfoPage.setRenderedCallback(showSimInfo);
-  simInfoPageId = fob.menu.addPage(simInfoPage);
-
-  MinuPage sensorsPage("SENSORS", fob.menu.numPages(), true);
-  sensorsPage.addItem(goToHomePage, NULL, NULL);
-  sensorsPage.setOpenedCallback(pageOpenedCallback);
-  sensorsPage.setClosedCallback(stopDataUpdate);
-  sensorsPage.setRenderedCallback(startDataUpdate);
-  sensorsPageId = fob.menu.addPage(sensorsPage);
-
-  MinuPage timePage("TIME", fob.menu.numPages(), true);
-  timePage.addItem(goToHomePage, NULL, NULL);
-  timePage.setOpenedCallback(pageOpenedCallback);
-  timePage.setClosedCallback(stopDataUpdate);
-  timePage.setRenderedCallback(startDataUpdate);
-  timePageId = fob.menu.addPage(timePage);
-
-  MinuPage fobInfoPage("FOB INFO", fob.menu.numPages(), true);
-  fobInfoPage.addItem(goToHomePage, NULL, NULL);
-  fobInfoPage.setOpenedCallback(pageOpenedCallback);
-  fobInfoPage.setClosedCallback(stopDataUpdate);
-  fobInfoPage.setRenderedCallback(startDataUpdate);
-  fobInfoPageId = fob.menu.addPage(fobInfoPage);
-
-  MinuPage factoryResetPage("FACTORY RESET", fob.menu.numPages());
-  factoryResetPage.addItem(initiateFactoryReset, "Factory Reset", NULL);
-  factoryResetPage.addItem(goToHomePage, "Cancel", NULL);
-  factoryResetPage.setOpenedCallback(pageOpenedCallback);
-  factoryResetPage.setClosedCallback(pageClosedCallback);
-  factoryResetPage.setRenderedCallback(pageRenderedCallback);
-  factoryResetPageId = fob.menu.addPage(factoryResetPage);
-
-  String cookie;
-   if ( homePageId < 0 ||
-        wifiPageId < 0 ||
-        wifiPromptPageId < 0 ||
-        scanResultPageId < 0 ||
-        saveSSIDAsPageId < 0 ||
-        routerPageId < 0 ||
-        routerInfoPageId < 0 ||
-        routerLocationPageId < 0 ||
-        routerUnavailablePageId < 0 ||
-        routerWANListPageId < 0 ||
-        routerWANInfoPageId < 0 ||
-        timePageId < 0 ||
-        countdownPageId < 0 ||
-        fobInfoPageId < 0)
-      goto err;
-      
-   lastVisitedPageId = wifiPageId;
-
-  xTaskCreatePinnedToCore(screenWatchTask, "Screen Watch Task", 4096, NULL, 1, &fob.tasks.screenWatch, ARDUINO_RUNNING_CORE);
-  xTaskCreatePinnedToCore(screenUpdateTask, "Screen Update Task", 4096, NULL, 1, &fob.tasks.screenUpdate, ARDUINO_RUNNING_CORE);
-  xTaskCreatePinnedToCore(buttonWatchTask, "Button Task", 4096, NULL, 1, &fob.tasks.buttonWatch, ARDUINO_RUNNING_CORE);
-  xTaskCreatePinnedToCore(wifiWatchTask, "WiFi Watch Task", 2048, NULL, 1, &fob.tasks.wifiWatch, ARDUINO_RUNNING_CORE);
-  xTaskCreatePinnedToCore(routerConnectTask, "Router connect", 2048, NULL, 1, &fob.tasks.routerConnect, ARDUINO_RUNNING_CORE);
-  startWiFiConnectCountdown();
-
-  while(fob.booting)
-    delay(10);
-
-  if (WiFi.status() == WL_CONNECTED)
-  {
-    fob.routers.router.setIP(fob.routers.ip);
-    fob.routers.router.setPort(fob.routers.port);
-    cookie = fob.routers.router.begin(fob.routers.username, fob.routers.password, fob.routers.clientName, fob.routers.clientScope, true);
-    if (!cookie.length())
-      Serial.println("!!Router init Fail!!");
-    else
-    {
-      Serial.println("Router connected!");
-      if(fob.menu.currentPageId() == pingTargetsPageId)
-        goToRouterWANListPage();
-    }
-  }
-  return;
-
-err:
-  while (1)
-  {
-    delay(1000);
-    Serial.println("Failed to init menu!");
-  }
-}
-
-/// @brief Watch for any detected button press and manipulate UI accordingly
-void screenWatchTask(void *arg)
-{
-  Serial.println("Started screenWatchTask");
-  ssize_t lastSelectedPage = fob.menu.currentPageId();
-  ssize_t lastHighlightedItem = fob.menu.currentPage()->highlightedIndex();
-
-  bool updateScreen = false;
-  long lastStackCheckTime = 0;
-
-  for (;;)
-  {
-    // If a short press of A is detected, highlight the next item
-    if (fob.buttons.btnPressA == STARLINKFOB_BUTTONPRESS_SHORT)
-    {
-#ifdef UI_BEEP
-      M5.Speaker.tone(8000, 30);
-#endif
-      if (fob.menu.currentPageId() != countdownPageId)
-      {  
-        fob.menu.currentPage()->highlightNextItem();
-        if(lastHighlightedItem != fob.menu.currentPage()->highlightedIndex())
-          updateScreen = true;
-      }
-      fob.buttons.btnPressA = STARLINKFOB_BUTTONPRESS_NONE;
-    }
-
-    // If a long press of A or short press of B is detected, select the currently highlighted item
-    if (fob.buttons.btnPressA == STARLINKFOB_BUTTONPRESS_LONG || fob.buttons.btnPressB == STARLINKFOB_BUTTONPRESS_SHORT)
-    {
-#ifdef UI_BEEP
-      M5.Speaker.tone(5000, 30);
-#endif
-      if (fob.menu.currentPageId() != countdownPageId && fob.menu.currentPage()->highlightedIndex() >= 0)
-      {
-        MinuPageItem highlightedItem = fob.menu.currentPage()->highlightedItem();
-        if (highlightedItem.link())
-          highlightedItem.link()(&highlightedItem);
-#ifdef UI_DEBUG_LOG
-        Serial.printf("Executed selected item link = %p\n", highlightedItem.link());
-#endif
-      }
-
-      fob.buttons.btnPressA = STARLINKFOB_BUTTONPRESS_NONE;
-      fob.buttons.btnPressB = STARLINKFOB_BUTTONPRESS_NONE;
-    }
-
-    // If a long press of B is detected, cancel any ongoing shutdown
-    if (fob.buttons.btnPressB == STARLINKFOB_BUTTONPRESS_LONG)
-    {
-      if (fob.tasks.countdown)
-        xTaskNotify(fob.tasks.countdown, 1, eSetValueWithOverwrite);
-
-      fob.buttons.btnPressB = STARLINKFOB_BUTTONPRESS_NONE;
-    }
-
-    if (fob.buttons.btnPressC == STARLINKFOB_BUTTONPRESS_SHORT)
-    {
-      if(!fob.booting && lastVisitedPageId != countdownPageId && lastVisitedPageId != scanResultPageId)
-      {
-        size_t tmp = lastSelectedPage;
-        lastSelectedPage = fob.menu.currentPageId();
-        fob.menu.goToPage(tmp);
-      }
-
-      fob.buttons.btnPressC = STARLINKFOB_BUTTONPRESS_NONE;
-    }
-
-    // If the current page has changed, log the change
-    if (lastSelectedPage != fob.menu.currentPageId())
-    {
-#ifdef UI_DEBUG_LOG
-      Serial.printf("Changed from page %d to page %d\n", lastSelectedPage, fob.menu.currentPageId());
-#endif
-      lastVisitedPageId = lastSelectedPage;
-      lastSelectedPage = fob.menu.currentPageId();
-      lastHighlightedItem = fob.menu.currentPage()->highlightedIndex();
-    }
-
-    // If the current page has changed, log the change
-    if (lastHighlightedItem != fob.menu.currentPage()->highlightedIndex())
-    {
-#ifdef UI_DEBUG_LOG
-      Serial.printf("Highlighted item changed: Old = %d | New = %d\n", lastHighlightedItem, fob.menu.currentPage()->highlightedIndex());
-#endif
-      lastHighlightedItem = fob.menu.currentPage()->highlightedIndex();
-    }
-
-    if (updateScreen || !fob.menu.rendered())
-    {
-      updateScreen = false;
-      if (fob.tasks.countdown && fob.menu.currentPageId() != countdownPageId)
-      {
-        vTaskDelete(fob.tasks.countdown);
-        fob.tasks.countdown = NULL;
-      }
-
-      if (fob.tasks.screenUpdate)
-        xTaskNotify(fob.tasks.screenUpdate, 1, eSetValueWithOverwrite);
-      while(!fob.menu.rendered())
-        delay(10);
-    }
-
-#ifdef UI_DEBUG_LOG
-    if (lastStackCheckTime + 10000 < millis())
-    {
-      Serial.printf("Screen Watch Task available stack:  %d * %d bytes\n", uxTaskGetStackHighWaterMark(NULL), sizeof(portBASE_TYPE));
-      lastStackCheckTime = millis();
-    }
-#endif
-  }
-}
-
-void buttonWatchTask(void *arg)
-{
-  Serial.println("buttonWatchTask started");
-
-  long lastStackCheckTime = 0;
-  long currentTime = 0;
-  bool beepA = true;
-  bool beepB = true;
-
-  for (;;)
-  {
-    M5.update();
-    currentTime = millis();
-    if (M5.BtnA.wasPressed())
-    {
-      fob.buttons.lastPressTimeA = currentTime;
-      fob.buttons.isPressedA = true;
-    }
-    
-    if(fob.buttons.isPressedA && beepA && (currentTime - fob.buttons.lastPressTimeA) >= LONG_PRESS_THRESHOLD_MS)
-    {
-      beepA = false;
-      M5.Speaker.tone(9000, 50);
-    }
-
-    if (M5.BtnA.wasReleased())
-    {
-      fob.buttons.isPressedA = false;
-      fob.buttons.pressDurationA = currentTime - fob.buttons.lastPressTimeA;
-      if (fob.buttons.pressDurationA > LONG_PRESS_THRESHOLD_MS)
-      {
-        fob.buttons.btnPressA = STARLINKFOB_BUTTONPRESS_LONG;
-#ifdef UI_DEBUG_LOG
-        Serial.print("Long");
-#endif
-      }
-      else
-      {
-        fob.buttons.btnPressA = STARLINKFOB_BUTTONPRESS_SHORT;
-#ifdef UI_DEBUG_LOG
-        Serial.print("Short");
-#endif
-      }
-#ifdef UI_DEBUG_LOG
-      Serial.printf(" press A: %lums\n", fob.buttons.pressDurationA);
-#endif
-      beepA = true;
-    }
-
-    if (M5.BtnB.wasPressed())
-    {
-      fob.buttons.lastPressTimeB = currentTime;
-      fob.buttons.isPressedB = true;
-    }
-    
-    if(fob.buttons.isPressedB && beepB && (currentTime - fob.buttons.lastPressTimeB) >= LONG_PRESS_THRESHOLD_MS)
-    {
-      beepB = false;
-      M5.Speaker.tone(7000, 50);
-    }
-
-    if (M5.BtnB.wasReleased())
-    {
-      fob.buttons.isPressedB = false;
-      fob.buttons.pressDurationB = currentTime - fob.buttons.lastPressTimeB;
-      if (fob.buttons.pressDurationB > LONG_PRESS_THRESHOLD_MS)
-      {
-        fob.buttons.btnPressB = STARLINKFOB_BUTTONPRESS_LONG;
-#ifdef UI_DEBUG_LOG
-        Serial.print("Long");
-#endif
-      }
-      else
-      {
-        fob.buttons.btnPressB = STARLINKFOB_BUTTONPRESS_SHORT;
-#ifdef UI_DEBUG_LOG
-        Serial.print("Short");
-#endif
-      }
-#ifdef UI_DEBUG_LOG
-      Serial.printf(" press B: %lums\n", fob.buttons.pressDurationB);
-#endif
-      beepB = true;
-    }
-
-    if (M5.BtnPWR.wasPressed())
-      fob.buttons.lastPressTimeC = currentTime;
-
-    if (M5.BtnPWR.wasReleased())
-    {
-      fob.buttons.pressDurationC = currentTime - fob.buttons.lastPressTimeC;
-      if (fob.buttons.pressDurationC > LONG_PRESS_THRESHOLD_MS)
-      {
-        fob.buttons.btnPressC = STARLINKFOB_BUTTONPRESS_LONG;
-#ifdef UI_DEBUG_LOG
-        Serial.print("Long");
-#endif
-      }
-      else
-      {
-        fob.buttons.btnPressC = STARLINKFOB_BUTTONPRESS_SHORT;
-#ifdef UI_DEBUG_LOG
-        Serial.print("Short");
-#endif
-      }
-#ifdef UI_DEBUG_LOG
-      Serial.printf(" press C: %lums\n", fob.buttons.pressDurationC);
-#endif
-    }
-
-#ifdef UI_DEBUG_LOG
-    if (lastStackCheckTime + 10000 < currentTime)
-    {
-      Serial.printf("Button Watch Task available stack:  %d * %d bytes\n", uxTaskGetStackHighWaterMark(NULL), sizeof(portBASE_TYPE));
-      lastStackCheckTime = currentTime;
-    }
-#endif
-  }
-}
-
-void countdownTask(void *arg)
-{
-  int8_t sec = 0, min = 0;
-  const int countdownType = (int)arg;
-  uint32_t stopCountdown;
-
-  if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
-  {
-    min = fob.wifi.timeoutMs ? (fob.wifi.timeoutMs / 1000) / 60 : WIFI_COUNTDOWN_SECONDS / 60;
-    sec = fob.wifi.timeoutMs ? (fob.wifi.timeoutMs / 1000) % 60 : WIFI_COUNTDOWN_SECONDS % 60;
-  }
-  else if (countdownType == UI_COUNTDOWN_TYPE_SHUTDOWN)
-  {
-    min = SHUTDOWN_COUNTDOWN_SECONDS / 60;
-    sec = SHUTDOWN_COUNTDOWN_SECONDS % 60;
-  }
-  else if (countdownType == UI_COUNTDOWN_TYPE_REBOOT)
-  {
-    min = REBOOT_COUNTDOWN_SECONDS / 60;
-    sec = REBOOT_COUNTDOWN_SECONDS % 60;
-  }
-  else if( countdownType == UI_COUNTDOWN_TYPE_FACTORY_RESET)
-  {
-    min = REBOOT_COUNTDOWN_SECONDS / 60;
-    sec = REBOOT_COUNTDOWN_SECONDS % 60;
-  }
-  else if( countdownType == UI_COUNTDOWN_TYPE_ROUTER)
-  {
-    min = WIFI_COUNTDOWN_SECONDS / 60;
-    sec = WIFI_COUNTDOWN_SECONDS % 60;
-  }
-  else
-  {
-#ifdef UI_DEBUG_LOG
-    Serial.println("Unspecified countdown type!");
-#endif
-    vTaskDelete(NULL);
-  }
-
-  while (!fob.menu.rendered())
-    delay(10);
-
-  if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
-    M5.Lcd.printf("SSID: %s\n\n", (fob.wifi.usePrimarySsid) ? fob.wifi.ssidStaPrimary.c_str() : fob.wifi.ssidStaSecondary.c_str());
-
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-
-
-  M5.Lcd.fillRect(0, cursorY, M5.Lcd.width(), M5.Lcd.height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
-
-  while (min >= 0 || sec >= 0)
-  {
-    if (countdownType == UI_COUNTDOWN_TYPE_WIFI && WiFi.status() == WL_CONNECTED)
-      break;
-    else if(countdownType == UI_COUNTDOWN_TYPE_ROUTER && fob.routers.router.available())
-      break;
-
-    if (--sec < 0)
-    {
-      if (min > 0)
-        sec = 59;
-      else
-      {
-        sec = 0;
-        break;
-      }
-      if (--min < 0)
-        min = 0;
-    }
-
-    M5.Lcd.setCursor(cursorX, cursorY);
-    M5.Lcd.setTextSize(7);
-    M5.Lcd.printf(" %d:%02d\n\n", min, sec);
-#ifdef UI_BEEP
-    M5.Speaker.tone(9000, 50);
-#endif
-    stopCountdown = ulTaskNotifyTake(false, pdMS_TO_TICKS(1000));
-    if (stopCountdown == 1)
-      break;
-  }
-
-  M5.Lcd.setTextSize(TEXT_SIZE_DEFAULT);
-
-  if (sec <= 0 && min <= 0)
-  {
-    if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
-    {
-      if (fob.wifi.usePrimarySsid)
-      {
-        fob.wifi.usePrimarySsid = false;
-        // WiFi.mode(WIFI_MODE_NULL);
-        // delay(100);
-        fob.menu.goToPage(lastVisitedPageId);
-        xTaskNotify(fob.tasks.wifiWatch, 1, eSetValueWithOverwrite);
-      }
-      else
-      {
-        fob.wifi.timedOut = true;
-        goToWiFiPromptPage();
-      }
-
-    }
-    else if (countdownType == UI_COUNTDOWN_TYPE_SHUTDOWN)
-    {
-      ShutdownTimestamp_t sTime;
-      auto dt = M5.Rtc.getDateTime();
-      snprintf(sTime.lastShutdownTime, sizeof(sTime.lastShutdownTime), "%02d/%02d/%04d %02d:%02dH",
-                dt.date.date, dt.date.month, dt.date.year,
-                dt.time.hours, dt.time.minutes);
-      snprintf(sTime.lastShutdownTimezone, sizeof(sTime.lastShutdownTimezone), "%s", TIMEZONE);
-      sTime.lastShutdownRuntime = millis();
-
-      Serial.println("Saving shutdown details:");
-      Serial.printf("\tRuntime: %"PRId64"\n", sTime.lastShutdownRuntime);
-      Serial.printf("\tTime: %s\n", sTime.lastShutdownTime);
-      Serial.printf("\tTimezone: %s\n",  sTime.lastShutdownTimezone);
-
-      Preferences timePrefs;
-      if (timePrefs.begin(TIMESTAMP_NAMESPACE, false))
-      {
-          timePrefs.clear();
-          if(timePrefs.putBytes(TIMESTAMP_NAMESPACE, &sTime, sizeof(sTime)))
-            Serial.println("Saved timestamps to storage...shutting down now!");
-      }
-      timePrefs.end();
-      delay(100);
-      M5.Power.powerOff();
-    }
-    else if (countdownType == UI_COUNTDOWN_TYPE_REBOOT)
-      ESP.restart();
-    else if (countdownType == UI_COUNTDOWN_TYPE_ROUTER)
-      goToRouterUnavailablePage();
-  }
-  else
-  {
-    if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
-    {
-      if (stopCountdown)
-      {
-        fob.wifi.timedOut = true;
-        goToWiFiPromptPage();
-      }
-      else if (fob.booting)
-      {  
-        M5.Lcd.clear();
-        M5.Lcd.setCursor(0, cursorY);
-        M5.Lcd.printf(" Connected to WiFi:\n %s\n", (fob.wifi.usePrimarySsid) ? fob.wifi.ssidStaPrimary.c_str() : fob.wifi.ssidStaSecondary.c_str());
-        vTaskDelay(2000);
-        if(!fob.servers.started)
-        {
-          fob.servers.started = true;
-          Serial.println("Starting HTTP Server");
-          startHttpServer();
-        }
-        goToPingTargetsPage();
-        xTaskNotify(fob.tasks.wifiWatch, 1, eSetValueWithOverwrite);
-        xTaskNotify(fob.tasks.routerConnect, 1, eSetValueWithOverwrite);
-      }
-      else
-      {  
-        M5.Lcd.clear();
-        M5.Lcd.setCursor(0, cursorY);
-        M5.Lcd.printf(" Connected to WiFi:\n %s\n", (fob.wifi.usePrimarySsid) ? fob.wifi.ssidStaPrimary.c_str() : fob.wifi.ssidStaSecondary.c_str());
-        vTaskDelay(2000);
-        fob.menu.goToPage(lastVisitedPageId);
-      }
-    }
-    else if (countdownType == UI_COUNTDOWN_TYPE_SHUTDOWN || countdownType == UI_COUNTDOWN_TYPE_REBOOT)
-      goToHomePage();
-    else if (countdownType == UI_COUNTDOWN_TYPE_ROUTER)
-    {
-      if (stopCountdown)
-        goToRouterUnavailablePage();
-      else if(lastVisitedPageId == pingTargetsPageId)
-        goToRouterWANListPage();
-      else
-        fob.menu.goToPage(lastVisitedPageId);
-    }
-  }
-
-#ifdef UI_BEEP
-  M5.Speaker.tone(9000, 300);
-#endif
-
-  fob.tasks.countdown = NULL;
-  vTaskDelete(NULL);
-}
-
-void dataUpdateTask(void *arg)
-{
-  while (!fob.menu.rendered())
-    delay(10);
-  
-  const int cursorX = M5.Lcd.getCursorX();
-  const int cursorY = M5.Lcd.getCursorY();
-
-  int updateType = (int)arg;
-#ifdef UI_DEBUG_LOG
-  Serial.printf("Started data update task: type %d\n", updateType);
-#endif
-  M5.Lcd.fillRect(0, cursorY, M5.Lcd.width(), M5.Lcd.height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
-  if(updateType == UI_UPDATE_TYPE_WAN_INFO)
-    fob.routers.router.getWanStatus();
-  while (1)
-  {
-    M5.Lcd.setCursor(cursorX, cursorY);
-    Serial.printf("Update type %d started\n", updateType);
-
-    if (updateType == UI_UPDATE_TYPE_TIME)
-      lcdPrintTime();
-    else if(updateType == UI_UPDATE_TYPE_SENSORS)
-      lcdPrintSensors();
-    else if (updateType == UI_UPDATE_TYPE_WAN_INFO)
-      lcdPrintRouterWANInfo();
-    else if (updateType == UI_UPDATE_TYPE_FOB_INFO)
-      lcdPrintFobInfo();
-    else if (updateType == UI_UPDATE_TYPE_PING)
-      updatePingTargetsStatus();
-    else if (updateType == UI_UPDATE_TYPE_WAN_SUMMARY)
-      printRouterWanStatus();
-
-    Serial.printf("Update type %d done\n", updateType);
-    vTaskDelay(pdMS_TO_TICKS(1000));
-
-    if (updateType == UI_UPDATE_TYPE_PING && fob.booting && fob.pingTargets[0].pingOK)
-    {
-      fob.booting = false;
-      break;
-    }
-  }
-
-  fob.tasks.dataUpdate = NULL;
-  vTaskDelete(NULL);
-}
-
-/// @brief Performs the actual rendering of the screen upon receiving a task notification
-void screenUpdateTask(void *arg)
-{
-  uint32_t renderMenu;
-  while (1)
-  {
-    renderMenu = ulTaskNotifyTake(false, portMAX_DELAY);
-    if (renderMenu == 1)
-    {
-      M5.Lcd.clear();
-      M5.Lcd.setCursor(0, 0);
-      M5.Lcd.setTextSize(TEXT_SIZE_DEFAULT);
-      fob.menu.render(MINU_ITEM_MAX_COUNT);
-    }
-  }
-  vTaskDelete(NULL);
-}
-
-/// @brief Watches for Wi-Fi disconnection in STA mode and initiates a reconnect countdown
-void wifiWatchTask(void* arg)
-{
-  ulTaskNotifyTake(false, portMAX_DELAY);
-  for(;;)
-  {
-    if (WiFi.getMode() == WIFI_MODE_STA && WiFi.status() != WL_CONNECTED && !fob.tasks.countdown && !fob.wifi.timedOut)
-    {
-      lastVisitedPageId = fob.menu.currentPageId();
-      startWiFiConnectCountdown(NULL);
-    }
-    if(!fob.booting && !fob.tasks.countdown && WiFi.getMode() == WIFI_MODE_STA && WiFi.status() == WL_CONNECTED && !fob.routers.router.available())
-    {
-      lastVisitedPageId = fob.menu.currentPageId();
-      startRouterConnectCountdown(NULL);
-    }
-  }
-}
-
-void routerConnectTask(void* arg)
-{
-  ulTaskNotifyTake(false, portMAX_DELAY);
-  for(;;)
-  {
-    if(!fob.booting && fob.tasks.countdown && WiFi.getMode() == WIFI_MODE_STA && WiFi.status() == WL_CONNECTED && !fob.routers.router.available())
-      fob.routers.router.checkAvailable();
-  }
+#include "M5StickCPlus2.h"
+#include <WiFi.h>
+#include <ArduinoUniqueID.h>
+
+#include "Minu/minu.hpp"
+#include "ui.h"
+#include "utils.h"
+#include "Sparkline.h"
+#include "config.h"
+#include "logo.h"
+
+#if CONFIG_FREERTOS_UNICORE
+#define ARDUINO_RUNNING_CORE 0
+#else
+#define ARDUINO_RUNNING_CORE 1
+#endif
+
+/// @brief Conditions that trigger the countdown page
+typedef enum
+{
+  UI_COUNTDOWN_TYPE_WIFI = 1,     // Wi-Fi STA connecting countdown
+  UI_COUNTDOWN_TYPE_ROUTER,
+  UI_COUNTDOWN_TYPE_SHUTDOWN,
+  UI_COUNTDOWN_TYPE_REBOOT,
+  UI_COUNTDOWN_TYPE_FACTORY_RESET,
+} UiCountdownType;
+
+/// @brief Number of button pin edges that can wait for the button task. Bounces beyond it are dropped
+#define UI_BUTTON_EDGE_QUEUE_LENGTH 16
+
+/// @brief Number of button presses that can wait for the screen watch task
+#define UI_BUTTON_EVENT_QUEUE_LENGTH 8
+
+/// @brief Number of draw commands that can wait for the screen update task
+#define UI_DRAW_QUEUE_LENGTH 16
+
+/// @brief How long a task waits for room in a full draw queue before dropping its command
+#define UI_DRAW_POST_TIMEOUT_MS 1000
+
+/// @brief Drawing work handed to the screen update task, the only task that draws
+typedef struct
+{
+  void (*draw)(void *arg);    // Draws into the canvas at the start of the page content. NULL renders the menu
+  void *arg;
+  ssize_t page;               // Page the drawing belongs to. Skipped if another page is shown by the time it runs. -1 for any page
+  SemaphoreHandle_t done;     // Given once drawn and pushed to the LCD, if not NULL
+} UiDrawCommand;
+
+/// @brief A level change seen on a button pin by its interrupt handler
+typedef struct
+{
+  uint8_t button;     // StarlinkFob_Button_t of the pin
+  uint32_t timeMs;    // Time of the change
+} UiButtonEdge;
+
+/// @brief Notification bits of the connection task
+#define UI_CONNECTION_START     (1 << 0)    // The boot sequence is done, so dropped connections are handled from now on
+#define UI_CONNECTION_WIFI_UP   (1 << 1)    // Wi-Fi STA got an IP address
+#define UI_CONNECTION_WIFI_DOWN (1 << 2)    // Wi-Fi STA disconnected or lost its IP address
+#define UI_CONNECTION_RETRY     (1 << 3)    // A Wi-Fi countdown gave up on one SSID, so connecting should start again
+
+/// @brief States of the connection task
+typedef enum
+{
+  UI_CONNECTION_STATE_IDLE,           // Not in STA mode
+  UI_CONNECTION_STATE_WIFI_WAIT,      // Wi-Fi is down, waiting on the Wi-Fi countdown or the user
+  UI_CONNECTION_STATE_ROUTER_WAIT,    // Wi-Fi is up but the router doesn't answer, so it is pinged with backoff
+  UI_CONNECTION_STATE_ONLINE,         // Wi-Fi is up and the router answers
+} UiConnectionState;
+
+/// @brief Defines the data to be fetched periodically
+typedef enum
+{
+  UI_UPDATE_TYPE_TIME = 1,
+  UI_UPDATE_TYPE_SENSORS,
+  UI_UPDATE_TYPE_WAN_INFO,
+  UI_UPDATE_TYPE_FOB_INFO,
+  UI_UPDATE_TYPE_PING,
+  UI_UPDATE_TYPE_WAN_SUMMARY,
+  UI_UPDATE_TYPE_WAN_LIST,
+  UI_UPDATE_TYPE_LINK_QUALITY,
+  UI_UPDATE_TYPE_ROUTER_INFO,
+  UI_UPDATE_TYPE_ROUTER_LOCATION
+} UiUpdateType;
+
+/// @brief Notification bit telling the router view task to draw its page afresh.
+/// The low bits of its notification value carry the PeplinkAPI_StatePart_t bits of cached router state that changed
+#define UI_ROUTER_VIEW_REDRAW (1 << 8)
+
+/// @brief Router page currently drawn by the router view task
+typedef struct
+{
+  volatile int type;    // UiUpdateType of the page, or 0 if no router page is shown
+  uint8_t parts;        // Cached router state parts the page displays
+} UiRouterView;
+
+/// @brief Screen area of one WAN on the WAN summary page as last drawn
+typedef struct
+{
+  int id;       // ID of the WAN drawn in the row
+  int top;      // Cursor Y at which the row starts
+  int bottom;   // Cursor Y at which the next row starts
+} UiWanRow;
+
+/// @brief Size of a character cell of menu text, and the grid of cells covering the LCD in landscape
+#define UI_CELL_WIDTH   (6 * TEXT_SIZE_DEFAULT)
+#define UI_CELL_HEIGHT  (8 * TEXT_SIZE_DEFAULT)
+#define UI_SCREEN_COLS  (240 / UI_CELL_WIDTH)
+#define UI_SCREEN_ROWS  ((135 + UI_CELL_HEIGHT - 1) / UI_CELL_HEIGHT)
+
+/// @brief One character cell of menu text as last pushed to the LCD
+typedef struct
+{
+  char c;           // Character drawn in the cell, or 0 if the cell's content is unknown
+  uint16_t fore;
+  uint16_t back;
+  uint8_t frame;    // Frame in which the menu last printed to the cell
+} UiScreenCell;
+
+/// @brief Cost of the last menu render, shown on the fob info page
+typedef struct
+{
+  uint32_t frameUs;       // Time taken by the last render
+  uint32_t pushUs;        // Time taken to send, or start sending by DMA, the rows of the canvas changed by the last frame
+  uint16_t cellsDrawn;    // Cells pushed to the LCD in the last render
+  uint16_t cellsTotal;    // Cells printed by the menu in the last render, drawn or not
+} UiFrameStats;
+
+/// @brief Information about a Wi-Fi network found during a Wi-Fi scan
+typedef struct
+{
+  String ssid;
+  int32_t rssi;
+  uint8_t encType;
+  uint8_t mac[10];
+  int channel;
+} UiWiFiScannedNetwork;
+
+size_t homePageId;
+size_t wifiPageId;
+size_t wifiPromptPageId;
+size_t scanResultPageId;
+size_t saveSSIDAsPageId;
+size_t pingTargetsPageId;
+size_t routerPageId;
+size_t routerInfoPageId;
+size_t routerLocationPageId;
+size_t routerUnavailablePageId;
+size_t routerWANListPageId;
+size_t routerWANInfoPageId;
+size_t routerWANSummaryPageId;
+size_t timePageId;
+size_t sensorsPageId;
+size_t countdownPageId;
+size_t fobInfoPageId;
+size_t linkQualityPageId;
+size_t factoryResetPageId;
+size_t simListPageId;
+size_t simInfoPageId;
+size_t lastVisitedPageId;
+
+static size_t wifiStatusItem;
+static ssize_t homepageWifiItem;
+
+static String tempSSID;
+static String lastSelectedWAN;
+static size_t lastSelectedSim;
+static UiRouterView routerView;
+static volatile int dataUpdateType;    // UiUpdateType of the page the data update task refreshes, or 0 while it idles
+static UiWanRow wanSummaryRows[PEPLINK_MAX_WANS];
+static size_t wanSummaryRowCount;
+static M5Canvas screenCanvas(&M5.Lcd);
+static lgfx::LovyanGFX *lcd;    // Where pages draw: the off-screen canvas, or the LCD itself if the canvas couldn't be allocated
+static UiScreenCell screenCells[UI_SCREEN_ROWS][UI_SCREEN_COLS];
+static uint8_t screenFrame;
+static volatile bool screenInvalid = true;
+static int dirtyTop;        // Band of canvas pixel rows drawn since the last push, empty when dirtyTop >= dirtyBottom
+static int dirtyBottom;
+static bool canvasDma;      // The canvas is in internal RAM, where the LCD's DMA can read it
+static UiFrameStats frameStats;
+static QueueHandle_t drawQueue;
+static int contentX;    // Cursor position just below the menu after the last render, where page content starts
+static int contentY;
+static int wanListIds[PEPLINK_MAX_WANS];   // ID of the WAN behind each item of the WAN list page
+static size_t wanListCount;
+static Sparkline wanGraph;  // Throughput and signal of the WAN on the WAN info page
+static int wanGraphId;      // ID of the WAN the graph was filled for
+
+/// @brief Edges queued by the button interrupt handlers for the button task
+static QueueHandle_t buttonEdges;
+
+static const uint8_t buttonPins[STARLINKFOB_BUTTON_COUNT] = {BUTTON_A_PIN, BUTTON_B_PIN, BUTTON_C_PIN};
+
+void buttonWatchTask(void *arg);
+void screenWatchTask(void *arg);
+void screenUpdateTask(void *arg);
+void countdownTask(void *arg);
+void dataUpdateTask(void *arg);
+void routerViewTask(void *arg);
+void connectionTask(void *arg);
+static void onWiFiEvent(arduino_event_id_t event);
+static void markScreenRows(int top, int bottom);
+bool uiPost(void (*draw)(void *), void *arg, ssize_t page, bool wait = false);
+void uiRequestRender(bool wait = false);
+void drawPageError(void *arg);
+
+/// @brief Go to a page and queue its render. The screen watch task only wakes for button presses,
+/// so a page changed from any other task would otherwise not be drawn until the next press
+void showPage(size_t pageId)
+{
+  fob.menu.goToPage(pageId);
+  uiRequestRender();
+}
+
+void goToFobInfoPage(void *arg = NULL)
+{
+  showPage(fobInfoPageId);
+}
+
+void goToLinkQualityPage(void *arg = NULL)
+{
+  showPage(linkQualityPageId);
+}
+
+void goToHomePage(void *arg = NULL)
+{
+  fob.booting = false;
+  showPage(homePageId);
+}
+
+void goToWiFiPage(void *arg = NULL)
+{
+  fob.wifi.usePrimarySsid = true;
+  showPage(wifiPageId);
+}
+
+void goToTimePage(void *arg = NULL)
+{
+  showPage(timePageId);
+}
+
+void goToSensorsPage(void *arg = NULL)
+{
+  showPage(sensorsPageId);
+}
+
+void goToWiFiPromptPage(void *arg = NULL)
+{
+  fob.wifi.usePrimarySsid = true;
+  showPage(wifiPromptPageId);
+}
+
+void goToScanResultPage(void *arg = NULL)
+{
+  showPage(scanResultPageId);
+}
+
+void goToCountdownPage(void *arg = NULL)
+{
+  showPage(countdownPageId);
+}
+
+void goToRouterPage(void *arg = NULL)
+{
+  showPage(routerPageId);
+}
+
+void goToRouterInfoPage(void *arg = NULL)
+{
+  showPage(routerInfoPageId);
+}
+
+void goToRouterLocationPage(void *arg = NULL)
+{
+  showPage(routerLocationPageId);
+}
+
+void goToRouterUnavailablePage(void *arg = NULL)
+{
+  showPage(routerUnavailablePageId);
+}
+
+void goToRouterWANListPage(void *arg = NULL)
+{
+  showPage(routerWANListPageId);
+}
+
+void goToRouterWANInfoPage(void *arg = NULL)
+{
+  showPage(routerWANInfoPageId);
+}
+
+void goToWANSummaryPage(void* arg = NULL)
+{
+  showPage(routerWANSummaryPageId);
+}
+
+void goToPingTargetsPage(void *arg = NULL)
+{
+  showPage(pingTargetsPageId);
+}
+
+void goToFactoryResetPage(void* arg = NULL)
+{
+  showPage(factoryResetPageId);
+}
+
+void goToSimListPage(void* arg = NULL)
+{
+  showPage(simListPageId);
+}
+
+void goToSimInfoPage(void* arg = NULL)
+{
+  showPage(simInfoPageId);
+}
+
+/// @brief Generic function to be called just after the current active page changes
+/// @param arg A pointer to the currently active page is passed
+void pageOpenedCallback(void *arg)
+{
+  if (!arg)
+    return;
+  MinuPage *thisPage = (MinuPage *)arg;
+  thisPage->highlightItem(0);
+  Serial.printf("Opened page: %s\n", thisPage->title());
+}
+
+/// @brief Generic function to be called just before the current active page changes
+/// @param arg A pointer to the old active page is passed
+void pageClosedCallback(void *arg)
+{
+  if (!arg)
+    return;
+  MinuPage *thisPage = (MinuPage *)arg;
+
+  Serial.printf("Closed page: %s\n", thisPage->title());
+}
+
+/// @brief Generic function called when the current active page is rendered
+/// @param arg A pointer to the currently active page is passed
+void pageRenderedCallback(void *arg)
+{
+  if (!arg)
+    return;
+  MinuPage *thisPage = (MinuPage *)arg;
+
+  Serial.printf("Rendered page: %s\n", thisPage->title());
+}
+
+/// @brief Changes the colour of the Wi-Fi status indicator on the homepage
+/// AP  (active) = Green
+/// STA (not connected) = Red
+/// STA (connected) = Green
+/// Wi-Fi not initialized = Grey
+void updateWiFiItem(void *arg)
+{
+  if (!arg)
+    return;
+
+  MinuPageItem *thisItem = (MinuPageItem *)arg;
+
+  if (WiFi.getMode() == WIFI_MODE_AP)
+    thisItem->setAuxTextBackground(GREEN);
+  else if (WiFi.getMode() == WIFI_MODE_STA)
+  {
+    if (WiFi.status() == WL_CONNECTED)
+      thisItem->setAuxTextBackground(GREEN);
+    else
+      thisItem->setAuxTextBackground(RED);
+  }
+  else
+    thisItem->setAuxTextBackground(TFT_GREY);
+}
+
+/// @brief Prints the Wi-Fi status and details when the Wi-Fi status item (<--) on the Wi-Fi page is highlighted
+void lcdPrintWiFiStatus(void *page)
+{
+  if (page)
+    if (fob.menu.currentPageId() == wifiPageId && (*(MinuPage *)page).highlightedIndex() != wifiStatusItem)
+      return;
+
+  lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+  if (WiFi.getMode() == WIFI_MODE_NULL)
+  {
+    lcd->setTextColor(RED, BLACK);
+    lcd->println("WiFi not INIT!");
+    lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+    return;
+  }
+  else
+    lcd->printf("\n%s:", WiFi.getMode() == WIFI_MODE_AP ? "(AP) " : "(STA)");
+
+  if ((WiFi.status() == WL_CONNECTED) || WiFi.getMode() == WIFI_MODE_AP)
+  {
+    lcd->setTextColor(BLACK, GREEN);
+    lcd->println(" ");
+    lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+
+    lcd->print("SSID :");
+    lcd->println((WiFi.getMode() == WIFI_MODE_AP) ? WiFi.softAPSSID().c_str() : WiFi.SSID().c_str());
+
+    lcd->print("IPAdr:");
+    lcd->println((WiFi.getMode() == WIFI_MODE_AP) ? WiFi.softAPIP().toString().c_str() : WiFi.localIP().toString().c_str());
+
+    return;
+  }
+  lcd->setTextColor(BLACK, RED);
+  lcd->println(" ");
+  lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+}
+
+/// @brief Print the cached router hardware information
+/// @param available Whether it could be fetched
+void lcdPrintRouterInfo(bool available)
+{
+  if (!available)
+  {
+    drawPageError((void *)"Unavailable!");
+    return;
+  }
+  PeplinkRouterInfo info = fob.routers.cache.info();
+  lcd->printf("Name  :%s\n", info.name.c_str());
+  lcd->printf("Uptime:%ld\n", info.uptime);
+  lcd->printf("Serial:%s\n", info.serial.c_str());
+  lcd->printf("Fw Ver:%s\n", info.fwVersion.c_str());
+  lcd->printf("P Code:%s\n", info.productCode.c_str());
+  lcd->printf("hw Rev:%s\n", info.hardwareRev.c_str());
+}
+
+/// @brief Print the cached router location information
+/// @param available Whether it could be fetched
+void lcdPrintRouterLocation(bool available)
+{
+  if (!available)
+  {
+    drawPageError((void *)"Unavailable!");
+    return;
+  }
+  PeplinkRouterLocation location = fob.routers.cache.location();
+  lcd->printf("Longitude:%s\n", location.longitude.c_str());
+  lcd->printf("Latitude :%s\n", location.latitude.c_str());
+  lcd->printf("Altitude :%s\n", location.altitude.c_str());
+}
+
+void lcdPrintRouterUnavailable(void *arg = NULL)
+{
+  fob.booting = true;
+  lcd->println(" Router Unavailable!\n Unable to continue.\n Please reboot"); 
+}
+
+/// @brief Return the colour of the WAN graph's signal strip for a cellular signal level or Wi-Fi strength.
+/// Black for wired WANs, which report no signal
+static uint16_t wanSignalColour(PeplinkAPI_WANType_t type, int signal)
+{
+  static const uint16_t levelColours[] = {RED, ORANGE, YELLOW, GREENYELLOW, GREEN};
+  int level;
+  if (type == PEPLINKAPI_WAN_TYPE_CELLULAR)
+    level = signal;
+  else if (type == PEPLINKAPI_WAN_TYPE_WIFI)
+    level = (signal < 0) ? (signal + 95) / 10 : signal / 25;   // dBm or percent
+  else
+    return BLACK;
+  return levelColours[constrain(level, 0, 4)];
+}
+
+/// @brief Draw the throughput graph of \a wan below the cursor, download filled in and upload as a line,
+/// over a strip showing its signal. It fills whatever height the text above leaves.
+/// Unless the layout changed, a new bandwidth reading scrolls the graph by one column
+/// @param redraw Draw it afresh, filled from the recent WAN history
+static void lcdPrintWanGraph(const PeplinkAPI_WAN &wan, bool redraw)
+{
+  int top = lcd->getCursorY() + 2;
+  int height = lcd->height() - top;
+  int signal = (wan.type == PEPLINKAPI_WAN_TYPE_CELLULAR) ? wan.cellular.signalLevel : wan.wifi.strength;
+  uint16_t signalColour = wanSignalColour(wan.type, signal);
+
+  if (redraw || wan.id != wanGraphId || !wanGraph.placedAt(top, height))
+  {
+    wanGraphId = wan.id;
+    wanGraph.place(0, top, lcd->width(), height);
+
+    WanHistory_Slot slots[WAN_HISTORY_RECENT_SLOTS];
+    size_t count = fob.routers.cache.history().read(wan.id, WAN_HISTORY_RECENT, slots, WAN_HISTORY_RECENT_SLOTS);
+    for (size_t i = 0; i < count; ++i)
+      if (slots[i].trafficSamples)
+        wanGraph.add(slots[i].downloadKbps, slots[i].uploadKbps, wanSignalColour(wan.type, slots[i].signal));
+    wanGraph.add(WanHistory::kbps(wan.download, wan.unit), WanHistory::kbps(wan.upload, wan.unit), signalColour);
+    wanGraph.draw(lcd);
+  }
+  else if (wan.changes & PEPLINKAPI_WAN_CHANGED_TRAFFIC)
+    wanGraph.push(lcd, WanHistory::kbps(wan.download, wan.unit), WanHistory::kbps(wan.upload, wan.unit), signalColour);
+}
+
+/// @brief Print the cached information of the selected WAN
+/// @param redraw Print it even if it hasn't changed since the last call
+void lcdPrintRouterWANInfo(bool redraw = true)
+{
+  fob.routers.cache.lock();
+  const PeplinkAPI_WANTable &wanList = fob.routers.cache.wans();
+  if (!wanList.size())
+  {
+    fob.routers.cache.unlock();
+    lcd->setTextColor(RED, BLACK);
+    lcd->println("No WAN found!");
+    lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+    return;
+  }
+
+  for (const PeplinkAPI_WAN &wan : wanList)
+  {
+    if (lastSelectedWAN == wan.name)
+    {
+      if (!redraw && !wan.changes)
+        break;
+      if(!fob.routers.cache.available(PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC))
+      {
+        lcd->setTextColor(RED, BLACK);
+        lcd->println("Unavailable!");
+        lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+        break;
+      }
+      else
+      {
+        lcd->printf("Name:%s      \n", wan.name);
+        lcd->print("Type:");
+        switch (wan.type)
+        {
+        case PEPLINKAPI_WAN_TYPE_ETHERNET:
+          lcd->print("ETHERNET\n");
+          break;
+        case PEPLINKAPI_WAN_TYPE_CELLULAR:
+          lcd->print("CELLULAR\n");
+          lcd->printf("Carr:%s ",wan.cellular.carrier);
+          lcd->setTextColor(TFT_WHITE, TFT_BLUE);
+          lcd->printf("%s", wan.cellular.networkType);
+          lcd->setTextColor(TFT_WHITE, TFT_BLACK);
+          switch (wan.cellular.signalLevel)
+          {
+            case 0: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars0, 0); break;
+            case 1: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars1, 0); break;
+            case 2: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars2, 0); break;
+            case 3: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars3, 0); break;
+            default: lcd->drawBitmap(lcd->getCursorX()+ 10, lcd->getCursorY() - 5, 20, 21, bars4, 0); break;
+          }
+          lcd->println(" ");
+          break;
+        case PEPLINKAPI_WAN_TYPE_WIFI:
+          lcd->print("WIFI\n");
+          break;
+        }
+        lcd->printf("Stat:%s\n", wan.status);
+
+        if(!strcmp(wan.status, "Disabled"))
+        {
+          // Clear the lines and graph of the WAN before it was disabled
+          lcd->fillRect(0, lcd->getCursorY(), lcd->width(), lcd->height() - lcd->getCursorY(), MINU_BACKGROUND_COLOUR_DEFAULT);
+          wanGraph.place(0, 0, 0, 0);
+          break;
+        }
+        lcd->printf("IP  :%s\n", wan.ip);
+        lcd->print("U/D :");
+        lcd->printf("%ld/%ld %s     \n", wan.upload, wan.download, wan.unit);
+        lcdPrintWanGraph(wan, redraw);
+      }
+      break;
+    }
+  }
+  fob.routers.cache.clearWanChanges();
+  fob.routers.cache.unlock();
+}
+
+/// @brief Time read by the data update task for the time page
+static m5::rtc_datetime_t timeReading;
+
+/// @brief Readings taken by the data update task for the sensors page
+static struct
+{
+  bool shtOK;
+  bool qmpOK;
+  bool overTemp;
+  float humidity;
+  float fTemp;
+  float cTemp;
+  float pressure;
+  float altitude;
+} sensorReading;
+
+/// @brief Sync the RTC with the NTP server and read the time for the time page.
+/// Runs on the data update task, since the sync waits for the next second to start
+void readTime(void)
+{
+  syncNtpToRtc(TIMEZONE);
+  m5::rtc_datetime_t dt = M5.Rtc.getDateTime();
+  Serial.printf("%02d:%02d:%02dH\n%02d/%02d/%04d\n",
+                dt.time.hours, dt.time.minutes, dt.time.seconds,
+                dt.date.date, dt.date.month, dt.date.year);
+  timeReading = dt;
+}
+
+/// @brief Print the time last read by readTime()
+void lcdPrintTime(void *arg = NULL)
+{
+  const m5::rtc_datetime_t &dt = timeReading;
+  lcd->printf("Time:%02d:%02d:%02dH\nDate:%02d/%02d/%04d\n",
+                dt.time.hours, dt.time.minutes, dt.time.seconds,
+                dt.date.date, dt.date.month, dt.date.year);
+
+  if(fob.timestamps.lastShutdownTime.length())  
+    lcd->printf("Last PWR:%s\n", fob.timestamps.lastShutdownTime.c_str());
+  else
+    lcd->println("Last PWR:Unknown");
+
+  if (fob.timestamps.lastShutdownRuntime)
+    lcd->printf("Last Run:%04d:%02d", (fob.timestamps.lastShutdownRuntime/1000)/3600, ((fob.timestamps.lastShutdownRuntime/1000) % 3600)/60);
+  else
+    lcd->println("Last Run:Unknown");
+}
+
+/// @brief Read the sensors for the sensors page and log over-temperature alerts.
+/// Runs on the data update task, since the sensors are read over I2C and the alert is written to flash
+void readSensors(void)
+{
+  static bool tempAlerted;
+  static float tempAlertPeak;
+
+  sensorReading.shtOK = fob.sensors.shtAvailable && fob.sensors.sht.update();
+  if (sensorReading.shtOK)
+  {
+    sensorReading.humidity = fob.sensors.sht.humidity;
+    sensorReading.fTemp = fob.sensors.sht.fTemp;
+  }
+  sensorReading.overTemp = sensorReading.shtOK && sensorReading.fTemp > TEMPERATURE_ALERT_THRESH_F;
+
+  if (sensorReading.overTemp)
+  {
+    // Log on crossing the threshold and then each time the temperature climbs another degree,
+    // rather than on every reading
+    if (!tempAlerted || sensorReading.fTemp >= tempAlertPeak + 1.f)
+    {
+      tempAlerted = true;
+      tempAlertPeak = sensorReading.fTemp;
+      Serial.printf("Over-temperature alert\n\tThreshold: %dF\n\tTemperature: %fF\n",
+                    TEMPERATURE_ALERT_THRESH_F, sensorReading.fTemp);
+      if (logEvent(EVENT_LOG_TEMP_ALERT, sensorReading.fTemp * 100, 0, TEMPERATURE_ALERT_THRESH_F))
+        Serial.println("Logged over-temperature alert");
+    }
+    return;
+  }
+  tempAlerted = false;
+
+  sensorReading.qmpOK = fob.sensors.qmpAvailable && fob.sensors.qmp.update();
+  if (sensorReading.qmpOK)
+  {
+    sensorReading.cTemp = fob.sensors.qmp.cTemp;
+    sensorReading.pressure = fob.sensors.qmp.pressure;
+    sensorReading.altitude = fob.sensors.qmp.altitude;
+  }
+}
+
+/// @brief Print the readings last taken by readSensors(), or the over-temperature alert
+void lcdPrintSensors(void* arg = NULL)
+{
+  if (sensorReading.overTemp)
+  {
+    uiInvalidateScreen();
+    lcd->fillScreen(RED);
+    lcd->setCursor(0, 0);
+    lcd->setTextColor(WHITE, RED);
+    lcd->setTextSize(TEXT_SIZE_DEFAULT);
+    lcd->println("__OVER TEMPERATURE__\n");
+    lcd->printf("  Threshold: %dF\n\n", TEMPERATURE_ALERT_THRESH_F);
+    lcd->setTextSize(5);
+    lcd->printf(" %.2fF\n\n", sensorReading.fTemp);
+    lcd->setTextSize(TEXT_SIZE_DEFAULT);
+    lcd->setTextColor(WHITE, BLACK);
+    return;
+  }
+
+  if (sensorReading.shtOK)
+  {
+    uiInvalidateScreen();
+    lcd->fillScreen(BLACK);
+    lcd->setCursor(0, 0);
+    lcd->println("______SENSORS_______\n");
+    lcd->printf("%%RH :%.2f%% @ %.2fF\n", sensorReading.humidity, sensorReading.fTemp);
+  }
+  else
+    lcd->println("\nSHT sensor unavailable!");
+
+  if (sensorReading.qmpOK)
+  {
+    lcd->printf("Temp:%.4f C\n", sensorReading.cTemp);
+    lcd->printf("Pres:%.4f Pa\n", sensorReading.pressure);
+    lcd->printf("Alt :%.4f m\n", sensorReading.altitude);
+  }
+  else
+    lcd->println("QMP sensor unavailable!\n");
+}
+
+/// @brief Print one WAN of the WAN summary at the cursor, leaving the cursor at the start of the next row
+void printWanSummaryRow(const PeplinkAPI_WAN &wan)
+{
+  Serial.printf("\tname : %s", wan.name);
+  Serial.printf("\tstatus : %s", wan.status);
+  // Serial.print("\tstatusLed : " + wan.statusLED);
+  // lcd->print(wan.name +" " + wan.status + " " + wan.statusLED + "\n");
+  if (strcmp(wan.status, "Disabled"))
+  {
+    // lcd->print(wan.name +" " + wan.statusLED + "\n");
+    if (!strcmp(wan.statusLED, "red"))
+      lcd->setTextColor(TFT_WHITE, TFT_RED);
+    if (!strcmp(wan.statusLED, "yellow"))
+      lcd->setTextColor(TFT_WHITE, TFT_YELLOW);
+    if (!strcmp(wan.statusLED, "green"))
+      lcd->setTextColor(TFT_WHITE, TFT_GREEN);
+    if (!strcmp(wan.statusLED, "flash"))
+      lcd->setTextColor(TFT_BLACK, TFT_WHITE);
+    lcd->print(" ");
+    // lcd->print(wan.name);
+    if(wan.managementOnly)
+    {
+      lcd->setTextColor(TFT_WHITE, TFT_ORANGE);
+      lcd->print("+");
+      lcd->setTextColor(TFT_WHITE, TFT_BLACK);
+      lcd->printf(" %s\n", wan.name);
+    }
+    else
+    {
+      lcd->setTextColor(TFT_WHITE, TFT_BLACK);
+      lcd->printf("  %s\n", wan.name);
+    }
+    lcd->println(wan.status);
+    // lcd->print(wan.name +" " + wan.status + "\n");
+  }
+  else
+  {
+    // lcd->print(wan.name +" " + wan.statusLED +" " + wan.status + "\n");
+    lcd->setTextColor(TFT_BLACK, TFT_GREY);
+    lcd->print(" ");
+    if(!wan.managementOnly)
+    {
+      lcd->setTextColor(TFT_WHITE, TFT_ORANGE);
+      lcd->print("+");
+      lcd->setTextColor(TFT_WHITE, TFT_BLACK);
+      lcd->printf(" %s\n", wan.name);
+    }
+    else
+    {
+      lcd->setTextColor(TFT_WHITE, TFT_BLACK);
+      lcd->printf("  %s\n", wan.name);
+    }
+    // lcd->setTextColor(TFT_BLACK,TFT_WHITE);
+    // lcd->print(wan.name);
+    // lcd->print(" " + wan.status + "\n");
+  }
+  switch (wan.type)
+  {
+  case PEPLINKAPI_WAN_TYPE_ETHERNET:
+    Serial.print("\ttype : ethernet");
+    if (strcmp(wan.status, "Disabled"))
+      Serial.printf("\tip : %s", wan.ip);
+    // lcd->print("IP: " + wan.ip + "\n");
+    break;
+  case PEPLINKAPI_WAN_TYPE_CELLULAR:
+  {
+    Serial.print("\ttype : cellular");
+    if (strcmp(wan.status, "Disabled"))
+    {
+      Serial.printf("\tip : %s", wan.ip);
+      Serial.printf("\tcarrier: %s", wan.cellular.carrier);
+      Serial.printf("\trssi: %d\n", wan.cellular.rssi);
+      if (wan.cellular.carrier[0])
+      {
+        lcd->printf("%s ", wan.cellular.carrier);
+        lcd->setTextColor(TFT_WHITE, TFT_BLUE);
+        lcd->print(wan.cellular.networkType);
+        lcd->setTextColor(TFT_WHITE, TFT_BLACK);
+        switch (wan.cellular.signalLevel)
+        {
+        case 0: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars0, 0); break;
+        case 1: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars1, 0); break;
+        case 2: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars2, 0); break;
+        case 3: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars3, 0); break;
+        default: lcd->drawBitmap(lcd->getCursorX() + 10, lcd->getCursorY() - 5, 20, 21, bars4, 0); break;
+        }
+      }
+      printSimCards(wan.cellular.simCards, wan.cellular.simCount);
+    }
+  }
+  break;
+  case PEPLINKAPI_WAN_TYPE_WIFI:
+  {
+    Serial.print("\ttype : wifi");
+    if (strcmp(wan.status, "Disabled"))
+    {
+      Serial.printf("\tip : %s", wan.ip);
+      Serial.printf("\tstrength: %d", wan.wifi.strength);
+      Serial.printf("\tssid: %s", wan.wifi.ssid);
+      Serial.printf("\tbssid: %s", wan.wifi.bssid);
+    }
+  }
+  break;
+  }
+  Serial.println();
+}
+
+/// @brief Get the status of WAN connections
+/// @param redraw Draw every WAN afresh. Otherwise only the rows of WANs that changed since the last call are redrawn
+/// @param available Whether the WAN status could be fetched
+void printRouterWanStatus(bool redraw, bool available)
+{
+  Serial.println("Getting WAN list - ");
+  lcd->setCursor(0, 0, 1);
+  lcd->println("_____WAN SUMMARY____\n");
+  markScreenRows(0, lcd->getCursorY());
+
+  const int cursorX = lcd->getCursorX();
+  const int cursorY = lcd->getCursorY();
+  if (!available)
+  {
+    lcd->setCursor(cursorX, cursorY);
+    lcd->fillRect(0, cursorY, lcd->width(), lcd->height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
+    lcd->setTextColor(RED, BLACK);
+    lcd->println("Unavailable!");
+    lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+    wanSummaryRowCount = 0;
+    return;
+  }
+
+  // Nothing is known to be on screen after a failed fetch, so the next update draws everything
+  if (redraw || !wanSummaryRowCount)
+  {
+    lcd->fillRect(0, cursorY, lcd->width(), lcd->height() - cursorY, MINU_BACKGROUND_COLOUR_DEFAULT);
+    wanSummaryRowCount = 0;
+  }
+
+  fob.routers.cache.lock();
+  const PeplinkAPI_WANTable &wanList = fob.routers.cache.wans();
+  Serial.println(String(wanList.size()) + " elements:");
+
+  // Set once a row changes height, after which everything below it has been cleared and is drawn afresh
+  bool shifted = false;
+  lcd->setCursor(cursorX, cursorY);
+  for (size_t i = 0; i < wanList.size(); ++i)
+  {
+    const PeplinkAPI_WAN &wan = wanList.wans[i];
+    bool drawn = !shifted && i < wanSummaryRowCount;
+    if (drawn && wanSummaryRows[i].id == wan.id && !(wan.changes & ~PEPLINKAPI_WAN_CHANGED_TRAFFIC))
+    {
+      lcd->setCursor(cursorX, wanSummaryRows[i].bottom);
+      continue;
+    }
+
+    const int top = lcd->getCursorY();
+    if (drawn)
+      lcd->fillRect(0, top, lcd->width(), wanSummaryRows[i].bottom - top, MINU_BACKGROUND_COLOUR_DEFAULT);
+    printWanSummaryRow(wan);
+
+    if (drawn && lcd->getCursorY() != wanSummaryRows[i].bottom)
+    {
+      // The rows below have moved, so clear them and draw this row again on a clean background
+      lcd->fillRect(0, top, lcd->width(), lcd->height() - top, MINU_BACKGROUND_COLOUR_DEFAULT);
+      lcd->setCursor(cursorX, top);
+      printWanSummaryRow(wan);
+      shifted = true;
+    }
+    wanSummaryRows[i].id = wan.id;
+    wanSummaryRows[i].top = top;
+    wanSummaryRows[i].bottom = lcd->getCursorY();
+  }
+
+  // Clear the rows of WANs no longer listed
+  if (!shifted && wanList.size() < wanSummaryRowCount)
+    lcd->fillRect(0, lcd->getCursorY(), lcd->width(), lcd->height() - lcd->getCursorY(), MINU_BACKGROUND_COLOUR_DEFAULT);
+  wanSummaryRowCount = wanList.size();
+
+  fob.routers.cache.clearWanChanges();
+  fob.routers.cache.unlock();
+}
+
+/// @brief Print information about the fob's current status
+void lcdPrintFobInfo(void *arg = NULL)
+{
+  lcd->printf("Name:" PEPLINK_FOB_NAME "\n");
+  lcd->printf("Time:%ld\n", millis());
+  lcd->printf("HWID:0x");
+  for (size_t i = 0; i < UniqueIDsize; i++)
+    lcd->print(UniqueID[i], HEX);
+  lcd->printf("\nBATT:%u%%\n", M5.Power.getBatteryLevel());
+  lcd->printf("Draw:%lu.%lu+%lu.%lums  \n", frameStats.frameUs / 1000, (frameStats.frameUs % 1000) / 100,
+              frameStats.pushUs / 1000, (frameStats.pushUs % 1000) / 100);
+#if portNUM_PROCESSORS > 1
+  lcd->printf("CPU :%u%% %u%%  \n", cpuLoadPercent(0), cpuLoadPercent(1));
+#else
+  lcd->printf("CPU :%u%%  \n", cpuLoadPercent(0));
+#endif
+}
+
+/// @brief Print the 95th percentile RTT and the loss of each target over the link monitor's window,
+/// coloured like the network diagnostics page
+void lcdPrintLinkQuality(void *arg = NULL)
+{
+  LinkMonitor_Stats stats;
+  for (size_t i = 0; fob.links.stats(i, stats); ++i)
+  {
+    uint16_t colour;
+    if (!stats.dnsOK)
+      colour = ORANGE;
+    else if (!stats.probes)
+      colour = TFT_GREY;
+    else if (!stats.replies)
+      colour = RED;
+    else if (stats.lossPercent)
+      colour = YELLOW;
+    else
+      colour = GREEN;
+    lcd->setTextColor(colour, MINU_BACKGROUND_COLOUR_DEFAULT);
+
+    if (stats.replies)
+      lcd->printf("%-10.10s%4lu%4u%%\n", stats.name, stats.p95Us / 1000, stats.lossPercent);
+    else
+      lcd->printf("%-10.10s  --%4u%%\n", stats.name, stats.lossPercent);
+  }
+  lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+}
+
+/// @brief Stop the task that periodically performs HTTP requests
+void stopDataUpdate(void *arg = NULL)
+{
+  if (routerView.type)
+  {
+    fob.routers.cache.unwatch(routerView.parts);
+    if (routerView.type == UI_UPDATE_TYPE_WAN_INFO)
+      fob.routers.cache.focus(0);
+    routerView.type = 0;
+  }
+
+  // The task is told to idle rather than deleted, since it may be holding the event log or DNS cache lock.
+  // It finishes the update under way, whose drawing is dropped once its page is left
+  if (dataUpdateType)
+  {
+    dataUpdateType = 0;
+    if (fob.tasks.dataUpdate)
+      xTaskNotifyGive(fob.tasks.dataUpdate);
+  }
+}
+
+/// @brief Check whether ping targets can be reached
+void updatePingTargetsStatus(void *arg = NULL)
+{
+  size_t targetCount = min(fob.pingTargets.size(), (size_t)NETDIAG_MAX_TARGETS);
+  Serial.printf("Pinging %d targets...\n", targetCount);
+
+  NetDiag_PingResult results[NETDIAG_MAX_TARGETS];
+  for (size_t i = 0; i < targetCount; ++i)
+  {
+    // Targets that can't be resolved are left at 0.0.0.0, which the sweep skips.
+    // Names come from the DNS cache, so a sweep only waits on DNS when a name has expired
+    PingTarget &target = fob.pingTargets[i];
+    IPAddress ip = target.pingIP;
+    target.dnsOK = true;
+    target.dnsLatencyMs = 0;
+    if (!target.useIP)
+      target.dnsOK = fob.dns.resolve(target.fqn.c_str(), ip, &target.dnsLatencyMs);
+    results[i].addr = target.dnsOK ? (uint32_t)ip : 0;
+  }
+
+  // All targets are pinged at once, so a sweep takes about one timeout however many of them are down.
+  // The socket is kept open from one sweep to the next
+  static NetDiag_Socket pingSocket = NETDIAG_SOCKET_INIT;
+  netDiagSweep(&pingSocket, results, targetCount);
+
+  for (size_t i = 0; i < targetCount; ++i)
+  {
+    PingTarget &target = fob.pingTargets[i];
+    target.stats = results[i];
+    target.pingOK = results[i].received > 0;
+    target.pinged = true;
+
+    // A name that doesn't resolve says nothing about whether the host is reachable, so it gets its own colour
+    if (!target.dnsOK)
+      fob.menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(ORANGE);
+    else if (!target.pingOK)
+      fob.menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(RED);
+    else if (results[i].lossPercent)
+      fob.menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(YELLOW);
+    else
+      fob.menu.pages()[pingTargetsPageId]->items()[i].setAuxTextBackground(GREEN);
+    if (!target.dnsOK)
+    {
+      Serial.printf("Target %d(%s) -> DNS FAIL after %lums\n", i, target.fqn.c_str(), target.dnsLatencyMs);
+      continue;
+    }
+    Serial.printf("Target %d(%s) -> dns %lums, ping %s, %u%% loss, rtt min/avg/max %lu.%lu/%lu.%lu/%lu.%lums\n", i,
+                  IPAddress(results[i].addr).toString().c_str(), target.dnsLatencyMs, (target.pingOK) ? "OK" : "FAIL", results[i].lossPercent,
+                  results[i].rttMinUs / 1000, (results[i].rttMinUs % 1000) / 100,
+                  results[i].rttAvgUs / 1000, (results[i].rttAvgUs % 1000) / 100,
+                  results[i].rttMaxUs / 1000, (results[i].rttMaxUs % 1000) / 100);
+  }
+  uiRequestRender();
+}
+
+/// @brief Starts the task that periodically performs HTTP requests
+void startDataUpdate(void *arg = NULL)
+{
+  UiUpdateType ut;
+  if (fob.menu.currentPageId() == timePageId)
+    ut = UI_UPDATE_TYPE_TIME;
+  else if (fob.menu.currentPageId() == sensorsPageId)
+    ut = UI_UPDATE_TYPE_SENSORS;
+  else if (fob.menu.currentPageId() == routerWANInfoPageId)
+    ut = UI_UPDATE_TYPE_WAN_INFO;
+  else if (fob.menu.currentPageId() == fobInfoPageId)
+    ut = UI_UPDATE_TYPE_FOB_INFO;
+  else if (fob.menu.currentPageId() == linkQualityPageId)
+    ut = UI_UPDATE_TYPE_LINK_QUALITY;
+  else if (fob.menu.currentPageId() == pingTargetsPageId)
+  {
+    ut = UI_UPDATE_TYPE_PING;
+    for (auto item : fob.menu.currentPage()->items())
+      item.setAuxTextBackground(MINU_BACKGROUND_COLOUR_DEFAULT);
+    fob.menu.currentPage()->highlightItem(0);
+    uiRequestRender();
+  }
+  else if(fob.menu.currentPageId() == routerWANSummaryPageId)
+    ut = UI_UPDATE_TYPE_WAN_SUMMARY;
+  else if (fob.menu.currentPageId() == routerInfoPageId)
+    ut = UI_UPDATE_TYPE_ROUTER_INFO;
+  else if (fob.menu.currentPageId() == routerLocationPageId)
+    ut = UI_UPDATE_TYPE_ROUTER_LOCATION;
+  else
+    return;
+
+  // If the data update task is already refreshing a page, it starts over with this one
+  stopDataUpdate();
+
+  // Router pages are redrawn by the long-lived router view task whenever the cached router state changes,
+  // so the page shows at once and its content is drawn when the router answers
+  if (ut == UI_UPDATE_TYPE_WAN_INFO || ut == UI_UPDATE_TYPE_WAN_SUMMARY || ut == UI_UPDATE_TYPE_ROUTER_INFO || ut == UI_UPDATE_TYPE_ROUTER_LOCATION)
+  {
+    if (ut == UI_UPDATE_TYPE_WAN_INFO)
+    {
+      routerView.parts = PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC;
+
+      // Only the WAN shown needs fetching while the page is open
+      uint8_t wanId = 0;
+      fob.routers.cache.lock();
+      for (const PeplinkAPI_WAN &wan : fob.routers.cache.wans())
+        if (lastSelectedWAN == wan.name)
+          wanId = wan.id;
+      fob.routers.cache.unlock();
+      fob.routers.cache.focus(wanId);
+    }
+    else if (ut == UI_UPDATE_TYPE_ROUTER_INFO)
+      routerView.parts = PEPLINKAPI_STATE_INFO;
+    else if (ut == UI_UPDATE_TYPE_ROUTER_LOCATION)
+      routerView.parts = PEPLINKAPI_STATE_LOCATION;
+    else
+      routerView.parts = PEPLINKAPI_STATE_WAN_STATUS;
+    routerView.type = ut;
+    fob.routers.cache.watch(routerView.parts);
+    if (fob.tasks.routerView)
+      xTaskNotify(fob.tasks.routerView, UI_ROUTER_VIEW_REDRAW, eSetBits);
+    return;
+  }
+
+  dataUpdateType = ut;
+  if (fob.tasks.dataUpdate)
+    xTaskNotifyGive(fob.tasks.dataUpdate);
+}
+
+void startWiFiConnectCountdown(void *arg = NULL)
+{
+  if (WiFi.status() == WL_CONNECTED)
+  {
+    goToHomePage();
+    return;
+  }
+  fob.menu.pages()[countdownPageId]->setTitle("WAITING FOR WIFI");
+
+  fob.wifi.timedOut = false;
+  if (fob.menu.currentPageId() != countdownPageId)
+    goToCountdownPage();
+
+  if (fob.tasks.countdown)
+    vTaskDelete(fob.tasks.countdown);
+  xTaskCreatePinnedToCore(countdownTask, "WiFi Countdown", 4096, (void *)UI_COUNTDOWN_TYPE_WIFI, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
+
+  if (WiFi.getMode() != WIFI_MODE_STA)
+  {
+    WiFi.mode(WIFI_MODE_NULL);
+    delay(100);
+    WiFi.mode(WIFI_MODE_STA);
+
+    if (fob.wifi.usePrimarySsid)
+    {
+      Serial.printf("Connecting to Wi-Fi: SSID - '%s', Pass - '%s'\n", fob.wifi.ssidStaPrimary.c_str(), fob.wifi.passwordStaPrimary.c_str());
+      WiFi.begin(fob.wifi.ssidStaPrimary.c_str(), fob.wifi.passwordStaPrimary.c_str());
+    }
+    else
+    {
+      Serial.printf("Connecting to Wi-Fi: SSID - '%s', Pass - '%s'\n", fob.wifi.ssidStaSecondary.c_str(), fob.wifi.passwordStaSecondary.c_str());
+      WiFi.begin(fob.wifi.ssidStaSecondary.c_str(), fob.wifi.passwordStaSecondary.c_str());
+    }
+  }
+}
+
+void startRouterConnectCountdown(void *arg = NULL)
+{
+  fob.menu.pages()[countdownPageId]->setTitle("CONNECTING ROUTER");
+
+  if (fob.menu.currentPageId() != countdownPageId)
+    goToCountdownPage();
+
+  vTaskDelay(2000);
+
+  if (fob.tasks.countdown)
+    vTaskDelete(fob.tasks.countdown);
+  xTaskCreatePinnedToCore(countdownTask, "Router Countdown", 8192, (void *)UI_COUNTDOWN_TYPE_ROUTER, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
+
+}
+
+/// @brief Start the Wi-Fi access point
+void startWiFiAP(void *arg)
+{
+  if (WiFi.getMode() != WIFI_MODE_AP)
+  {
+    WiFi.mode(WIFI_MODE_NULL);
+    delay(100);
+    WiFi.mode(WIFI_MODE_AP);
+    Serial.printf("Starting softAP...\tSSID:'%s'\tPassword:'%s'\n", fob.wifi.ssidSoftAp.c_str(), fob.wifi.passwordSoftAp.c_str());
+    WiFi.softAP(fob.wifi.ssidSoftAp.c_str(), fob.wifi.passwordSoftAp.c_str());
+    fob.wifi.timedOut = true;
+  }
+  delay(1000);
+  if(!fob.servers.started)
+  {
+    fob.servers.started = true;
+    Serial.println("Starting HTTP Server");
+    startHttpServer();
+  }
+  goToWiFiPage();
+}
+
+/// @brief Print the message \a arg below the menu items of the current page
+void drawPageMessage(void *arg)
+{
+  lcd->println((const char *)arg);
+}
+
+/// @brief Print the error message \a arg below the menu items of the current page
+void drawPageError(void *arg)
+{
+  lcd->setTextColor(RED, BLACK);
+  lcd->println((const char *)arg);
+}
+
+/// @brief Fill the SIM list page from the cached WAN status, replacing what it shows
+void buildSimList(void *arg)
+{
+  MinuPage *page = fob.menu.pages()[simListPageId];
+  page->removeAllItems();
+
+  fob.routers.cache.lock();
+  const PeplinkAPI_WANTable &wanList = fob.routers.cache.wans();
+  if (!wanList.size())
+  {
+    fob.routers.cache.unlock();
+    page->addItem(goToRouterPage, NULL, NULL);
+    Serial.println("No WAN found!");
+    uiRequestRender();
+    uiPost(drawPageMessage, (void *)"No WAN found!", simListPageId);
+    return;
+  }
+  for (const PeplinkAPI_WAN &wan : wanList)
+  {
+    if(wan.type == PEPLINKAPI_WAN_TYPE_CELLULAR)
+    {
+      const PeplinkAPI_WAN_Cellular_SIM *simList = wan.cellular.simCards;
+      ssize_t thisItem;
+      String simName = String();
+
+      for (size_t it = 0; it < wan.cellular.simCount; ++it)
+      {
+        char simId = it + 'A';
+        simName = "SIM " + String(simId);
+        simName += (simList[it].detected && simList[it].active) ? String(" (Active)") : String();
+        thisItem = page->addItem(goToSimInfoPage, simName.c_str(), " ");
+
+        if(!simList[it].detected)
+          page->items()[thisItem].setAuxTextBackground(TFT_GREY);
+        else if (simList[it].active)
+          page->items()[thisItem].setAuxTextBackground(GREEN);
+        else
+          page->items()[thisItem].setAuxTextBackground(RED);
+      }
+    }
+  }
+  fob.routers.cache.unlock();
+  page->addItem(goToRouterPage, "<--", NULL);
+  page->highlightItem(0);
+  uiRequestRender();
+}
+
+/// @brief Create the list of SIM cards of the cellular WANs.
+/// The items are changed on the screen update task, as this runs on whichever task opened the page
+void showSimList(void *arg)
+{
+  Serial.println("Fetching SIM list");
+  uiPost(buildSimList, NULL, simListPageId);
+}
+
+/// @brief Show information about a particular SIM card
+void showSimInfo(void* arg = NULL)
+{
+  const int cursorX = lcd->getCursorX();
+  const int cursorY = lcd->getCursorY();
+  Serial.println("Fetching SIM INFO");
+  
+  fob.routers.cache.lock();
+  const PeplinkAPI_WANTable &wanList = fob.routers.cache.wans();
+  if (!wanList.size())
+  {
+    fob.routers.cache.unlock();
+    Serial.println("No WAN found!");
+    lcd->setCursor(cursorX, cursorY);
+    lcd->println("No WAN found!");
+    return;
+  }
+  ssize_t thisItem;
+  for (const PeplinkAPI_WAN &wan : wanList)
+  {
+    if(wan.type == PEPLINKAPI_WAN_TYPE_CELLULAR)
+    {
+      Serial.println("Got Cellular WAN");
+
+      const PeplinkAPI_WAN_Cellular_SIM *simList = wan.cellular.simCards;
+
+      lcd->setCursor(cursorX, cursorY);
+      if(lastSelectedSim >= wan.cellular.simCount)
+      {
+        Serial.println("No SIM found!");
+        lcd->println("No SIM found!");
+        break;
+      }
+      lcd->printf("Name  :SIM %c\n", lastSelectedSim + 'A');
+      if(!simList[lastSelectedSim].detected)
+      {
+        lcd->setTextColor(RED, BLACK);
+        lcd->println(" (No Sim Detected)");
+        lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+        break;
+      }
+      lcd->printf("Active:%s\n", simList[lastSelectedSim].active ? "true" : "false");
+      lcd->printf("ICCID :%s\n", simList[lastSelectedSim].iccid);  
+      break;
+    }
+  }
+  fob.routers.cache.unlock();
+}
+
+/// @brief Return the menu item indicator colour matching a WAN status LED
+uint16_t wanLedColour(const char *statusLED)
+{
+  if (!strcmp(statusLED, "red"))
+    return RED;
+  if (!strcmp(statusLED, "yellow"))
+    return YELLOW;
+  if (!strcmp(statusLED, "green"))
+    return GREEN;
+  if (!strcmp(statusLED, "flash"))
+    return WHITE;
+  return TFT_GREY;
+}
+
+/// @brief Fill the WAN list page from the cached WAN status, replacing what it shows
+/// @param arg Non-NULL if the WAN status could be fetched
+void buildWanList(void *arg)
+{
+  MinuPage *page = fob.menu.pages()[routerWANListPageId];
+  page->removeAllItems();
+  wanListCount = 0;
+
+  if (!arg)
+  {
+    Serial.println("Fetching WAN list failed!");
+    page->addItem(goToRouterPage, NULL, NULL);
+    uiRequestRender();
+    uiPost(drawPageError, (void *)"Unavailable!", routerWANListPageId);
+    return;
+  }
+
+  fob.routers.cache.lock();
+  const PeplinkAPI_WANTable &wanList = fob.routers.cache.wans();
+  if (!wanList.size())
+  {
+    fob.routers.cache.unlock();
+    page->addItem(goToRouterPage, NULL, NULL);
+    Serial.println("No WAN found!");
+    uiRequestRender();
+    uiPost(drawPageMessage, (void *)"No WAN found!", routerWANListPageId);
+    return;
+  }
+  ssize_t thisItem;
+  for (const PeplinkAPI_WAN &wan : wanList)
+  {
+    thisItem = page->addItem(goToRouterWANInfoPage, wan.name, " ");
+    page->items()[thisItem].setAuxTextBackground(wanLedColour(wan.statusLED));
+    wanListIds[wanListCount++] = wan.id;
+  }
+  fob.routers.cache.clearWanChanges();
+  fob.routers.cache.unlock();
+  page->addItem(goToWANSummaryPage, "WAN Summary", NULL);
+  page->addItem(goToSimListPage, "SIM Cards", NULL);
+  page->addItem(goToRouterPage, "<--", NULL);
+  page->highlightItem(0);
+  uiRequestRender();
+}
+
+/// @brief Show a placeholder on the WAN list page until the router view task can build the list
+void drawWanListFetching(void *arg)
+{
+  MinuPage *page = fob.menu.pages()[routerWANListPageId];
+  page->removeAllItems();
+  wanListCount = 0;
+  page->addItem(goToRouterPage, "Fetching...", NULL);
+  page->highlightItem(0);
+  uiRequestRender();
+}
+
+/// @brief Create the list of available WANs. If the WAN status was never fetched, a placeholder is shown
+/// and the router view task fills the list in once it is, so opening the page never waits on the router.
+/// The items are changed on the screen update task, as this runs on whichever task opened the page
+void getWanList(void *arg)
+{
+  Serial.println("Fetching WAN list");
+
+  // Keep the status indicators current while the list is open
+  routerView.parts = PEPLINKAPI_STATE_WAN_STATUS;
+  routerView.type = UI_UPDATE_TYPE_WAN_LIST;
+  fob.routers.cache.watch(routerView.parts);
+
+  if (fob.routers.cache.available(routerView.parts))
+  {
+    uiPost(buildWanList, (void *)1, routerWANListPageId);
+    return;
+  }
+
+  uiPost(drawWanListFetching, NULL, routerWANListPageId);
+  if (fob.tasks.routerView)
+    xTaskNotify(fob.tasks.routerView, UI_ROUTER_VIEW_REDRAW, eSetBits);
+}
+
+/// @brief Recolour the status indicators of the WANs on the WAN list page whose status LED changed
+void drawWanListItems(void *arg)
+{
+  bool updated = false;
+  fob.routers.cache.lock();
+  const PeplinkAPI_WANTable &wanList = fob.routers.cache.wans();
+  for (size_t i = 0; i < wanListCount; ++i)
+  {
+    // WANs that appear or disappear show up the next time the list is opened
+    const PeplinkAPI_WAN *wan = wanList.find(wanListIds[i]);
+    if (!wan || !(wan->changes & PEPLINKAPI_WAN_CHANGED_LED))
+      continue;
+    fob.menu.pages()[routerWANListPageId]->items()[i].setAuxTextBackground(wanLedColour(wan->statusLED));
+    updated = true;
+  }
+  fob.routers.cache.clearWanChanges();
+  fob.routers.cache.unlock();
+  if (updated)
+    uiRequestRender();
+}
+
+/// @brief Stop waiting for Wi-Fi to connect and go to homepage
+void cancelWiFiSetup(void *arg)
+{
+  fob.wifi.usePrimarySsid = true;
+  WiFi.mode(WIFI_MODE_NULL);
+  if(fob.booting || lastVisitedPageId == countdownPageId)
+    showPage(homePageId);
+  else
+    showPage(lastVisitedPageId);
+}
+
+/// @brief Save the selected SSID as primary or secondary
+void saveSSID(void *arg)
+{
+  if (!arg)
+    return;
+
+  MinuPageItem *thisItem = (MinuPageItem *)arg;
+
+  Serial.printf("Saved %s SSID: '%s'\n", thisItem->mainText(), tempSSID.c_str());
+  if (!strcmp(thisItem->mainText(), "Primary"))
+  {
+    fob.wifi.ssidStaPrimary = tempSSID;
+    fob.wifi.usePrimarySsid = true;
+  }
+  else
+    fob.wifi.ssidStaSecondary = tempSSID;
+  savePreferences();
+  goToWiFiPage();
+}
+
+/// @brief Save selected SSID
+void saveItemSSID(void *arg)
+{
+  if (!arg)
+    return;
+
+  MinuPageItem *thisItem = (MinuPageItem *)arg;
+  tempSSID = thisItem->mainText();
+
+  showPage(saveSSIDAsPageId);
+}
+
+/// @brief Delete all child items of a menu page
+void deleteAllPageItems(void *arg)
+{
+  if (!arg)
+    return;
+
+  MinuPage *thisPage = (MinuPage *)arg;
+  thisPage->removeAllItems();
+}
+
+void wanListPageClosed(void *arg)
+{
+  if (!arg)
+    return;
+  MinuPage *thisPage = (MinuPage *)arg;
+  lastSelectedWAN = thisPage->highlightedItem().mainText();
+  stopDataUpdate();
+  deleteAllPageItems(arg);
+}
+
+void simListPageClosed(void *arg)
+{
+  if (!arg)
+    return;
+  MinuPage *thisPage = (MinuPage *)arg;
+  lastSelectedSim = thisPage->highlightedIndex();
+  deleteAllPageItems(arg);
+}
+
+/// @brief Print the outcome of a Wi-Fi scan that found \a arg networks
+void drawWiFiScanResult(void *arg)
+{
+  int n = (intptr_t)arg;
+  lcd->print("Scan ");
+  if (n == 0)
+    lcd->println("done. 0 found.");
+  else if (n < 0)
+    lcd->printf("error %d!\n", n);
+  else
+    lcd->printf("done. %d found\n", n);
+}
+
+/// @brief Perform a Wi-Fi scan
+void startWiFiScan(void *arg)
+{
+  goToScanResultPage();
+  uiRequestRender(true);
+
+  fob.wifi.timedOut = true;
+  WiFi.mode(WIFI_MODE_NULL);
+  delay(100);
+  WiFi.mode(WIFI_MODE_STA);
+
+  uiPost(drawPageMessage, (void *)"Scanning...", scanResultPageId);
+  int n = WiFi.scanNetworks();
+  // The scan result is drawn before the found networks are added, so that they are not listed over it
+  uiPost(drawWiFiScanResult, (void *)(intptr_t)n, scanResultPageId, true);
+
+  if (n > 0)
+  {
+    for (int i = 0; i < n; ++i)
+      fob.menu.pages()[scanResultPageId]->addItem(saveItemSSID, WiFi.SSID(i).c_str(), String(WiFi.RSSI(i)).c_str());
+
+    WiFi.scanDelete();
+  }
+    
+  delay(3000);
+  fob.menu.pages()[scanResultPageId]->addItem(goToWiFiPage, "<--", NULL);
+  uiRequestRender(true);
+}
+
+void startShutdownCountdown(void *arg = NULL)
+{
+  fob.menu.pages()[countdownPageId]->setTitle("SHUTDOWN");
+  if (fob.menu.currentPageId() != countdownPageId)
+    goToCountdownPage();
+
+  if (fob.tasks.countdown)
+    vTaskDelete(fob.tasks.countdown);
+  xTaskCreatePinnedToCore(countdownTask, "Shutdown Countdown", 2048, (void *)UI_COUNTDOWN_TYPE_SHUTDOWN, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
+}
+
+void startRebootCountdown(void *arg = NULL)
+{
+  fob.menu.pages()[countdownPageId]->setTitle("REBOOT");
+  if (fob.menu.currentPageId() != countdownPageId)
+    goToCountdownPage();
+
+  if (fob.tasks.countdown)
+    vTaskDelete(fob.tasks.countdown);
+  xTaskCreatePinnedToCore(countdownTask, "Reboot Countdown", 2048, (void *)UI_COUNTDOWN_TYPE_REBOOT, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
+}
+
+void startFactoryResetCountdown(void *arg = NULL)
+{
+  fob.menu.pages()[countdownPageId]->setTitle("FACTORY RESET REBOOT");
+  if (fob.menu.currentPageId() != countdownPageId)
+    goToCountdownPage();
+
+  if (fob.tasks.countdown)
+    vTaskDelete(fob.tasks.countdown);
+  xTaskCreatePinnedToCore(countdownTask, "Reset Countdown", 2048, (void *)UI_COUNTDOWN_TYPE_FACTORY_RESET, 2, &fob.tasks.countdown, ARDUINO_RUNNING_CORE);
+}
+
+void initiateFactoryReset(void *arg = NULL)
+{
+  resetPreferences();
+  savePreferences();
+  startFactoryResetCountdown();
+}
+
+void startRouterRemoteReboot(void *arg = NULL)
+{
+  fob.routers.router.remoterReboot();
+}
+
+void uiMenuInit(void)
+{
+  screenCanvasInit();
+
+  MinuPage countdownPage(NULL, fob.menu.numPages());
+  countdownPage.setOpenedCallback(pageOpenedCallback);
+  countdownPage.setClosedCallback(pageClosedCallback);
+  countdownPage.setRenderedCallback(pageRenderedCallback);
+  countdownPageId = fob.menu.addPage(countdownPage);
+
+  MinuPage homePage("1SIMPLECONNECT", fob.menu.numPages());
+  homepageWifiItem = homePage.addItem(goToWiFiPage, "Wi-Fi", " ", updateWiFiItem);
+  homePage.addItem(goToPingTargetsPage, "Network Diags", NULL);
+  homePage.addItem(goToLinkQualityPage, "Link Quality", NULL);
+  homePage.addItem(goToRouterPage, "Router", NULL);
+  homePage.addItem(goToTimePage, "Time", NULL);
+  homePage.addItem(goToSensorsPage, "Sensors", NULL);
+  homePage.addItem(goToFobInfoPage, "Fob Info", NULL);
+  homePage.addItem(startShutdownCountdown, "ShutDown", NULL);
+  homePage.addItem(startRebootCountdown, "Reboot", NULL);
+  homePage.addItem(goToFactoryResetPage, "Factory Reset", NULL);
+  homePage.setOpenedCallback(pageOpenedCallback);
+  homePage.setClosedCallback(pageClosedCallback);
+  homePage.setRenderedCallback(pageRenderedCallback);
+  homePageId = fob.menu.addPage(homePage);
+
+  MinuPage wifiPage("WI-FI", fob.menu.numPages());
+  wifiPage.addItem(startWiFiConnectCountdown, "Connect STA", NULL);
+  wifiPage.addItem(startWiFiAP, "Start AP", NULL);
+  wifiPage.addItem(startWiFiScan, "Scan", NULL);
+  wifiStatusItem = wifiPage.addItem(goToHomePage, "<--", NULL);
+  wifiPage.setOpenedCallback(pageOpenedCallback);
+  wifiPage.setClosedCallback(pageClosedCallback);
+  wifiPage.setRenderedCallback(lcdPrintWiFiStatus);
+  wifiPageId = fob.menu.addPage(wifiPage);
+
+  MinuPage wifiPromptPage("WI-FI DISCON", fob.menu.numPages());
+  wifiPromptPage.addItem(startWiFiConnectCountdown, "Retry STA", NULL);
+  wifiPromptPage.addItem(startWiFiAP, "Start AP", NULL);
+  wifiPromptPage.addItem(cancelWiFiSetup, "Cancel", NULL);
+  wifiPromptPage.setOpenedCallback(pageOpenedCallback);
+  wifiPromptPage.setClosedCallback(pageClosedCallback);
+  wifiPromptPage.setRenderedCallback(pageRenderedCallback);
+  wifiPromptPageId = fob.menu.addPage(wifiPromptPage);
+
+  MinuPage saveSSIDAsPage("SAVE SSID AS", fob.menu.numPages());
+  saveSSIDAsPage.addItem(saveSSID, "Primary", NULL);
+  saveSSIDAsPage.addItem(saveSSID, "Secondary", NULL);
+  saveSSIDAsPage.addItem(goToWiFiPage, "<--", NULL);
+  saveSSIDAsPage.setOpenedCallback(pageOpenedCallback);
+  saveSSIDAsPage.setClosedCallback(pageClosedCallback);
+  saveSSIDAsPage.setRenderedCallback(pageRenderedCallback);
+  saveSSIDAsPageId = fob.menu.addPage(saveSSIDAsPage);
+
+  MinuPage scanResultPage("SCAN RESULT", fob.menu.numPages());
+  scanResultPage.setOpenedCallback(pageOpenedCallback);
+  scanResultPage.setClosedCallback(deleteAllPageItems);
+  scanResultPage.setRenderedCallback(pageRenderedCallback);
+  scanResultPageId = fob.menu.addPage(scanResultPage);
+
+  MinuPage pingTargetsPage("NETWORK DIAG", fob.menu.numPages());
+  for (PingTarget target : fob.pingTargets)
+    pingTargetsPage.addItem(NULL, target.displayHostname.c_str(), " ");
+  pingTargetsPage.addItem(goToHomePage, "<--", NULL);
+  pingTargetsPage.setOpenedCallback(startDataUpdate);
+  pingTargetsPage.setClosedCallback(stopDataUpdate);
+  pingTargetsPage.setRenderedCallback(pageRenderedCallback);
+  pingTargetsPageId = fob.menu.addPage(pingTargetsPage);
+
+  MinuPage routerPage("ROUTER", fob.menu.numPages());
+  routerPage.addItem(goToRouterInfoPage, "Info", NULL);
+  routerPage.addItem(goToRouterLocationPage, "Location", NULL);
+  routerPage.addItem(goToRouterWANListPage, "WAN Status", NULL);
+  routerPage.addItem(startRouterRemoteReboot, "Remote Reboot", NULL);
+  routerPage.addItem(goToHomePage, "<--", NULL);
+  routerPage.setOpenedCallback(pageOpenedCallback);
+  routerPage.setClosedCallback(pageClosedCallback);
+  routerPage.setRenderedCallback(pageRenderedCallback);
+  routerPageId = fob.menu.addPage(routerPage);
+
+  MinuPage routerInfoPage("ROUTER INFO", fob.menu.numPages(), true);
+  routerInfoPage.addItem(goToRouterPage, NULL, NULL);
+  routerInfoPage.setOpenedCallback(pageOpenedCallback);
+  routerInfoPage.setClosedCallback(stopDataUpdate);
+  routerInfoPage.setRenderedCallback(startDataUpdate);
+  routerInfoPageId = fob.menu.addPage(routerInfoPage);
+
+  MinuPage routerLocationPage("ROUTER LOCATION", fob.menu.numPages(), true);
+  routerLocationPage.addItem(goToRouterPage, NULL, NULL);
+  routerLocationPage.setOpenedCallback(pageOpenedCallback);
+  routerLocationPage.setClosedCallback(stopDataUpdate);
+  routerLocationPage.setRenderedCallback(startDataUpdate);
+  routerLocationPageId = fob.menu.addPage(routerLocationPage);
+
+  MinuPage routerUnavailablePage("ROUTER UNAVAILABLE", fob.menu.numPages(), true);
+  routerUnavailablePage.addItem(goToHomePage, NULL, NULL);
+  routerUnavailablePage.setOpenedCallback(pageOpenedCallback);
+  routerUnavailablePage.setClosedCallback(pageClosedCallback);
+  routerUnavailablePage.setRenderedCallback(lcdPrintRouterUnavailable);
+  routerUnavailablePageId = fob.menu.addPage(routerUnavailablePage);
+
+  MinuPage routerWANListPage("WAN LIST", fob.menu.numPages());
+  routerWANListPage.setOpenedCallback(getWanList);
+  routerWANListPage.setClosedCallback(wanListPageClosed);
+  routerWANListPage.setRenderedCallback(pageRenderedCallback);
+  routerWANListPageId = fob.menu.addPage(routerWANListPage);
+
+  MinuPage routerWANInfoPage("WAN STATUS", fob.menu.numPages(), true);
+  routerWANInfoPage.addItem(goToRouterWANListPage, NULL, NULL);
+  routerWANInfoPage.setOpenedCallback(pageOpenedCallback);
+  routerWANInfoPage.setClosedCallback(stopDataUpdate);
+  routerWANInfoPage.setRenderedCallback(startDataUpdate);
+  routerWANInfoPageId = fob.menu.addPage(routerWANInfoPage);
+
+  MinuPage routerWANSummaryPage("WAN STATUS", fob.menu.numPages(), true);
+  routerWANSummaryPage.addItem(goToRouterWANListPage, NULL, NULL);
+  routerWANSummaryPage.setOpenedCallback(pageOpenedCallback);
+  routerWANSummaryPage.setClosedCallback(stopDataUpdate);
+  routerWANSummaryPage.setRenderedCallback(startDataUpdate);
+  routerWANSummaryPageId = fob.menu.addPage(routerWANSummaryPage);
+
+  MinuPage simListPage("SIM LIST", fob.menu.numPages());
+  simListPage.setOpenedCallback(showSimList);
+  simListPage.setClosedCallback(simListPageClosed);
+  simListPage.setRenderedCallback(pageRenderedCallback);
+  simListPageId = fob.menu.addPage(simListPage);
+
+  MinuPage simInfoPage("SIM STATUS", fob.menu.numPages(), true);
+  simInfoPage.addItem(goToSimListPage, NULL, NULL);
+  simInfoPage.setOpenedCallback(pageOpenedCallback);
+  simInfoPage.setClosedCallback(pageClosedCallback);
+  simInfoPage.setRenderedCallback(showSimInfo);
+  simInfoPageId = fob.menu.addPage(simInfoPage);
+
+  MinuPage sensorsPage("SENSORS", fob.menu.numPages(), true);
+  sensorsPage.addItem(goToHomePage, NULL, NULL);
+  sensorsPage.setOpenedCallback(pageOpenedCallback);
+  sensorsPage.setClosedCallback(stopDataUpdate);
+  sensorsPage.setRenderedCallback(startDataUpdate);
+  sensorsPageId = fob.menu.addPage(sensorsPage);
+
+  MinuPage timePage("TIME", fob.menu.numPages(), true);
+  timePage.addItem(goToHomePage, NULL, NULL);
+  timePage.setOpenedCallback(pageOpenedCallback);
+  timePage.setClosedCallback(stopDataUpdate);
+  timePage.setRenderedCallback(startDataUpdate);
+  timePageId = fob.menu.addPage(timePage);
+
+  MinuPage fobInfoPage("FOB INFO", fob.menu.numPages(), true);
+  fobInfoPage.addItem(goToHomePage, NULL, NULL);
+  fobInfoPage.setOpenedCallback(pageOpenedCallback);
+  fobInfoPage.setClosedCallback(stopDataUpdate);
+  fobInfoPage.setRenderedCallback(startDataUpdate);
+  fobInfoPageId = fob.menu.addPage(fobInfoPage);
+
+  MinuPage linkQualityPage("LINK QUALITY", fob.menu.numPages(), true);
+  linkQualityPage.addItem(goToHomePage, NULL, NULL);
+  linkQualityPage.setOpenedCallback(pageOpenedCallback);
+  linkQualityPage.setClosedCallback(stopDataUpdate);
+  linkQualityPage.setRenderedCallback(startDataUpdate);
+  linkQualityPageId = fob.menu.addPage(linkQualityPage);
+
+  MinuPage factoryResetPage("FACTORY RESET", fob.menu.numPages());
+  factoryResetPage.addItem(initiateFactoryReset, "Factory Reset", NULL);
+  factoryResetPage.addItem(goToHomePage, "Cancel", NULL);
+  factoryResetPage.setOpenedCallback(pageOpenedCallback);
+  factoryResetPage.setClosedCallback(pageClosedCallback);
+  factoryResetPage.setRenderedCallback(pageRenderedCallback);
+  factoryResetPageId = fob.menu.addPage(factoryResetPage);
+
+  String cookie;
+   if ( homePageId < 0 ||
+        wifiPageId < 0 ||
+        wifiPromptPageId < 0 ||
+        scanResultPageId < 0 ||
+        saveSSIDAsPageId < 0 ||
+        routerPageId < 0 ||
+        routerInfoPageId < 0 ||
+        routerLocationPageId < 0 ||
+        routerUnavailablePageId < 0 ||
+        routerWANListPageId < 0 ||
+        routerWANInfoPageId < 0 ||
+        timePageId < 0 ||
+        countdownPageId < 0 ||
+        fobInfoPageId < 0 ||
+        linkQualityPageId < 0)
+      goto err;
+      
+   lastVisitedPageId = wifiPageId;
+
+  fob.buttons.events = xQueueCreate(UI_BUTTON_EVENT_QUEUE_LENGTH, sizeof(StarlinkFob_ButtonEvent_t));
+  buttonEdges = xQueueCreate(UI_BUTTON_EDGE_QUEUE_LENGTH, sizeof(UiButtonEdge));
+  xTaskCreatePinnedToCore(screenWatchTask, "Screen Watch Task", 4096, NULL, 1, &fob.tasks.screenWatch, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(screenUpdateTask, "Screen Update Task", 8192, NULL, 1, &fob.tasks.screenUpdate, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(buttonWatchTask, "Button Task", 4096, NULL, 1, &fob.tasks.buttonWatch, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(connectionTask, "Connection Task", 4096, NULL, 1, &fob.tasks.connection, ARDUINO_RUNNING_CORE);
+  WiFi.onEvent(onWiFiEvent);
+  xTaskCreatePinnedToCore(routerViewTask, "Router View", 4096, NULL, 2, &fob.tasks.routerView, ARDUINO_RUNNING_CORE);
+  xTaskCreatePinnedToCore(dataUpdateTask, "Data Update", 4096, NULL, 2, &fob.tasks.dataUpdate, ARDUINO_RUNNING_CORE);
+  fob.dns.begin();
+  fob.routers.router.setResolver(&fob.dns);
+  for (PingTarget &target : fob.pingTargets)
+    fob.links.addTarget(target.displayHostname.c_str(), target.useIP ? target.pingIP.toString().c_str() : target.fqn.c_str());
+  fob.links.begin(&fob.dns);
+  fob.routers.cache.begin(&fob.routers.router);
+  startWiFiConnectCountdown();
+
+  while(fob.booting)
+    delay(10);
+
+  if (WiFi.status() == WL_CONNECTED)
+  {
+    fob.routers.router.setIP(fob.routers.ip);
+    fob.routers.router.setPort(fob.routers.port);
+    cookie = fob.routers.router.begin(fob.routers.username, fob.routers.password, fob.routers.clientName, fob.routers.clientScope, true);
+    if (!cookie.length())
+      Serial.println("!!Router init Fail!!");
+    else
+    {
+      Serial.println("Router connected!");
+      if(fob.menu.currentPageId() == pingTargetsPageId)
+        goToRouterWANListPage();
+    }
+  }
+  return;
+
+err:
+  while (1)
+  {
+    delay(1000);
+    Serial.println("Failed to init menu!");
+  }
+}
+
+/// @brief Watch for any detected button press and manipulate UI accordingly
+void screenWatchTask(void *arg)
+{
+  Serial.println("Started screenWatchTask");
+  ssize_t lastSelectedPage = fob.menu.currentPageId();
+  ssize_t lastHighlightedItem = fob.menu.currentPage()->highlightedIndex();
+
+  bool updateScreen = false;
+  long lastStackCheckTime = 0;
+
+  // Note a page change, whether made by a press or by another task since the last press
+  auto trackPage = [&]()
+  {
+    if (lastSelectedPage != fob.menu.currentPageId())
+    {
+#ifdef UI_DEBUG_LOG
+      Serial.printf("Changed from page %d to page %d\n", lastSelectedPage, fob.menu.currentPageId());
+#endif
+      lastVisitedPageId = lastSelectedPage;
+      lastSelectedPage = fob.menu.currentPageId();
+      lastHighlightedItem = fob.menu.currentPage()->highlightedIndex();
+    }
+  };
+
+  // Draw the page shown at boot without waiting for a press
+  if (!fob.menu.rendered())
+    uiRequestRender();
+
+  for (;;)
+  {
+    // Sleep until a button is pressed. Tasks that change the page queue its render themselves through showPage()
+    StarlinkFob_ButtonEvent_t event;
+    xQueueReceive(fob.buttons.events, &event, portMAX_DELAY);
+    trackPage();
+    const StarlinkFob_ButtonPress_t pressA = (event.button == STARLINKFOB_BUTTON_A) ? event.press : STARLINKFOB_BUTTONPRESS_NONE;
+    const StarlinkFob_ButtonPress_t pressB = (event.button == STARLINKFOB_BUTTON_B) ? event.press : STARLINKFOB_BUTTONPRESS_NONE;
+    const StarlinkFob_ButtonPress_t pressC = (event.button == STARLINKFOB_BUTTON_C) ? event.press : STARLINKFOB_BUTTONPRESS_NONE;
+
+    // If a short press of A is detected, highlight the next item
+    if (pressA == STARLINKFOB_BUTTONPRESS_SHORT)
+    {
+#ifdef UI_BEEP
+      M5.Speaker.tone(8000, 30);
+#endif
+      if (fob.menu.currentPageId() != countdownPageId)
+      {  
+        fob.menu.currentPage()->highlightNextItem();
+        if(lastHighlightedItem != fob.menu.currentPage()->highlightedIndex())
+          updateScreen = true;
+      }
+    }
+
+    // If a long press of A or short press of B is detected, select the currently highlighted item
+    if (pressA >= STARLINKFOB_BUTTONPRESS_LONG || pressB == STARLINKFOB_BUTTONPRESS_SHORT)
+    {
+#ifdef UI_BEEP
+      M5.Speaker.tone(5000, 30);
+#endif
+      if (fob.menu.currentPageId() != countdownPageId && fob.menu.currentPage()->highlightedIndex() >= 0)
+      {
+        MinuPageItem highlightedItem = fob.menu.currentPage()->highlightedItem();
+        if (highlightedItem.link())
+          highlightedItem.link()(&highlightedItem);
+#ifdef UI_DEBUG_LOG
+        Serial.printf("Executed selected item link = %p\n", highlightedItem.link());
+#endif
+      }
+    }
+
+    // If a long press of B is detected, cancel any ongoing shutdown
+    if (pressB >= STARLINKFOB_BUTTONPRESS_LONG)
+    {
+      if (fob.tasks.countdown)
+        xTaskNotify(fob.tasks.countdown, 1, eSetValueWithOverwrite);
+    }
+
+    if (pressC == STARLINKFOB_BUTTONPRESS_SHORT)
+    {
+      if(!fob.booting && lastVisitedPageId != countdownPageId && lastVisitedPageId != scanResultPageId)
+      {
+        size_t tmp = lastSelectedPage;
+        lastSelectedPage = fob.menu.currentPageId();
+        showPage(tmp);
+      }
+    }
+
+    // Holding C starts the shutdown countdown, which a long press of B cancels
+    if (pressC == STARLINKFOB_BUTTONPRESS_SHUTDOWN && !fob.booting)
+      startShutdownCountdown();
+
+    trackPage();
+
+    // If the highlighted item has changed, log the change
+    if (lastHighlightedItem != fob.menu.currentPage()->highlightedIndex())
+    {
+#ifdef UI_DEBUG_LOG
+      Serial.printf("Highlighted item changed: Old = %d | New = %d\n", lastHighlightedItem, fob.menu.currentPage()->highlightedIndex());
+#endif
+      lastHighlightedItem = fob.menu.currentPage()->highlightedIndex();
+    }
+
+    if (updateScreen || !fob.menu.rendered())
+    {
+      updateScreen = false;
+      if (fob.tasks.countdown && fob.menu.currentPageId() != countdownPageId)
+      {
+        vTaskDelete(fob.tasks.countdown);
+        fob.tasks.countdown = NULL;
+      }
+
+      uiRequestRender(true);
+    }
+
+#ifdef UI_DEBUG_LOG
+    if (lastStackCheckTime + 10000 < millis())
+    {
+      Serial.printf("Screen Watch Task available stack:  %d * %d bytes\n", uxTaskGetStackHighWaterMark(NULL), sizeof(portBASE_TYPE));
+      lastStackCheckTime = millis();
+    }
+#endif
+  }
+}
+
+/// @brief Interrupt handler shared by the button pins.
+/// It only timestamps the edge and hands it over; everything else happens in the button task
+static void IRAM_ATTR buttonIsr(void *arg)
+{
+  UiButtonEdge edge = {(uint8_t)(uintptr_t)arg, (uint32_t)(esp_timer_get_time() / 1000)};
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(buttonEdges, &edge, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+
+/// @brief Classify a press by how long the button was held
+static StarlinkFob_ButtonPress_t classifyPress(uint32_t durationMs)
+{
+  if (durationMs >= SHUTDOWN_PRESS_THRESHOLD_MS)
+    return STARLINKFOB_BUTTONPRESS_SHUTDOWN;
+  if (durationMs > LONG_PRESS_THRESHOLD_MS)
+    return STARLINKFOB_BUTTONPRESS_LONG;
+  return STARLINKFOB_BUTTONPRESS_SHORT;
+}
+
+/// @brief Turns button pin edges into debounced, classified presses for the screen watch task.
+/// Blocks until an edge arrives, only waking up otherwise to settle an edge or to beep once a held button becomes a long press
+void buttonWatchTask(void *arg)
+{
+  Serial.println("buttonWatchTask started");
+
+  long lastStackCheckTime = 0;
+  bool settling[STARLINKFOB_BUTTON_COUNT] = {};   // An edge was seen and the pin is left to settle
+  uint32_t edgeTime[STARLINKFOB_BUTTON_COUNT];    // Time of the first edge of the settling pin
+  bool pressed[STARLINKFOB_BUTTON_COUNT] = {};
+  uint32_t pressTime[STARLINKFOB_BUTTON_COUNT];
+  bool beeped[STARLINKFOB_BUTTON_COUNT] = {};
+  const uint16_t longPressTone[STARLINKFOB_BUTTON_COUNT] = {9000, 7000, 0};
+
+  for (size_t i = 0; i < STARLINKFOB_BUTTON_COUNT; ++i)
+  {
+    pinMode(buttonPins[i], INPUT);
+    attachInterruptArg(buttonPins[i], buttonIsr, (void *)i, CHANGE);
+  }
+
+  for (;;)
+  {
+    uint32_t currentTime = millis();
+    TickType_t timeout = portMAX_DELAY;
+    for (size_t i = 0; i < STARLINKFOB_BUTTON_COUNT; ++i)
+    {
+      int32_t remaining = INT32_MAX;
+      if (settling[i])
+        remaining = BUTTON_DEBOUNCE_MS - (int32_t)(currentTime - edgeTime[i]);
+      else if (pressed[i] && !beeped[i] && longPressTone[i])
+        remaining = LONG_PRESS_THRESHOLD_MS - (int32_t)(currentTime - pressTime[i]);
+      if (remaining != INT32_MAX)
+        timeout = min(timeout, pdMS_TO_TICKS(max(remaining, (int32_t)0)));
+    }
+
+    UiButtonEdge edge;
+    if (xQueueReceive(buttonEdges, &edge, timeout) == pdTRUE && !settling[edge.button])
+    {
+      // The pin is read once it stops bouncing, but the press is timed from its first edge
+      settling[edge.button] = true;
+      edgeTime[edge.button] = edge.timeMs;
+    }
+
+    currentTime = millis();
+    for (size_t i = 0; i < STARLINKFOB_BUTTON_COUNT; ++i)
+    {
+      if (settling[i] && (int32_t)(currentTime - edgeTime[i]) >= BUTTON_DEBOUNCE_MS)
+      {
+        settling[i] = false;
+        bool down = (digitalRead(buttonPins[i]) == LOW);
+        if (down && !pressed[i])
+        {
+          pressed[i] = true;
+          beeped[i] = false;
+          pressTime[i] = edgeTime[i];
+        }
+        else if (!down && pressed[i])
+        {
+          pressed[i] = false;
+          StarlinkFob_ButtonEvent_t event = {(StarlinkFob_Button_t)i, STARLINKFOB_BUTTONPRESS_NONE, edgeTime[i] - pressTime[i]};
+          event.press = classifyPress(event.durationMs);
+#ifdef UI_DEBUG_LOG
+          Serial.printf("%s press %c: %lums\n", event.press == STARLINKFOB_BUTTONPRESS_SHORT ? "Short" :
+                        event.press == STARLINKFOB_BUTTONPRESS_LONG ? "Long" : "Shutdown", 'A' + i, event.durationMs);
+#endif
+          xQueueSend(fob.buttons.events, &event, 0);
+        }
+      }
+
+      // Beep while the button is still held, so the user knows when to let go
+      if (pressed[i] && !beeped[i] && longPressTone[i] && (int32_t)(currentTime - pressTime[i]) >= LONG_PRESS_THRESHOLD_MS)
+      {
+        beeped[i] = true;
+        M5.Speaker.tone(longPressTone[i], 50);
+      }
+    }
+
+#ifdef UI_DEBUG_LOG
+    if (lastStackCheckTime + 10000 < currentTime)
+    {
+      Serial.printf("Button Watch Task available stack:  %d * %d bytes\n", uxTaskGetStackHighWaterMark(NULL), sizeof(portBASE_TYPE));
+      lastStackCheckTime = currentTime;
+    }
+#endif
+  }
+}
+
+/// @brief Clear the page content below the menu
+void clearPageContent(void *arg = NULL)
+{
+  lcd->fillRect(0, contentY, lcd->width(), lcd->height() - contentY, MINU_BACKGROUND_COLOUR_DEFAULT);
+}
+
+/// @brief Print the time left on the countdown page. \a arg packs the countdown type, minutes and seconds
+void drawCountdown(void *arg)
+{
+  uint32_t countdown = (uintptr_t)arg;
+  if ((countdown >> 16) == UI_COUNTDOWN_TYPE_WIFI)
+    lcd->printf("SSID: %s\n\n", (fob.wifi.usePrimarySsid) ? fob.wifi.ssidStaPrimary.c_str() : fob.wifi.ssidStaSecondary.c_str());
+  lcd->setTextSize(7);
+  lcd->printf(" %d:%02d\n\n", (countdown >> 8) & 0xFF, countdown & 0xFF);
+  lcd->setTextSize(TEXT_SIZE_DEFAULT);
+}
+
+/// @brief Replace the Wi-Fi countdown with the network it connected to
+void drawWiFiConnected(void *arg)
+{
+  uiInvalidateScreen();
+  lcd->clear();
+  lcd->setCursor(0, contentY);
+  lcd->printf(" Connected to WiFi:\n %s\n", (fob.wifi.usePrimarySsid) ? fob.wifi.ssidStaPrimary.c_str() : fob.wifi.ssidStaSecondary.c_str());
+}
+
+void countdownTask(void *arg)
+{
+  int8_t sec = 0, min = 0;
+  const int countdownType = (int)arg;
+  uint32_t stopCountdown;
+
+  if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
+  {
+    min = fob.wifi.timeoutMs ? (fob.wifi.timeoutMs / 1000) / 60 : WIFI_COUNTDOWN_SECONDS / 60;
+    sec = fob.wifi.timeoutMs ? (fob.wifi.timeoutMs / 1000) % 60 : WIFI_COUNTDOWN_SECONDS % 60;
+  }
+  else if (countdownType == UI_COUNTDOWN_TYPE_SHUTDOWN)
+  {
+    min = SHUTDOWN_COUNTDOWN_SECONDS / 60;
+    sec = SHUTDOWN_COUNTDOWN_SECONDS % 60;
+  }
+  else if (countdownType == UI_COUNTDOWN_TYPE_REBOOT)
+  {
+    min = REBOOT_COUNTDOWN_SECONDS / 60;
+    sec = REBOOT_COUNTDOWN_SECONDS % 60;
+  }
+  else if( countdownType == UI_COUNTDOWN_TYPE_FACTORY_RESET)
+  {
+    min = REBOOT_COUNTDOWN_SECONDS / 60;
+    sec = REBOOT_COUNTDOWN_SECONDS % 60;
+  }
+  else if( countdownType == UI_COUNTDOWN_TYPE_ROUTER)
+  {
+    min = WIFI_COUNTDOWN_SECONDS / 60;
+    sec = WIFI_COUNTDOWN_SECONDS % 60;
+  }
+  else
+  {
+#ifdef UI_DEBUG_LOG
+    Serial.println("Unspecified countdown type!");
+#endif
+    vTaskDelete(NULL);
+  }
+
+  // Queued behind a render of the countdown page, so it lands below the menu
+  uiRequestRender();
+  uiPost(clearPageContent, NULL, countdownPageId);
+
+  while (min >= 0 || sec >= 0)
+  {
+    if (countdownType == UI_COUNTDOWN_TYPE_WIFI && WiFi.status() == WL_CONNECTED)
+      break;
+    else if(countdownType == UI_COUNTDOWN_TYPE_ROUTER && fob.routers.router.available())
+      break;
+
+    if (--sec < 0)
+    {
+      if (min > 0)
+        sec = 59;
+      else
+      {
+        sec = 0;
+        break;
+      }
+      if (--min < 0)
+        min = 0;
+    }
+
+    uiPost(drawCountdown, (void *)((countdownType << 16) | (min << 8) | sec), countdownPageId);
+#ifdef UI_BEEP
+    M5.Speaker.tone(9000, 50);
+#endif
+    stopCountdown = ulTaskNotifyTake(false, pdMS_TO_TICKS(1000));
+    if (stopCountdown == 1)
+      break;
+  }
+
+  if (sec <= 0 && min <= 0)
+  {
+    if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
+    {
+      if (fob.wifi.usePrimarySsid)
+      {
+        fob.wifi.usePrimarySsid = false;
+        // WiFi.mode(WIFI_MODE_NULL);
+        // delay(100);
+        showPage(lastVisitedPageId);
+        xTaskNotify(fob.tasks.connection, UI_CONNECTION_RETRY, eSetBits);
+      }
+      else
+      {
+        fob.wifi.timedOut = true;
+        goToWiFiPromptPage();
+      }
+
+    }
+    else if (countdownType == UI_COUNTDOWN_TYPE_SHUTDOWN)
+    {
+      Serial.printf("Logging shutdown after %lus...shutting down now!\n", millis() / 1000);
+      logEvent(EVENT_LOG_SHUTDOWN, millis() / 1000);
+      flushStoredCredentials(true);
+      delay(100);
+      M5.Power.powerOff();
+    }
+    else if (countdownType == UI_COUNTDOWN_TYPE_REBOOT)
+    {
+      logEvent(EVENT_LOG_REBOOT, millis() / 1000);
+      flushStoredCredentials(true);
+      ESP.restart();
+    }
+    else if (countdownType == UI_COUNTDOWN_TYPE_ROUTER)
+      goToRouterUnavailablePage();
+  }
+  else
+  {
+    if (countdownType == UI_COUNTDOWN_TYPE_WIFI)
+    {
+      if (stopCountdown)
+      {
+        fob.wifi.timedOut = true;
+        goToWiFiPromptPage();
+      }
+      else if (fob.booting)
+      {  
+        uiPost(drawWiFiConnected, NULL, countdownPageId);
+        vTaskDelay(2000);
+        if(!fob.servers.started)
+        {
+          fob.servers.started = true;
+          Serial.println("Starting HTTP Server");
+          startHttpServer();
+        }
+        goToPingTargetsPage();
+        xTaskNotify(fob.tasks.connection, UI_CONNECTION_START, eSetBits);
+      }
+      else
+      {  
+        uiPost(drawWiFiConnected, NULL, countdownPageId);
+        vTaskDelay(2000);
+        showPage(lastVisitedPageId);
+      }
+    }
+    else if (countdownType == UI_COUNTDOWN_TYPE_SHUTDOWN || countdownType == UI_COUNTDOWN_TYPE_REBOOT)
+      goToHomePage();
+    else if (countdownType == UI_COUNTDOWN_TYPE_ROUTER)
+    {
+      if (stopCountdown)
+        goToRouterUnavailablePage();
+      else if(lastVisitedPageId == pingTargetsPageId)
+        goToRouterWANListPage();
+      else
+        showPage(lastVisitedPageId);
+    }
+  }
+
+#ifdef UI_BEEP
+  M5.Speaker.tone(9000, 300);
+#endif
+
+  fob.tasks.countdown = NULL;
+  vTaskDelete(NULL);
+}
+
+/// @brief Return the page whose data is refreshed by a UiUpdateType
+ssize_t updateTypePage(int updateType)
+{
+  switch (updateType)
+  {
+  case UI_UPDATE_TYPE_TIME: return timePageId;
+  case UI_UPDATE_TYPE_SENSORS: return sensorsPageId;
+  case UI_UPDATE_TYPE_WAN_INFO: return routerWANInfoPageId;
+  case UI_UPDATE_TYPE_FOB_INFO: return fobInfoPageId;
+  case UI_UPDATE_TYPE_PING: return pingTargetsPageId;
+  case UI_UPDATE_TYPE_WAN_SUMMARY: return routerWANSummaryPageId;
+  case UI_UPDATE_TYPE_WAN_LIST: return routerWANListPageId;
+  case UI_UPDATE_TYPE_LINK_QUALITY: return linkQualityPageId;
+  case UI_UPDATE_TYPE_ROUTER_INFO: return routerInfoPageId;
+  case UI_UPDATE_TYPE_ROUTER_LOCATION: return routerLocationPageId;
+  }
+  return -1;
+}
+
+/// @brief Print the periodically updated data of a page. Runs on the screen update task
+void drawDataUpdate(void *arg)
+{
+  int updateType = (int)arg;
+  if (updateType == UI_UPDATE_TYPE_TIME)
+    lcdPrintTime();
+  else if(updateType == UI_UPDATE_TYPE_SENSORS)
+    lcdPrintSensors();
+  else if (updateType == UI_UPDATE_TYPE_FOB_INFO)
+    lcdPrintFobInfo();
+  else if (updateType == UI_UPDATE_TYPE_LINK_QUALITY)
+    lcdPrintLinkQuality();
+}
+
+/// @brief Refreshes the open page's data every second, for as long as the page set by startDataUpdate() is shown.
+/// The task lives as long as the fob and idles between pages, so it is never deleted while it holds a lock
+void dataUpdateTask(void *arg)
+{
+  int updateType = 0;
+  ssize_t page = -1;
+  bool changed = true;    // Picks up a page opened before the task started
+
+  for (;;)
+  {
+    if (changed)
+    {
+      updateType = dataUpdateType;
+      page = updateTypePage(updateType);
+      if (updateType)
+      {
+#ifdef UI_DEBUG_LOG
+        Serial.printf("Started data update: type %d\n", updateType);
+#endif
+        // The sensors are set up here rather than on the screen update task, which runs the page callbacks
+        if (updateType == UI_UPDATE_TYPE_SENSORS)
+        {
+          fob.sensors.shtAvailable = fob.sensors.sht.begin(&Wire, SHT3X_I2C_ADDR, 0, 26, 400000U);
+          fob.sensors.qmpAvailable = fob.sensors.qmp.begin(&Wire, QMP6988_SLAVE_ADDRESS_L, 0, 26, 400000U);
+        }
+
+        // Queued behind a render of the page, so it lands below the menu
+        uiRequestRender();
+        uiPost(clearPageContent, NULL, page);
+      }
+    }
+
+    if (updateType)
+    {
+      Serial.printf("Update type %d started\n", updateType);
+
+      // Anything that blocks, like the NTP sync or the sensor reads, is done here,
+      // so the screen update task only draws what was read
+      if (updateType == UI_UPDATE_TYPE_TIME)
+        readTime();
+      else if (updateType == UI_UPDATE_TYPE_SENSORS)
+        readSensors();
+
+      if (updateType == UI_UPDATE_TYPE_PING)
+        updatePingTargetsStatus();
+      else
+        uiPost(drawDataUpdate, (void *)updateType, page);
+
+      Serial.printf("Update type %d done\n", updateType);
+
+      if (updateType == UI_UPDATE_TYPE_PING && fob.booting && fob.pingTargets[0].pingOK)
+      {
+        fob.booting = false;
+        updateType = 0;
+      }
+    }
+
+    // Wait a second before the next update, or until the page is left or another one opened
+    changed = ulTaskNotifyTake(pdTRUE, updateType ? pdMS_TO_TICKS(1000) : portMAX_DELAY) > 0;
+  }
+}
+
+/// @brief Clear the open router page, showing the loading icon if its state has never been fetched
+void drawRouterViewLoading(void *arg)
+{
+  clearPageContent();
+  if (!fob.routers.cache.available(routerView.parts))
+    lcd->drawBitmap(200, contentY, 40, 40, loading, 0);
+}
+
+/// @brief Draw the open router page from the cache. \a arg holds UI_ROUTER_VIEW_REDRAW for a full redraw,
+/// and the parts of the page that could be fetched
+void drawRouterView(void *arg)
+{
+  uint32_t flags = (uintptr_t)arg;
+  bool redraw = flags & UI_ROUTER_VIEW_REDRAW;
+  if (routerView.type == UI_UPDATE_TYPE_WAN_INFO)
+    lcdPrintRouterWANInfo(redraw);
+  else if (routerView.type == UI_UPDATE_TYPE_WAN_SUMMARY)
+    printRouterWanStatus(redraw, flags & routerView.parts);
+  else if (routerView.type == UI_UPDATE_TYPE_ROUTER_INFO)
+    lcdPrintRouterInfo(flags & routerView.parts);
+  else if (routerView.type == UI_UPDATE_TYPE_ROUTER_LOCATION)
+    lcdPrintRouterLocation(flags & routerView.parts);
+}
+
+/// @brief Draws the open router page whenever the cached router state it shows changes
+void routerViewTask(void *arg)
+{
+  fob.routers.cache.subscribe(xTaskGetCurrentTaskHandle());
+
+  uint32_t events;
+  for (;;)
+  {
+    xTaskNotifyWait(0, ULONG_MAX, &events, portMAX_DELAY);
+
+    int viewType = routerView.type;
+    if (!viewType)
+      continue;
+    if (!(events & UI_ROUTER_VIEW_REDRAW) && !(events & routerView.parts))
+      continue;
+
+#ifdef UI_DEBUG_LOG
+    Serial.printf("Router view update: type %d, events 0x%03lx\n", viewType, events);
+#endif
+    // The WAN list is drawn by the menu. It is built here only if it was opened before the WAN status was fetched.
+    // Otherwise only its changed indicators are updated. Both happen on the screen update task,
+    // so the items never change under a render, and are dropped if the list was closed in the meantime
+    if (viewType == UI_UPDATE_TYPE_WAN_LIST)
+    {
+      if (events & UI_ROUTER_VIEW_REDRAW)
+      {
+        bool available = fob.routers.cache.waitFor(routerView.parts);
+        uiPost(buildWanList, (void *)available, routerWANListPageId, true);
+      }
+      else
+        uiPost(drawWanListItems, NULL, routerWANListPageId);
+      continue;
+    }
+
+    // Otherwise only the WANs that changed are drawn again, unless the page was just opened.
+    // The waiting happens here so that the screen update task never blocks on the router
+    ssize_t page = updateTypePage(viewType);
+    bool redraw = events & UI_ROUTER_VIEW_REDRAW;
+    if (redraw)
+      uiPost(drawRouterViewLoading, NULL, page);
+    bool available = fob.routers.cache.waitFor(routerView.parts);
+    uiPost(drawRouterView, (void *)((redraw ? UI_ROUTER_VIEW_REDRAW : 0) | (available ? routerView.parts : 0)), page, true);
+  }
+}
+
+void uiInvalidateScreen(void)
+{
+  screenInvalid = true;
+  markScreenRows(0, lcd->height());
+}
+
+/// @brief Add the canvas pixel rows from \a top up to \a bottom to the band sent by the next push
+static void markScreenRows(int top, int bottom)
+{
+  dirtyTop = min(dirtyTop, max(top, 0));
+  dirtyBottom = max(dirtyBottom, min(bottom, (int)lcd->height()));
+}
+
+/// @brief Forget the menu text of the cell rows between two cursor positions, after something else drew over them
+static void invalidateScreenRows(int fromY, int toY)
+{
+  for (int row = max(fromY / UI_CELL_HEIGHT, 0); row <= toY / UI_CELL_HEIGHT && row < UI_SCREEN_ROWS; ++row)
+    memset(screenCells[row], 0, sizeof(screenCells[row]));
+}
+
+void uiPrintText(const char *text, uint16_t fore, uint16_t back)
+{
+  const int x = lcd->getCursorX();
+  const int y = lcd->getCursorY();
+  const size_t len = strlen(text);
+  frameStats.cellsTotal += len;
+  lcd->setTextColor(fore, back);
+
+  // Text off the cell grid, in another size or spanning lines can't be tracked, so it is always drawn
+  if (lcd->getTextSizeX() != TEXT_SIZE_DEFAULT || x % UI_CELL_WIDTH || y % UI_CELL_HEIGHT || y / UI_CELL_HEIGHT >= UI_SCREEN_ROWS ||
+      x / UI_CELL_WIDTH + len > UI_SCREEN_COLS || strpbrk(text, "\r\n"))
+  {
+    lcd->print(text);
+    frameStats.cellsDrawn += len;
+    // A bare line break moves the cursor without drawing anything
+    if (strspn(text, "\r\n") != len)
+    {
+      invalidateScreenRows(y, lcd->getCursorY());
+      markScreenRows(y, lcd->getCursorY() + lcd->fontHeight());
+    }
+    return;
+  }
+
+  // Push only the runs of cells that differ from what is already on screen
+  UiScreenCell *cells = &screenCells[y / UI_CELL_HEIGHT][x / UI_CELL_WIDTH];
+  size_t i = 0;
+  while (i < len)
+  {
+    if (cells[i].c == text[i] && cells[i].fore == fore && cells[i].back == back)
+    {
+      cells[i++].frame = screenFrame;
+      continue;
+    }
+
+    size_t start = i;
+    for (; i < len && (cells[i].c != text[i] || cells[i].fore != fore || cells[i].back != back); ++i)
+      cells[i] = {text[i], fore, back, screenFrame};
+
+    lcd->setCursor(x + start * UI_CELL_WIDTH, y);
+    lcd->printf("%.*s", (int)(i - start), text + start);
+    markScreenRows(y, y + UI_CELL_HEIGHT);
+    frameStats.cellsDrawn += i - start;
+  }
+  lcd->setCursor(x + len * UI_CELL_WIDTH, y);
+}
+
+/// @brief Render the menu, pushing only the cells that changed since the last render of the same page layout
+void renderMenu(void)
+{
+  static ssize_t lastPageId = -1;
+  static size_t lastItemCount = 0;
+
+  uint32_t start = micros();
+  frameStats.cellsDrawn = 0;
+  frameStats.cellsTotal = 0;
+  screenFrame++;
+
+  // A new page, or items added to or removed from this one, moves everything, so start from a blank screen
+  size_t itemCount = fob.menu.currentPage()->items().size();
+  if (screenInvalid || fob.menu.currentPageId() != lastPageId || itemCount != lastItemCount)
+  {
+    screenInvalid = false;
+    lastPageId = fob.menu.currentPageId();
+    lastItemCount = itemCount;
+    memset(screenCells, 0, sizeof(screenCells));
+    lcd->clear();
+    markScreenRows(0, lcd->height());
+  }
+
+  lcd->setCursor(0, 0);
+  lcd->setTextSize(TEXT_SIZE_DEFAULT);
+  fob.menu.render(MINU_ITEM_MAX_COUNT);
+  contentX = lcd->getCursorX();
+  contentY = lcd->getCursorY();
+
+  // Blank any menu text left over from the last render that this one didn't print over
+  for (size_t row = 0; row < UI_SCREEN_ROWS; ++row)
+  {
+    for (size_t col = 0; col < UI_SCREEN_COLS; ++col)
+    {
+      UiScreenCell &cell = screenCells[row][col];
+      if (!cell.c || cell.frame == screenFrame)
+        continue;
+      lcd->fillRect(col * UI_CELL_WIDTH, row * UI_CELL_HEIGHT, UI_CELL_WIDTH, UI_CELL_HEIGHT, MINU_BACKGROUND_COLOUR_DEFAULT);
+      markScreenRows(row * UI_CELL_HEIGHT, (row + 1) * UI_CELL_HEIGHT);
+      cell.c = 0;
+    }
+  }
+
+  frameStats.frameUs = micros() - start;
+#ifdef UI_DEBUG_LOG
+  Serial.printf("Rendered menu in %luus, %u/%u cells drawn\n", frameStats.frameUs, frameStats.cellsDrawn, frameStats.cellsTotal);
+#endif
+}
+
+/// @brief Send the band of canvas rows drawn since the last push to the LCD. From internal RAM this is started
+/// as a DMA transfer, so the canvas must not be drawn into again before M5.Lcd.waitDMA()
+static void pushCanvas(void)
+{
+  if (lcd != &screenCanvas || dirtyTop >= dirtyBottom)
+    return;
+
+  // The canvas holds pixels in the LCD's byte order, so the rows go out as they are
+  uint32_t start = micros();
+  const int width = screenCanvas.width();
+  const lgfx::swap565_t *rows = (const lgfx::swap565_t *)screenCanvas.getBuffer() + dirtyTop * width;
+  M5.Lcd.startWrite();
+  if (canvasDma)
+    M5.Lcd.pushImageDMA(0, dirtyTop, width, dirtyBottom - dirtyTop, rows);
+  else
+    M5.Lcd.pushImage(0, dirtyTop, width, dirtyBottom - dirtyTop, rows);
+  M5.Lcd.endWrite();
+  frameStats.pushUs = micros() - start;
+
+  dirtyTop = lcd->height();
+  dirtyBottom = 0;
+}
+
+/// @brief Queue \a draw to run on the screen update task after everything queued before it
+/// @param page Page the drawing belongs to, or -1. It is dropped if that page has been left by the time it runs
+/// @param wait Block until it has been drawn and pushed to the LCD. Ignored on the screen update task itself
+/// @return false if the queue stayed full
+bool uiPost(void (*draw)(void *), void *arg, ssize_t page, bool wait)
+{
+  if (!drawQueue)
+    return false;
+
+  // Drawing posted from the screen update task, e.g. by a page callback, runs once the current batch is done
+  bool onScreenTask = (xTaskGetCurrentTaskHandle() == fob.tasks.screenUpdate);
+  wait &= !onScreenTask;
+
+  StaticSemaphore_t doneBuffer;
+  UiDrawCommand cmd = {draw, arg, page, wait ? xSemaphoreCreateBinaryStatic(&doneBuffer) : NULL};
+  if (xQueueSend(drawQueue, &cmd, onScreenTask ? 0 : pdMS_TO_TICKS(UI_DRAW_POST_TIMEOUT_MS)) != pdTRUE)
+  {
+#ifdef UI_DEBUG_LOG
+    Serial.printf("Draw queue full, dropped command %p\n", draw);
+#endif
+    if (cmd.done)
+      vSemaphoreDelete(cmd.done);
+    return false;
+  }
+
+  if (cmd.done)
+  {
+    xSemaphoreTake(cmd.done, portMAX_DELAY);
+    vSemaphoreDelete(cmd.done);
+  }
+  return true;
+}
+
+/// @brief Queue a render of the current menu page
+/// @param wait Block until it is on the LCD
+void uiRequestRender(bool wait)
+{
+  uiPost(NULL, NULL, -1, wait);
+}
+
+/// @brief Set up the canvas pages draw into, falling back to drawing on the LCD directly if there isn't room for it
+static void screenCanvasInit(void)
+{
+  // A canvas in internal RAM can be sent to the LCD by DMA straight from its buffer
+  screenCanvas.setColorDepth(16);
+  screenCanvas.setPsram(false);
+  canvasDma = screenCanvas.createSprite(M5.Lcd.width(), M5.Lcd.height());
+  if (!canvasDma)
+  {
+    screenCanvas.setPsram(true);
+    screenCanvas.createSprite(M5.Lcd.width(), M5.Lcd.height());
+  }
+
+  drawQueue = xQueueCreate(UI_DRAW_QUEUE_LENGTH, sizeof(UiDrawCommand));
+
+  if (screenCanvas.getBuffer())
+    lcd = &screenCanvas;
+  else
+  {
+    Serial.println("No memory for the screen canvas, drawing on the LCD directly");
+    lcd = &M5.Lcd;
+  }
+
+  lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+  lcd->setTextSize(TEXT_SIZE_DEFAULT);
+  lcd->setTextWrap(false, false);
+}
+
+/// @brief Owns the display: runs queued draw commands in order and pushes the canvas to the LCD after each batch
+void screenUpdateTask(void *arg)
+{
+  UiDrawCommand cmd;
+  SemaphoreHandle_t waiters[UI_DRAW_QUEUE_LENGTH];
+  while (1)
+  {
+    xQueueReceive(drawQueue, &cmd, portMAX_DELAY);
+    M5.Lcd.waitDMA();
+
+    // Everything queued by now goes out in one frame
+    size_t waiterCount = 0;
+    bool lastWasRender = false;
+    do
+    {
+      if (!cmd.draw)
+      {
+        // Back-to-back render requests draw the same thing
+        if (!lastWasRender)
+          renderMenu();
+        lastWasRender = true;
+      }
+      else if (cmd.page < 0 || cmd.page == fob.menu.currentPageId())
+      {
+        lcd->setCursor(contentX, contentY);
+        markScreenRows(contentY, lcd->height());
+        lcd->setTextSize(TEXT_SIZE_DEFAULT);
+        lcd->setTextColor(MINU_FOREGROUND_COLOUR_DEFAULT, MINU_BACKGROUND_COLOUR_DEFAULT);
+        cmd.draw(cmd.arg);
+        lastWasRender = false;
+      }
+
+      if (cmd.done)
+        waiters[waiterCount++] = cmd.done;
+    } while (waiterCount < UI_DRAW_QUEUE_LENGTH && xQueueReceive(drawQueue, &cmd, 0) == pdTRUE);
+
+    pushCanvas();
+    for (size_t i = 0; i < waiterCount; ++i)
+      xSemaphoreGive(waiters[i]);
+  }
+  vTaskDelete(NULL);
+}
+
+/// @brief Wakes the connection task on the Wi-Fi STA events it reacts to. Runs on the Wi-Fi event task
+static void onWiFiEvent(arduino_event_id_t event)
+{
+  if (!fob.tasks.connection)
+    return;
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP)
+  {
+    // Names may resolve differently on the network just joined
+    fob.dns.clear();
+    xTaskNotify(fob.tasks.connection, UI_CONNECTION_WIFI_UP, eSetBits);
+  }
+  else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED || event == ARDUINO_EVENT_WIFI_STA_LOST_IP)
+    xTaskNotify(fob.tasks.connection, UI_CONNECTION_WIFI_DOWN, eSetBits);
+}
+
+/// @brief Starts the Wi-Fi reconnect countdown when Wi-Fi drops in STA mode, and the router connect countdown
+/// when the router stops answering, pinging it with exponential backoff until it does.
+/// Sleeps between Wi-Fi events, only waking up otherwise for the next router check or a periodic look at the connection
+void connectionTask(void *arg)
+{
+  UiConnectionState state = UI_CONNECTION_STATE_IDLE;
+  bool started = false;
+  uint32_t backoffMs = ROUTER_CHECK_BACKOFF_MIN_MS;
+  uint32_t nextCheck = 0;
+  TickType_t timeout = portMAX_DELAY;
+  uint32_t events;
+
+  for (;;)
+  {
+    if (xTaskNotifyWait(0, ULONG_MAX, &events, timeout) != pdTRUE)
+      events = 0;
+
+    // Nothing is handled until the boot sequence has brought Wi-Fi up
+    started |= events & UI_CONNECTION_START;
+    if (!started)
+      continue;
+
+    bool sta = (WiFi.getMode() == WIFI_MODE_STA);
+    bool wifiUp = sta && WiFi.status() == WL_CONNECTED;
+    timeout = pdMS_TO_TICKS(CONNECTION_SUPERVISE_MS);
+
+    if (sta && !wifiUp)
+    {
+      if (state == UI_CONNECTION_STATE_ONLINE || state == UI_CONNECTION_STATE_ROUTER_WAIT)
+        logEvent(EVENT_LOG_WIFI_DOWN);
+      // Another countdown may be showing, in which case the Wi-Fi countdown starts once it is done
+      if (!fob.tasks.countdown && !fob.wifi.timedOut)
+      {
+        lastVisitedPageId = fob.menu.currentPageId();
+        startWiFiConnectCountdown(NULL);
+      }
+      state = UI_CONNECTION_STATE_WIFI_WAIT;
+    }
+    else if (wifiUp && !fob.booting && !fob.routers.router.available())
+    {
+      uint32_t now = millis();
+      if (state != UI_CONNECTION_STATE_ROUTER_WAIT)
+      {
+#ifdef UI_DEBUG_LOG
+        Serial.println("Router unreachable, checking with backoff");
+#endif
+        state = UI_CONNECTION_STATE_ROUTER_WAIT;
+        backoffMs = ROUTER_CHECK_BACKOFF_MIN_MS;
+        nextCheck = now;
+        if (!fob.tasks.countdown)
+        {
+          lastVisitedPageId = fob.menu.currentPageId();
+          startRouterConnectCountdown(NULL);
+        }
+      }
+
+      // Wi-Fi events can wake the task before the next check is due
+      if ((int32_t)(millis() - nextCheck) >= 0)
+      {
+        if (!fob.routers.router.checkAvailable())
+        {
+          nextCheck = millis() + backoffMs;
+#ifdef UI_DEBUG_LOG
+          Serial.printf("Router ping failed, next check in %lums\n", backoffMs);
+#endif
+          backoffMs = min(backoffMs * 2, (uint32_t)ROUTER_CHECK_BACKOFF_MAX_MS);
+        }
+      }
+      if (!fob.routers.router.available())
+        timeout = pdMS_TO_TICKS(max((int32_t)(nextCheck - millis()), (int32_t)0));
+      else
+        state = UI_CONNECTION_STATE_ONLINE;
+    }
+    else
+      state = wifiUp ? UI_CONNECTION_STATE_ONLINE : UI_CONNECTION_STATE_IDLE;
+
+    // Router credentials from a login or token grant are written to NVS once they have settled
+    uint32_t flushMs = flushStoredCredentials();
+    if (flushMs)
+      timeout = min(timeout, pdMS_TO_TICKS(flushMs));
+  }
 }
\ No newline at end of file
@@ -1,333 +1,617 @@
-/**
- * @file  utils.h
- * @brief Contains common user definitions and convenience fucntions
- */
-
-#include "stdint.h"
-#include "M5StickCPlus2.h"
-#include <Preferences.h>
-#include "config.h"
-#include "utils.h"
-
-void resetPreferences()
-{
-    fob.wifi.ssidStaPrimary = WIFI1_SSID_DEFAULT;
-    fob.wifi.passwordStaPrimary = WIFI1_PASSWORD_DEFAULT;
-    fob.wifi.ssidStaSecondary = WIFI2_SSID_DEFAULT;
-    fob.wifi.passwordStaSecondary = WIFI2_PASSWORD_DEFAULT;
-    fob.wifi.ssidSoftAp = WIFI_SSID_SOFTAP_DEFAULT;
-    fob.wifi.passwordSoftAp = WIFI_PASSWORD_SOFTAP_DEFAULT;
-    fob.routers.ip = ROUTER_IP_DEFAULT;
-    fob.routers.port = ROUTER_PORT_DEFAULT;
-    fob.routers.username = ROUTER_USERNAME_DEFAULT;
-    fob.routers.password = ROUTER_PASSWORD_DEFAULT;
-    fob.routers.clientName = CLIENT_NAME_DEFAULT;
-    fob.routers.clientScope = CLIENT_SCOPE_DEFAULT;
-    fob.wifi.timeoutMs = WIFI_TIMEOUT_DEFAULT;
-}
-
-bool savePreferences()
-{
-    bool ret = false;
-    PeplinkAPI_Settings_t newSettings =
-        {
-            .port = fob.routers.port,
-            .clientScope = fob.routers.clientScope,
-            .wifiTimeoutMs = fob.wifi.timeoutMs,
-        };
-    strncpy(newSettings.ssidStaPrimary, fob.wifi.ssidStaPrimary.c_str(), sizeof(newSettings.ssidStaPrimary));
-    strncpy(newSettings.passwordStaPrimary, fob.wifi.passwordStaPrimary.c_str(), sizeof(newSettings.passwordStaPrimary));
-    strncpy(newSettings.ssidStaSecondary, fob.wifi.ssidStaSecondary.c_str(), sizeof(newSettings.ssidStaSecondary));
-    strncpy(newSettings.passwordStaSecondary, fob.wifi.passwordStaSecondary.c_str(), sizeof(newSettings.passwordStaSecondary));
-    strncpy(newSettings.ssidSoftAp, fob.wifi.ssidSoftAp.c_str(), sizeof(newSettings.ssidSoftAp));
-    strncpy(newSettings.passwordSoftAp, fob.wifi.passwordSoftAp.c_str(), sizeof(newSettings.passwordSoftAp));
-    strncpy(newSettings.ip, fob.routers.ip.c_str(), sizeof(newSettings.ip));
-    strncpy(newSettings.username, fob.routers.username.c_str(), sizeof(newSettings.username));
-    strncpy(newSettings.password, fob.routers.password.c_str(), sizeof(newSettings.password));
-    strncpy(newSettings.clientName, fob.routers.clientName.c_str(), sizeof(newSettings.clientName));
-
-    Preferences newPrefs;
-    if (newPrefs.begin(PREFERENCES_NAMESPACE, false))
-    {
-        newPrefs.clear();
-        ret = newPrefs.putBytes(PREFERENCES_NAMESPACE, &newSettings, sizeof(newSettings));
-        if(ret)
-            Serial.println("Saved preferences to storage");
-    }
-
-    newPrefs.end();
-    return ret;
-}
-
-void dumpPreferences()
-{
-    Serial.println("Router SSID1 : " + fob.wifi.ssidStaPrimary);
-    Serial.println("Router Password1 :" + fob.wifi.passwordStaPrimary);
-    Serial.println("Router SSID2 : " + fob.wifi.ssidStaSecondary);
-    Serial.println("Router Password2 :" + fob.wifi.passwordStaSecondary);
-    Serial.println("Soft AP SSID : " + fob.wifi.ssidSoftAp);
-    Serial.println("Soft AP Password :" + fob.wifi.passwordSoftAp);
-    Serial.println("Router IP : " + fob.routers.ip);
-    Serial.println("Router Port : " + String(fob.routers.port));
-    Serial.println("Router API Username : " + fob.routers.username);
-    Serial.println("Router API Password : " + fob.routers.password);
-    Serial.println("Router Client Name : " + fob.routers.clientName);
-    Serial.print("Router Client Scope : ");
-    if (fob.routers.clientScope == CLIENT_SCOPE_READ_WRITE)
-        Serial.println("read-write");
-    else
-        Serial.println("read-only");
-    Serial.println("Wi-Fi connect timeout : " + String(fob.wifi.timeoutMs));
-}
-
-void retrieveStoredCredentials()
-{
-    Preferences cookiePrefs;
-    if (cookiePrefs.begin(COOKIES_NAMESPACE))
-    {
-        size_t cookieJarSize = cookiePrefs.getBytesLength(COOKIES_NAMESPACE);
-
-        if (cookieJarSize == sizeof(PeplinkAPI_CookieJar_t)) // If the stored data is of the right size, extract it
-        {
-            uint8_t cookieBuffer[sizeof(PeplinkAPI_CookieJar_t)];
-            cookiePrefs.getBytes(COOKIES_NAMESPACE, cookieBuffer, sizeof(cookieBuffer));
-        
-            PeplinkAPI_CookieJar_t *jar = (PeplinkAPI_CookieJar_t *)cookieBuffer;
-            if (jar->magic == 0xDEADBEEF) // If the cookie jar is valid, extract the cookie
-            {
-                fob.routers.router.setCookie(String(jar->cookie));
-                Serial.print("Got cookie from storage: ");
-                Serial.println(jar->cookie);
-                fob.routers.router.setToken(String(jar->token));
-                Serial.print("Got token from storage: ");
-                Serial.println(jar->token);
-            }
-        }
-        cookiePrefs.end();
-    }
-}
-
-void restorePreferences()
-{
-    resetPreferences();
-    Preferences routerPrefs;
-
-    if (routerPrefs.begin(PREFERENCES_NAMESPACE))
-    {
-        size_t settingsSize = routerPrefs.getBytesLength(PREFERENCES_NAMESPACE);
-
-        uint8_t settingsBuffer[settingsSize];
-        routerPrefs.getBytes(PREFERENCES_NAMESPACE, settingsBuffer, sizeof(settingsBuffer));
-        routerPrefs.end();
-        if (settingsSize % sizeof(PeplinkAPI_Settings_t) == 0)
-        {
-            PeplinkAPI_Settings_t *settings = (PeplinkAPI_Settings_t *)settingsBuffer;
-            if (String(settings->ssidStaPrimary).length() && String(settings->ssidStaSecondary).length() &&
-            String(settings->ssidSoftAp).length() && String(settings->ip).length() &&
-            String(settings->port).length() && String(settings->username).length() &&
-            String(settings->password).length() && String(settings->clientName).length()
-            )
-            {
-                fob.wifi.ssidStaPrimary = settings->ssidStaPrimary;
-                fob.wifi.passwordStaPrimary = settings->passwordStaPrimary;
-                fob.wifi.ssidStaSecondary = settings->ssidStaSecondary;
-                fob.wifi.passwordStaSecondary = settings->passwordStaSecondary;
-                fob.wifi.ssidSoftAp = settings->ssidSoftAp;
-                fob.wifi.passwordSoftAp = settings->passwordSoftAp;
-                fob.routers.ip = settings->ip;
-                fob.routers.port = settings->port;
-                fob.routers.username = settings->username;
-                fob.routers.password = settings->password;
-                fob.routers.clientName = settings->clientName;
-                fob.routers.clientScope = settings->clientScope;
-                fob.wifi.timeoutMs = settings->wifiTimeoutMs;
-                Serial.println("Got preferences from storage");
-                dumpPreferences();
-            }
-            else
-            {
-                resetPreferences();
-                savePreferences();
-            }
-        }
-        else
-            savePreferences();
-    }
-    else
-        savePreferences();
-}
-
-void retrieveLastShutdownInfo()
-{
-    Preferences timePrefs;
-    if (timePrefs.begin(TIMESTAMP_NAMESPACE))
-    {
-        size_t timestampSize = timePrefs.getBytesLength(TIMESTAMP_NAMESPACE);
-
-        if (timestampSize && (timestampSize == sizeof(ShutdownTimestamp_t)))
-        {
-            uint8_t timestampBuffer[sizeof(ShutdownTimestamp_t)];
-            timePrefs.getBytes(TIMESTAMP_NAMESPACE, timestampBuffer,  sizeof(ShutdownTimestamp_t));
-            timePrefs.end();
-            ShutdownTimestamp_t *timestamp = (ShutdownTimestamp_t*)timestampBuffer;
-            fob.timestamps.lastShutdownRuntime = timestamp->lastShutdownRuntime;
-            fob.timestamps.lastShutdownTime = timestamp->lastShutdownTime;
-            fob.timestamps.lastShutdownTimezone = timestamp->lastShutdownTimezone;
-            Serial.println("Got shutdown details:");
-            Serial.printf("\tRuntime: %"PRId64"\n", timestamp->lastShutdownRuntime);
-            Serial.printf("\tTime: %s\n", timestamp->lastShutdownTime);
-            Serial.printf("\tTimezone: %s\n",  timestamp->lastShutdownTimezone);
-        }
-    }
-    timePrefs.end();
-}
-void retrieveLastAlertInfo()
-{
-    Preferences alertPrefs;
-    if (alertPrefs.begin(TEMPERATURE_ALERT_NAMESPACE))
-    {
-        size_t timestampSize = alertPrefs.getBytesLength(TEMPERATURE_ALERT_NAMESPACE);
-
-        if (timestampSize && (timestampSize == sizeof(AlertTimestamp_t)))
-        {
-            uint8_t timestampBuffer[sizeof(AlertTimestamp_t)];
-            alertPrefs.getBytes(TEMPERATURE_ALERT_NAMESPACE, timestampBuffer,  sizeof(AlertTimestamp_t));
-            alertPrefs.end();
-            AlertTimestamp_t *timestamp = (AlertTimestamp_t*)timestampBuffer;
-            fob.timestamps.lastTempAlertTime = timestamp->lastTempAlertTime;
-            fob.timestamps.lastTempAlertTemp = timestamp->lastTempAlertTemp;
-            fob.timestamps.lastTempAlertThresh = timestamp->lastTempAlertThresh;
-            Serial.println("Got last temp alert details:");
-            Serial.printf("\tTime: %s\n", timestamp->lastTempAlertTime);
-            Serial.printf("\tTemp: %fF\n",  timestamp->lastTempAlertTemp);
-            Serial.printf("\tThresh: %fF\n",  timestamp->lastTempAlertThresh);
-        }
-    }
-    alertPrefs.end();
-}
-
-void setTimezone(const char* tzone)
-{
-  Serial.printf("Setting Timezone to %s\n",tzone);
-  setenv("TZ",tzone,1);
-  tzset();
-}
-
-bool syncNtpToRtc(const char* tzone)
-{
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo))
-  {
-    Serial.println("Failed to obtain NTP time");
-    return false;
-  }
-  setTimezone(tzone);
-  time_t syncT = time(nullptr) + 1;   // Advance one second
-  while (syncT > time(nullptr));      // and wait for the actual time to catch up
-  M5.Rtc.setDateTime(gmtime(&syncT)); // Set the new date and time to RTC
-  Serial.println(&timeinfo, "Local time: %I:%M:%S%p %A, %B-%d-%Y ");
-  return true;
-}
-
-void printRouterInfo(PeplinkRouter &router)
-{
-    PeplinkRouterInfo rInfo = router.info();
-    Serial.println("Router Info:");
-    Serial.println("\tName : " + rInfo.name);
-    Serial.println("\tUptime : " + String(rInfo.uptime));
-    Serial.println("\tSerial : " + rInfo.serial);
-    Serial.println("\tFwVersion : " + rInfo.fwVersion);
-    Serial.println("\tProduct Code : " + rInfo.productCode);
-    Serial.println("\tHardware Rev : " + rInfo.hardwareRev);
-}
-
-void printRouterLocation(PeplinkRouter &router)
-{
-    PeplinkRouterLocation location = router.location();
-    Serial.println("Router Location:-");
-    Serial.println("\tLongitude : " + location.longitude);
-    Serial.println("\tLatitude : " + location.latitude);
-    Serial.println("\tAltitude : " + location.altitude);
-}
-
-void printRouterClients(PeplinkRouter &router)
-{
-    std::vector<PeplinkAPI_ClientInfo> clientList = router.clients();
-    Serial.printf("%d clients: \n", clientList.size());
-    for (PeplinkAPI_ClientInfo routerClient : clientList)
-    {
-        Serial.print("\tname : " + routerClient.name);
-        Serial.print("\tid: " + routerClient.id);
-        Serial.print("\tsecret: " + routerClient.secret);
-        Serial.print("\tscope: ");
-        Serial.print((routerClient.scope == CLIENT_SCOPE_READ_ONLY) ? String("api.read-only") : String("api"));
-        Serial.println("\ttoken: " + routerClient.token);
-    }
-}
-
-void printRouterWanStatus(PeplinkRouter &router)
-{
-    Serial.print("Getting WAN list - ");
-
-    std::vector<PeplinkAPI_WAN *> wanList = router.wanStatus();
-    Serial.println(String(wanList.size()) + " elements:");
-    for (PeplinkAPI_WAN *wan : wanList)
-    {
-        Serial.print("\tname : " + wan->name);
-        Serial.print("\tstatus : " + wan->status);
-        Serial.print("\tstatusLed : " + wan->statusLED);
-        switch (wan->type)
-        {
-        case PEPLINKAPI_WAN_TYPE_ETHERNET:
-            Serial.print("\ttype : ethernet");
-            if (wan->status != "Disabled")
-                Serial.print("\tip : " + wan->ip);
-            break;
-        case PEPLINKAPI_WAN_TYPE_CELLULAR:
-        {
-            Serial.print("\ttype : cellular");
-            if (wan->status != "Disabled")
-            {
-                Serial.print("\tip : " + wan->ip);
-                Serial.print("\tcarrier: " + ((PeplinkAPI_WAN_Cellular *)wan)->carrier);
-                Serial.printf("\trssi: %d\n" + ((PeplinkAPI_WAN_Cellular *)wan)->rssi);
-                if (((PeplinkAPI_WAN_Cellular *)wan)->carrier != "")
-                {
-                    Serial.print("" + ((PeplinkAPI_WAN_Cellular *)wan)->carrier + " " + ((PeplinkAPI_WAN_Cellular *)wan)->networkType + " Bars:" + ((PeplinkAPI_WAN_Cellular *)wan)->signalLevel + "\n");
-                }
-                printSimCards(((PeplinkAPI_WAN_Cellular *)wan)->simCards);
-            }
-        }
-        break;
-        case PEPLINKAPI_WAN_TYPE_WIFI:
-        {
-            Serial.print("\ttype : wifi");
-            if (wan->status != "Disabled")
-            {
-                Serial.print("\tip : " + wan->ip);
-                Serial.print("\tstrength: " + ((PeplinkAPI_WAN_WiFi *)wan)->strength);
-                Serial.print("\tssid: " + ((PeplinkAPI_WAN_WiFi *)wan)->ssid);
-                Serial.print("\tbssid: " + ((PeplinkAPI_WAN_WiFi *)wan)->bssid);
-            }
-        }
-        break;
-        }
-        Serial.println();
-    }
-}
-
-void printSimCards(std::vector<PeplinkAPI_WAN_Cellular_SIM> &simList)
-{
-    Serial.println("\t\tSIM Cards: ");
-    for (auto it = 0; it < simList.size(); ++it)
-    {
-        Serial.printf("\t\tSIM %d: ", it);
-        Serial.print((simList[it].detected) ? "detected" : "not detected");
-        if (simList[it].detected)
-        {
-            Serial.print((simList[it].active) ? ", active" : ", inactive");
-            Serial.print(", iccid - " + simList[it].iccid);
-        }
-        Serial.println();
-    }
+/**
+ * @file  utils.h
+ * @brief Contains common user definitions and convenience fucntions
+ */
+
+#include "stdint.h"
+#include "M5StickCPlus2.h"
+#include <Preferences.h>
+#include "esp_freertos_hooks.h"
+#include "config.h"
+#include "utils.h"
+
+void resetPreferences()
+{
+    fob.wifi.ssidStaPrimary = WIFI1_SSID_DEFAULT;
+    fob.wifi.passwordStaPrimary = WIFI1_PASSWORD_DEFAULT;
+    fob.wifi.ssidStaSecondary = WIFI2_SSID_DEFAULT;
+    fob.wifi.passwordStaSecondary = WIFI2_PASSWORD_DEFAULT;
+    fob.wifi.ssidSoftAp = WIFI_SSID_SOFTAP_DEFAULT;
+    fob.wifi.passwordSoftAp = WIFI_PASSWORD_SOFTAP_DEFAULT;
+    fob.routers.ip = ROUTER_IP_DEFAULT;
+    fob.routers.port = ROUTER_PORT_DEFAULT;
+    fob.routers.username = ROUTER_USERNAME_DEFAULT;
+    fob.routers.password = ROUTER_PASSWORD_DEFAULT;
+    fob.routers.clientName = CLIENT_NAME_DEFAULT;
+    fob.routers.clientScope = CLIENT_SCOPE_DEFAULT;
+    fob.wifi.timeoutMs = WIFI_TIMEOUT_DEFAULT;
+}
+
+bool savePreferences()
+{
+    bool ret = false;
+    PeplinkAPI_Settings_t newSettings =
+        {
+            .port = fob.routers.port,
+            .clientScope = fob.routers.clientScope,
+            .wifiTimeoutMs = fob.wifi.timeoutMs,
+        };
+    strncpy(newSettings.ssidStaPrimary, fob.wifi.ssidStaPrimary.c_str(), sizeof(newSettings.ssidStaPrimary));
+    strncpy(newSettings.passwordStaPrimary, fob.wifi.passwordStaPrimary.c_str(), sizeof(newSettings.passwordStaPrimary));
+    strncpy(newSettings.ssidStaSecondary, fob.wifi.ssidStaSecondary.c_str(), sizeof(newSettings.ssidStaSecondary));
+    strncpy(newSettings.passwordStaSecondary, fob.wifi.passwordStaSecondary.c_str(), sizeof(newSettings.passwordStaSecondary));
+    strncpy(newSettings.ssidSoftAp, fob.wifi.ssidSoftAp.c_str(), sizeof(newSettings.ssidSoftAp));
+    strncpy(newSettings.passwordSoftAp, fob.wifi.passwordSoftAp.c_str(), sizeof(newSettings.passwordSoftAp));
+    strncpy(newSettings.ip, fob.routers.ip.c_str(), sizeof(newSettings.ip));
+    strncpy(newSettings.username, fob.routers.username.c_str(), sizeof(newSettings.username));
+    strncpy(newSettings.password, fob.routers.password.c_str(), sizeof(newSettings.password));
+    strncpy(newSettings.clientName, fob.routers.clientName.c_str(), sizeof(newSettings.clientName));
+
+    Preferences newPrefs;
+    if (newPrefs.begin(PREFERENCES_NAMESPACE, false))
+    {
+        newPrefs.clear();
+        ret = newPrefs.putBytes(PREFERENCES_NAMESPACE, &newSettings, sizeof(newSettings));
+        if(ret)
+            Serial.println("Saved preferences to storage");
+    }
+
+    newPrefs.end();
+    return ret;
+}
+
+void dumpPreferences()
+{
+    Serial.println("Router SSID1 : " + fob.wifi.ssidStaPrimary);
+    Serial.println("Router Password1 :" + fob.wifi.passwordStaPrimary);
+    Serial.println("Router SSID2 : " + fob.wifi.ssidStaSecondary);
+    Serial.println("Router Password2 :" + fob.wifi.passwordStaSecondary);
+    Serial.println("Soft AP SSID : " + fob.wifi.ssidSoftAp);
+    Serial.println("Soft AP Password :" + fob.wifi.passwordSoftAp);
+    Serial.println("Router IP : " + fob.routers.ip);
+    Serial.println("Router Port : " + String(fob.routers.port));
+    Serial.println("Router API Username : " + fob.routers.username);
+    Serial.println("Router API Password : " + fob.routers.password);
+    Serial.println("Router Client Name : " + fob.routers.clientName);
+    Serial.print("Router Client Scope : ");
+    if (fob.routers.clientScope == CLIENT_SCOPE_READ_WRITE)
+        Serial.println("read-write");
+    else
+        Serial.println("read-only");
+    Serial.println("Wi-Fi connect timeout : " + String(fob.wifi.timeoutMs));
+}
+
+/// @brief Return the number of days from 1970-01-01 to a date of the proleptic Gregorian calendar
+static int32_t daysFromCivil(int32_t year, uint32_t month, uint32_t day)
+{
+    year -= month <= 2;
+    const int32_t era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t yearOfEra = year - era * 400;
+    const uint32_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int32_t)dayOfEra - 719468;
+}
+
+/// @brief Return the RTC's wall clock in seconds since 1970, or 0 if the RTC was never set
+static uint32_t rtcEpochSeconds()
+{
+    // Years before the RTC was ever set mean no time is known
+    auto dt = M5.Rtc.getDateTime();
+    if (dt.date.year < 2020)
+        return 0;
+    return daysFromCivil(dt.date.year, dt.date.month, dt.date.date) * 86400UL +
+           dt.time.hours * 3600UL + dt.time.minutes * 60UL + dt.time.seconds;
+}
+
+static PeplinkAPI_CookieJar_t credentialJar;
+static SemaphoreHandle_t credentialLock;
+static bool credentialDirty;
+static uint32_t credentialFirstChange;  // millis() of the oldest change not yet written to NVS
+static uint32_t credentialLastChange;   // millis() of the newest change not yet written to NVS
+
+void retrieveStoredCredentials()
+{
+    credentialLock = xSemaphoreCreateMutex();
+    memset(&credentialJar, 0, sizeof(credentialJar));
+    credentialJar.magic = 0xDEADBEEF;
+
+    Preferences cookiePrefs;
+    if (cookiePrefs.begin(COOKIES_NAMESPACE))
+    {
+        size_t cookieJarSize = cookiePrefs.getBytesLength(COOKIES_NAMESPACE);
+
+        if (cookieJarSize == sizeof(PeplinkAPI_CookieJar_t)) // If the stored data is of the right size, extract it
+        {
+            uint8_t cookieBuffer[sizeof(PeplinkAPI_CookieJar_t)];
+            cookiePrefs.getBytes(COOKIES_NAMESPACE, cookieBuffer, sizeof(cookieBuffer));
+        
+            PeplinkAPI_CookieJar_t *jar = (PeplinkAPI_CookieJar_t *)cookieBuffer;
+            if (jar->magic == 0xDEADBEEF) // If the cookie jar is valid, extract the cookie
+            {
+                memcpy(&credentialJar, jar, sizeof(credentialJar));
+                credentialJar.cookie[sizeof(credentialJar.cookie) - 1] = '\0';
+                credentialJar.token[sizeof(credentialJar.token) - 1] = '\0';
+                credentialJar.clientId[sizeof(credentialJar.clientId) - 1] = '\0';
+                credentialJar.clientSecret[sizeof(credentialJar.clientSecret) - 1] = '\0';
+                fob.routers.router.setCookie(String(credentialJar.cookie));
+                Serial.print("Got cookie from storage: ");
+                Serial.println(credentialJar.cookie);
+                fob.routers.router.setToken(String(credentialJar.token));
+                Serial.print("Got token from storage: ");
+                Serial.println(credentialJar.token);
+
+                // A token whose expiry is unknown, e.g. because the RTC isn't set, is renewed as soon as the router is polled
+                uint32_t now = rtcEpochSeconds();
+                uint32_t secondsLeft = (now && credentialJar.tokenExpiry > now) ? credentialJar.tokenExpiry - now : 0;
+                if (credentialJar.token[0])
+                {
+                    fob.routers.router.setTokenExpiry(secondsLeft);
+                    Serial.printf("Token expires in %lus\n", secondsLeft);
+                }
+                fob.routers.router.setClient(String(credentialJar.clientId), String(credentialJar.clientSecret));
+                Serial.print("Got client ID from storage: ");
+                Serial.println(credentialJar.clientId);
+            }
+        }
+        cookiePrefs.end();
+    }
+}
+
+/// @brief Copy \a value into a field of the in-RAM cookie jar. Must be called with the jar held
+/// @return true if the field changed
+static bool copyCredential(char *field, size_t size, const String &value)
+{
+    if (!strncmp(field, value.c_str(), size - 1))
+        return false;
+    strncpy(field, value.c_str(), size - 1);
+    field[size - 1] = '\0';
+    return true;
+}
+
+/// @brief Mark the in-RAM cookie jar for writing to NVS. Must be called with the jar held
+static void markCredentialsChanged()
+{
+    credentialLastChange = millis();
+    if (!credentialDirty)
+        credentialFirstChange = credentialLastChange;
+    credentialDirty = true;
+}
+
+void storeRouterCookie(const String &cookie)
+{
+    if (!credentialLock)
+        return;
+
+    xSemaphoreTake(credentialLock, portMAX_DELAY);
+    if (copyCredential(credentialJar.cookie, sizeof(credentialJar.cookie), cookie))
+        markCredentialsChanged();
+    xSemaphoreGive(credentialLock);
+}
+
+void storeRouterToken(const String &token, uint32_t validForS)
+{
+    if (!credentialLock)
+        return;
+
+    // The expiry is kept as wall-clock time, since millis() starts again on every boot
+    uint32_t now = rtcEpochSeconds();
+    uint32_t expiry = (now && validForS) ? now + validForS : 0;
+
+    xSemaphoreTake(credentialLock, portMAX_DELAY);
+    bool changed = copyCredential(credentialJar.token, sizeof(credentialJar.token), token);
+    if (expiry != credentialJar.tokenExpiry)
+    {
+        credentialJar.tokenExpiry = expiry;
+        changed = true;
+    }
+    if (changed)
+        markCredentialsChanged();
+    xSemaphoreGive(credentialLock);
+}
+
+void storeRouterClient(const String &id, const String &secret)
+{
+    if (!credentialLock)
+        return;
+
+    xSemaphoreTake(credentialLock, portMAX_DELAY);
+    bool changed = copyCredential(credentialJar.clientId, sizeof(credentialJar.clientId), id);
+    changed |= copyCredential(credentialJar.clientSecret, sizeof(credentialJar.clientSecret), secret);
+    if (changed)
+        markCredentialsChanged();
+    xSemaphoreGive(credentialLock);
+}
+
+uint32_t flushStoredCredentials(bool force)
+{
+    if (!credentialLock)
+        return 0;
+
+    xSemaphoreTake(credentialLock, portMAX_DELAY);
+    if (!credentialDirty)
+    {
+        xSemaphoreGive(credentialLock);
+        return 0;
+    }
+
+    // Wait for the credentials to settle, but not for so long that a steady stream of changes never gets written
+    uint32_t now = millis();
+    uint32_t quiet = now - credentialLastChange;
+    uint32_t pending = now - credentialFirstChange;
+    if (!force && quiet < CREDENTIAL_FLUSH_DELAY_MS && pending < CREDENTIAL_FLUSH_MAX_DELAY_MS)
+    {
+        uint32_t due = min(CREDENTIAL_FLUSH_DELAY_MS - quiet, CREDENTIAL_FLUSH_MAX_DELAY_MS - pending);
+        xSemaphoreGive(credentialLock);
+        return due;
+    }
+
+    Preferences prefs;
+    if (prefs.begin(COOKIES_NAMESPACE, false))
+    {
+        // A jar of another size was written by an older firmware, so start the namespace afresh
+        if (prefs.getBytesLength(COOKIES_NAMESPACE) != sizeof(PeplinkAPI_CookieJar_t))
+            prefs.clear();
+        if (prefs.putBytes(COOKIES_NAMESPACE, &credentialJar, sizeof(credentialJar)) == sizeof(credentialJar))
+            credentialDirty = false;
+        prefs.end();
+    }
+    if (credentialDirty)
+    {
+        // Retry after the usual delay rather than on every call
+        Serial.println("Failed to write router credentials to NVS");
+        credentialFirstChange = credentialLastChange = now;
+    }
+    bool dirty = credentialDirty;
+    xSemaphoreGive(credentialLock);
+    return dirty ? CREDENTIAL_FLUSH_DELAY_MS : 0;
+}
+
+bool clearStoredCredentials()
+{
+    if (credentialLock)
+        xSemaphoreTake(credentialLock, portMAX_DELAY);
+    memset(&credentialJar, 0, sizeof(credentialJar));
+    credentialJar.magic = 0xDEADBEEF;
+    credentialDirty = false;
+
+    Preferences prefs;
+    bool ok = prefs.begin(COOKIES_NAMESPACE, false);
+    if (ok)
+    {
+        prefs.clear(); // Clear any currently stored cookies
+        prefs.end();
+    }
+    if (credentialLock)
+        xSemaphoreGive(credentialLock);
+    return ok;
+}
+
+void restorePreferences()
+{
+    resetPreferences();
+    Preferences routerPrefs;
+
+    if (routerPrefs.begin(PREFERENCES_NAMESPACE))
+    {
+        size_t settingsSize = routerPrefs.getBytesLength(PREFERENCES_NAMESPACE);
+
+        uint8_t settingsBuffer[settingsSize];
+        routerPrefs.getBytes(PREFERENCES_NAMESPACE, settingsBuffer, sizeof(settingsBuffer));
+        routerPrefs.end();
+        if (settingsSize % sizeof(PeplinkAPI_Settings_t) == 0)
+        {
+            PeplinkAPI_Settings_t *settings = (PeplinkAPI_Settings_t *)settingsBuffer;
+            if (String(settings->ssidStaPrimary).length() && String(settings->ssidStaSecondary).length() &&
+            String(settings->ssidSoftAp).length() && String(settings->ip).length() &&
+            String(settings->port).length() && String(settings->username).length() &&
+            String(settings->password).length() && String(settings->clientName).length()
+            )
+            {
+                fob.wifi.ssidStaPrimary = settings->ssidStaPrimary;
+                fob.wifi.passwordStaPrimary = settings->passwordStaPrimary;
+                fob.wifi.ssidStaSecondary = settings->ssidStaSecondary;
+                fob.wifi.passwordStaSecondary = settings->passwordStaSecondary;
+                fob.wifi.ssidSoftAp = settings->ssidSoftAp;
+                fob.wifi.passwordSoftAp = settings->passwordSoftAp;
+                fob.routers.ip = settings->ip;
+                fob.routers.port = settings->port;
+                fob.routers.username = settings->username;
+                fob.routers.password = settings->password;
+                fob.routers.clientName = settings->clientName;
+                fob.routers.clientScope = settings->clientScope;
+                fob.wifi.timeoutMs = settings->wifiTimeoutMs;
+                Serial.println("Got preferences from storage");
+                dumpPreferences();
+            }
+            else
+            {
+                resetPreferences();
+                savePreferences();
+            }
+        }
+        else
+            savePreferences();
+    }
+    else
+        savePreferences();
+}
+
+void retrieveLastShutdownInfo()
+{
+    EventLog_Record record;
+    if (!findLastEvent(EVENT_LOG_SHUTDOWN, record))
+        return;
+
+    char time[20];
+    formatEventTime(record.time, time, sizeof(time));
+    fob.timestamps.lastShutdownRuntime = (uint64_t)record.value * 1000;
+    fob.timestamps.lastShutdownTime = time;
+    fob.timestamps.lastShutdownTimezone = TIMEZONE;
+    Serial.println("Got shutdown details:");
+    Serial.printf("\tRuntime: %"PRId64"\n", fob.timestamps.lastShutdownRuntime);
+    Serial.printf("\tTime: %s\n", time);
+}
+
+void retrieveLastAlertInfo()
+{
+    EventLog_Record record;
+    if (!findLastEvent(EVENT_LOG_TEMP_ALERT, record))
+        return;
+
+    char time[20];
+    formatEventTime(record.time, time, sizeof(time));
+    fob.timestamps.lastTempAlertTime = time;
+    fob.timestamps.lastTempAlertTemp = record.value / 100.f;
+    fob.timestamps.lastTempAlertThresh = record.detail;
+    Serial.println("Got last temp alert details:");
+    Serial.printf("\tTime: %s\n", time);
+    Serial.printf("\tTemp: %fF\n", fob.timestamps.lastTempAlertTemp);
+    Serial.printf("\tThresh: %fF\n", fob.timestamps.lastTempAlertThresh);
+}
+
+static EventLog eventLog;
+static SemaphoreHandle_t eventLogLock;
+
+void eventLogInit()
+{
+    eventLogLock = xSemaphoreCreateMutex();
+    if (!eventLog.begin(EVENT_LOG_PATH))
+        Serial.println("Failed to open the event log");
+    else
+        Serial.printf("Event log holds events %u to %u\n", eventLog.firstSeq(), eventLog.lastSeq());
+}
+
+bool logEvent(EventLog_Type_t type, int32_t value, uint8_t subject, uint8_t detail)
+{
+    if (!eventLogLock)
+        return false;
+
+    // The RTC keeps the local wall clock, which is stored as is
+    uint32_t time = rtcEpochSeconds();
+
+    xSemaphoreTake(eventLogLock, portMAX_DELAY);
+    bool ok = eventLog.append(type, time, value, subject, detail);
+    xSemaphoreGive(eventLogLock);
+    return ok;
+}
+
+size_t readEvents(EventLog_Record *records, size_t maxRecords, uint32_t beforeSeq)
+{
+    if (!eventLogLock)
+        return 0;
+    xSemaphoreTake(eventLogLock, portMAX_DELAY);
+    size_t count = eventLog.read(records, maxRecords, beforeSeq);
+    xSemaphoreGive(eventLogLock);
+    return count;
+}
+
+bool findLastEvent(EventLog_Type_t type, EventLog_Record &record)
+{
+    if (!eventLogLock)
+        return false;
+    xSemaphoreTake(eventLogLock, portMAX_DELAY);
+    bool found = eventLog.findLast(type, record);
+    xSemaphoreGive(eventLogLock);
+    return found;
+}
+
+void formatEventTime(uint32_t time, char *buffer, size_t len)
+{
+    if (!time)
+    {
+        snprintf(buffer, len, "Unknown");
+        return;
+    }
+    time_t t = time;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    snprintf(buffer, len, "%02d/%02d/%04d %02d:%02dH", tm.tm_mday, tm.tm_mon + 1, tm.tm_year + 1900, tm.tm_hour, tm.tm_min);
+}
+
+void setTimezone(const char* tzone)
+{
+  Serial.printf("Setting Timezone to %s\n",tzone);
+  setenv("TZ",tzone,1);
+  tzset();
+}
+
+bool syncNtpToRtc(const char* tzone)
+{
+  struct tm timeinfo;
+  if (!getLocalTime(&timeinfo))
+  {
+    Serial.println("Failed to obtain NTP time");
+    return false;
+  }
+  setTimezone(tzone);
+  time_t syncT = time(nullptr) + 1;   // Advance one second
+  while (syncT > time(nullptr));      // and wait for the actual time to catch up
+  M5.Rtc.setDateTime(gmtime(&syncT)); // Set the new date and time to RTC
+  Serial.println(&timeinfo, "Local time: %I:%M:%S%p %A, %B-%d-%Y ");
+  return true;
+}
+
+/// @brief Number of ticks in which each core ran its idle task
+static volatile uint32_t idleTicks[portNUM_PROCESSORS];
+/// @brief Tick in which each core last ran its idle task
+static volatile TickType_t lastIdleTick[portNUM_PROCESSORS];
+
+/// @brief Idle hook counting each tick a core goes idle in only once, since it runs on every wake-up from idle
+static bool countIdleTick(int core)
+{
+  TickType_t now = xTaskGetTickCount();
+  if (lastIdleTick[core] != now)
+  {
+    lastIdleTick[core] = now;
+    ++idleTicks[core];
+  }
+  // Let the core sleep until the next interrupt
+  return true;
+}
+
+static bool countIdleTickCore0()
+{
+  return countIdleTick(0);
+}
+
+#if portNUM_PROCESSORS > 1
+static bool countIdleTickCore1()
+{
+  return countIdleTick(1);
+}
+#endif
+
+void cpuLoadInit()
+{
+  esp_register_freertos_idle_hook_for_cpu(countIdleTickCore0, 0);
+#if portNUM_PROCESSORS > 1
+  esp_register_freertos_idle_hook_for_cpu(countIdleTickCore1, 1);
+#endif
+}
+
+uint8_t cpuLoadPercent(int core)
+{
+  static uint32_t lastIdleTicks[portNUM_PROCESSORS];
+  static TickType_t lastSampleTick[portNUM_PROCESSORS];
+  static uint8_t lastLoad[portNUM_PROCESSORS];
+
+  if (core < 0 || core >= portNUM_PROCESSORS)
+    return 0;
+
+  TickType_t now = xTaskGetTickCount();
+  uint32_t idle = idleTicks[core];
+  TickType_t elapsed = now - lastSampleTick[core];
+  if (!elapsed)
+    return lastLoad[core];
+
+  uint32_t idleElapsed = min(idle - lastIdleTicks[core], (uint32_t)elapsed);
+  lastLoad[core] = 100 - (idleElapsed * 100) / elapsed;
+  lastIdleTicks[core] = idle;
+  lastSampleTick[core] = now;
+  return lastLoad[core];
+}
+
+void printRouterInfo(PeplinkRouter &router)
+{
+    PeplinkRouterInfo rInfo = router.info();
+    Serial.println("Router Info:");
+    Serial.println("\tName : " + rInfo.name);
+    Serial.println("\tUptime : " + String(rInfo.uptime));
+    Serial.println("\tSerial : " + rInfo.serial);
+    Serial.println("\tFwVersion : " + rInfo.fwVersion);
+    Serial.println("\tProduct Code : " + rInfo.productCode);
+    Serial.println("\tHardware Rev : " + rInfo.hardwareRev);
+}
+
+void printRouterLocation(PeplinkRouter &router)
+{
+    PeplinkRouterLocation location = router.location();
+    Serial.println("Router Location:-");
+    Serial.println("\tLongitude : " + location.longitude);
+    Serial.println("\tLatitude : " + location.latitude);
+    Serial.println("\tAltitude : " + location.altitude);
+}
+
+void printRouterClients(PeplinkRouter &router)
+{
+    std::vector<PeplinkAPI_ClientInfo> clientList = router.clients();
+    Serial.printf("%d clients: \n", clientList.size());
+    for (PeplinkAPI_ClientInfo routerClient : clientList)
+    {
+        Serial.print("\tname : " + routerClient.name);
+        Serial.print("\tid: " + routerClient.id);
+        Serial.print("\tsecret: " + routerClient.secret);
+        Serial.print("\tscope: ");
+        Serial.print((routerClient.scope == CLIENT_SCOPE_READ_ONLY) ? String("api.read-only") : String("api"));
+        Serial.println("\ttoken: " + routerClient.token);
+    }
+}
+
+void printRouterWanStatus(PeplinkRouter &router)
+{
+    Serial.print("Getting WAN list - ");
+
+    router.lock();
+    const PeplinkAPI_WANTable &wanList = router.wanStatus();
+    Serial.println(String(wanList.size()) + " elements:");
+    for (const PeplinkAPI_WAN &wan : wanList)
+    {
+        Serial.printf("\tname : %s", wan.name);
+        Serial.printf("\tstatus : %s", wan.status);
+        Serial.printf("\tstatusLed : %s", wan.statusLED);
+        switch (wan.type)
+        {
+        case PEPLINKAPI_WAN_TYPE_ETHERNET:
+            Serial.print("\ttype : ethernet");
+            if (strcmp(wan.status, "Disabled"))
+                Serial.printf("\tip : %s", wan.ip);
+            break;
+        case PEPLINKAPI_WAN_TYPE_CELLULAR:
+        {
+            Serial.print("\ttype : cellular");
+            if (strcmp(wan.status, "Disabled"))
+            {
+                Serial.printf("\tip : %s", wan.ip);
+                Serial.printf("\tcarrier: %s", wan.cellular.carrier);
+                Serial.printf("\trssi: %d\n", wan.cellular.rssi);
+                if (wan.cellular.carrier[0])
+                {
+                    Serial.printf("%s %s Bars:%d\n", wan.cellular.carrier, wan.cellular.networkType, wan.cellular.signalLevel);
+                }
+                printSimCards(wan.cellular.simCards, wan.cellular.simCount);
+            }
+        }
+        break;
+        case PEPLINKAPI_WAN_TYPE_WIFI:
+        {
+            Serial.print("\ttype : wifi");
+            if (strcmp(wan.status, "Disabled"))
+            {
+                Serial.printf("\tip : %s", wan.ip);
+                Serial.printf("\tstrength: %d", wan.wifi.strength);
+                Serial.printf("\tssid: %s", wan.wifi.ssid);
+                Serial.printf("\tbssid: %s", wan.wifi.bssid);
+            }
+        }
+        break;
+        }
+        Serial.println();
+    }
+    router.unlock();
+}
+
+void printSimCards(const PeplinkAPI_WAN_Cellular_SIM *simList, size_t simCount)
+{
+    Serial.println("\t\tSIM Cards: ");
+    for (size_t it = 0; it < simCount; ++it)
+    {
+        Serial.printf("\t\tSIM %d: ", it);
+        Serial.print((simList[it].detected) ? "detected" : "not detected");
+        if (simList[it].detected)
+        {
+            Serial.print((simList[it].active) ? ", active" : ", inactive");
+            Serial.printf(", iccid - %s", simList[it].iccid);
+        }
+        Serial.println();
+    }
 }
\ No newline at end of file
@@ -1,231 +1,283 @@
-/**
- * @file  utils.h
- * @brief Contains common user definitions
- */
-
-#ifndef _STARLINKFOB_UTILS_H_
-#define _STARLINKFOB_UTILS_H_
-
-#include <stdint.h>
-
-#include <WiFi.h>
-#include <WebServer.h>
-#include <HTTPUpdateServer.h>
-#include <SPIFFS.h>
-#include <Preferences.h>
-#include "SHT3X.h"
-#include "QMP6988.h"
-
-#include "PeplinkAPI.h"
-#include "config.h"
-#include "Minu/minu.hpp"
-
-#define TFT_GREY 0x5AEB  // New colour
-
-/// @brief User-defined credentials 
-typedef struct
-{
-    // SSID of the first-priority Wi-Fi network the fob attempts to connect to in station mode
-    char ssidStaPrimary[NAME_MAX_LEN];             
-    char passwordStaPrimary[PASSWORD_MAX_LEN];
-    // SSID of the second-priority Wi-Fi network the fob attempts to connect to in station mode after
-    // connecting to the first-priority network fails
-    char ssidStaSecondary[NAME_MAX_LEN];
-    char passwordStaSecondary[PASSWORD_MAX_LEN];
-    // SSID used for the local AP 
-    char ssidSoftAp[NAME_MAX_LEN];
-    char passwordSoftAp[PASSWORD_MAX_LEN];
-    // Router IP address
-    char ip[IPV4_MAX_LEN];
-    // Router port
-    uint16_t port;
-    // Administrator username for logging into the router
-    char username[NAME_MAX_LEN];
-    // Administrator password
-    char password[PASSWORD_MAX_LEN];
-    // Default name used when creating a new client
-    char clientName[NAME_MAX_LEN];
-    // Default access rights for a newly created client
-    PeplinkAPI_ClientScope_t clientScope;
-    // Millisecond duration to wait for Wi-Fi to connect in station mode before timing out
-    long wifiTimeoutMs;
-}PeplinkAPI_Settings_t;
-
-struct PingTarget {
-  String displayHostname; // User-friendly name of the target
-  bool useIP;             // ping by IP if true, by FQN if false
-  IPAddress pingIP;       // IP to use when pinging
-  String fqn;             // Fully-qualified name to use when pinging
-  bool pinged;            // Whether or not a ping has been sent to this host
-  bool pingOK;            // result of ping
-};
-
-typedef struct 
-{
-  char lastShutdownTime[20];
-  char lastShutdownTimezone[20];
-  uint64_t lastShutdownRuntime;
-} ShutdownTimestamp_t;
-
-typedef struct 
-{
-  char lastTempAlertTime[20];
-  float lastTempAlertThresh;
-  float lastTempAlertTemp;
-} AlertTimestamp_t;
-
-typedef struct 
-{
-  String ssidStaPrimary;
-  String passwordStaPrimary;
-  String ssidStaSecondary;
-  String passwordStaSecondary;
-  String ssidSoftAp;
-  String passwordSoftAp;
-  bool usePrimarySsid;
-  bool timedOut;
-  long timeoutMs;
-  long timestamp;
-}StarlinkFob_WifiState_t;
-
-typedef struct 
-{
-  /// @brief Handle of the local HTTP server
-  WebServer httpServer;
-  /// @brief Handle used for firmware updates over HTTP
-  HTTPUpdateServer updateServer;
-  bool started;
-}StarlinkFob_HttpServerState_t;
-
-typedef struct 
-{
-  PeplinkRouter router;
-  String ip;
-  uint16_t port;
-  String username;
-  String password;
-  String clientName;
-  PeplinkAPI_ClientScope_t clientScope;
-}StarlinkFob_RouterState_t;
-
-typedef struct 
-{
-  SHT3X sht;
-  QMP6988 qmp;
-  bool shtAvailable;
-  bool qmpAvailable;
-}StarlinkFob_SensorState_t;
-
-typedef enum
-{
-  STARLINKFOB_BUTTONPRESS_NONE,
-  STARLINKFOB_BUTTONPRESS_SHORT,
-  STARLINKFOB_BUTTONPRESS_LONG,
-}StarlinkFob_ButtonPress_t;
-
-typedef struct 
-{
-  int32_t pressDurationA;
-  uint32_t lastPressTimeA;
-  StarlinkFob_ButtonPress_t btnPressA;
-  bool isPressedA;
-
-  int32_t pressDurationB;
-  uint32_t lastPressTimeB;
-  StarlinkFob_ButtonPress_t btnPressB;
-  bool isPressedB;
-
-  int32_t pressDurationC;
-  uint32_t lastPressTimeC;
-  StarlinkFob_ButtonPress_t btnPressC;
-  bool isPressedC;
-}StarlinkFob_ButtonState_t;
-
-typedef struct 
-{
-  String lastShutdownTime;
-  String lastShutdownDate;
-  String lastShutdownTimezone;
-  uint64_t lastShutdownRuntime;
-
-  String lastTempAlertTime;
-  String lastTempAlertDate;
-  float lastTempAlertThresh;
-  float lastTempAlertTemp;
-}StarlinkFob_TimestampState_t;
-
-typedef struct
-{
-  TaskHandle_t countdown;
-  TaskHandle_t screenWatch;
-  TaskHandle_t screenUpdate;
-  TaskHandle_t buttonWatch;
-  TaskHandle_t dataUpdate;
-  TaskHandle_t wifiWatch;
-  TaskHandle_t routerConnect;
-}StarlinkFob_TaskState_t;
-
-typedef struct 
-{
-  bool booting;
-  StarlinkFob_WifiState_t wifi;
-  StarlinkFob_HttpServerState_t servers;
-  StarlinkFob_RouterState_t routers;
-  StarlinkFob_SensorState_t sensors;
-  StarlinkFob_ButtonState_t buttons;
-  StarlinkFob_TimestampState_t timestamps;
-  StarlinkFob_TaskState_t tasks;
-  Minu menu;
-  /// @brief List of targets to be pinged
-  std::vector<PingTarget> pingTargets;
-}StarlinkFob_GlobalState_t;
-
-extern StarlinkFob_GlobalState_t fob;
-
-/// @brief Overwrite user credentials in runtime variables with their hard-coded default values 
-void resetPreferences();
-
-/// @brief Save the current values of user-defined credentials in runtime variables to non-volatile storage
-/// @return true, on success
-/// @return false, on fail
-bool savePreferences();
-
-/// @brief Print out the current contents of user-defined credentials in runtime variables to the serial console
-void dumpPreferences();
-
-/// @brief Copy router-assigned credentials from non-volatile storage to their corresponding runtime variables
-void retrieveStoredCredentials();
-
-/// @brief Copy user-defined credentials from non-volatile storage to their corresponding runtime variables
-void restorePreferences();
-
-void retrieveLastShutdownInfo();
-
-///@brief Retrieve info on last over-temperature alert
-void retrieveLastAlertInfo();
-
-/// @brief Start the local webserver
-void startHttpServer();
-
-/// @brief Modify the timezone of network-synced time
-void setTimezone(const char* tzone);
-
-/// @brief Synchronize local RTC time to network time while setting the default timezone
-bool syncNtpToRtc(const char* tzone);
-
-/// @brief Convenience function to print router information to serial 
-void printRouterInfo(PeplinkRouter &router);
-
-/// @brief Convenience function to print router location to serial 
-void printRouterLocation(PeplinkRouter &router);
-
-/// @brief Convenience function to print router clients to serial 
-void printRouterClients(PeplinkRouter &router);
-
-/// @brief Convenience function to print router WAN information to serial 
-void printRouterWanStatus(PeplinkRouter &router);
-
-/// @brief Convenience function to print router cellular WAN information to serial 
-void printSimCards(std::vector<PeplinkAPI_WAN_Cellular_SIM> &simList);
-
+/**
+ * @file  utils.h
+ * @brief Contains common user definitions
+ */
+
+#ifndef _STARLINKFOB_UTILS_H_
+#define _STARLINKFOB_UTILS_H_
+
+#include <stdint.h>
+
+#include <WiFi.h>
+#include <WebServer.h>
+#include <HTTPUpdateServer.h>
+#include <SPIFFS.h>
+#include <Preferences.h>
+#include "SHT3X.h"
+#include "QMP6988.h"
+
+#include "PeplinkAPI.h"
+#include "RouterCache.h"
+#include "NetDiag.h"
+#include "DnsCache.h"
+#include "LinkMonitor.h"
+#include "EventLog.h"
+#include "config.h"
+#include "Minu/minu.hpp"
+
+#define TFT_GREY 0x5AEB  // New colour
+
+/// @brief User-defined credentials 
+typedef struct
+{
+    // SSID of the first-priority Wi-Fi network the fob attempts to connect to in station mode
+    char ssidStaPrimary[NAME_MAX_LEN];             
+    char passwordStaPrimary[PASSWORD_MAX_LEN];
+    // SSID of the second-priority Wi-Fi network the fob attempts to connect to in station mode after
+    // connecting to the first-priority network fails
+    char ssidStaSecondary[NAME_MAX_LEN];
+    char passwordStaSecondary[PASSWORD_MAX_LEN];
+    // SSID used for the local AP 
+    char ssidSoftAp[NAME_MAX_LEN];
+    char passwordSoftAp[PASSWORD_MAX_LEN];
+    // Router IP address
+    char ip[IPV4_MAX_LEN];
+    // Router port
+    uint16_t port;
+    // Administrator username for logging into the router
+    char username[NAME_MAX_LEN];
+    // Administrator password
+    char password[PASSWORD_MAX_LEN];
+    // Default name used when creating a new client
+    char clientName[NAME_MAX_LEN];
+    // Default access rights for a newly created client
+    PeplinkAPI_ClientScope_t clientScope;
+    // Millisecond duration to wait for Wi-Fi to connect in station mode before timing out
+    long wifiTimeoutMs;
+}PeplinkAPI_Settings_t;
+
+struct PingTarget {
+  String displayHostname; // User-friendly name of the target
+  bool useIP;             // ping by IP if true, by FQN if false
+  IPAddress pingIP;       // IP to use when pinging
+  String fqn;             // Fully-qualified name to use when pinging
+  bool pinged;            // Whether or not a ping has been sent to this host
+  bool pingOK;            // result of ping
+  NetDiag_PingResult stats; // Round-trip times and loss of the last sweep
+  bool dnsOK;             // Whether the FQN resolved for the last sweep. Always true when pinging by IP
+  uint32_t dnsLatencyMs;  // Duration of the lookup behind the address pinged, which may have been answered from the cache
+};
+
+typedef struct 
+{
+  String ssidStaPrimary;
+  String passwordStaPrimary;
+  String ssidStaSecondary;
+  String passwordStaSecondary;
+  String ssidSoftAp;
+  String passwordSoftAp;
+  bool usePrimarySsid;
+  bool timedOut;
+  long timeoutMs;
+  long timestamp;
+}StarlinkFob_WifiState_t;
+
+typedef struct 
+{
+  /// @brief Handle of the local HTTP server
+  WebServer httpServer;
+  /// @brief Handle used for firmware updates over HTTP
+  HTTPUpdateServer updateServer;
+  bool started;
+}StarlinkFob_HttpServerState_t;
+
+typedef struct 
+{
+  PeplinkRouter router;
+  RouterStateCache cache;   // Last fetched router state, read by the UI instead of querying the router directly
+  String ip;
+  uint16_t port;
+  String username;
+  String password;
+  String clientName;
+  PeplinkAPI_ClientScope_t clientScope;
+}StarlinkFob_RouterState_t;
+
+typedef struct 
+{
+  SHT3X sht;
+  QMP6988 qmp;
+  bool shtAvailable;
+  bool qmpAvailable;
+}StarlinkFob_SensorState_t;
+
+typedef enum
+{
+  STARLINKFOB_BUTTON_A,
+  STARLINKFOB_BUTTON_B,
+  STARLINKFOB_BUTTON_C,
+  STARLINKFOB_BUTTON_COUNT,
+}StarlinkFob_Button_t;
+
+typedef enum
+{
+  STARLINKFOB_BUTTONPRESS_NONE,
+  STARLINKFOB_BUTTONPRESS_SHORT,      // Released within LONG_PRESS_THRESHOLD_MS
+  STARLINKFOB_BUTTONPRESS_LONG,       // Held past LONG_PRESS_THRESHOLD_MS
+  STARLINKFOB_BUTTONPRESS_SHUTDOWN,   // Held past SHUTDOWN_PRESS_THRESHOLD_MS
+}StarlinkFob_ButtonPress_t;
+
+/// @brief A debounced and classified button press, sent once the button is released
+typedef struct
+{
+  StarlinkFob_Button_t button;
+  StarlinkFob_ButtonPress_t press;
+  uint32_t durationMs;
+}StarlinkFob_ButtonEvent_t;
+
+typedef struct 
+{
+  /// @brief Queue of StarlinkFob_ButtonEvent_t sent by the button task to the screen watch task
+  QueueHandle_t events;
+}StarlinkFob_ButtonState_t;
+
+typedef struct 
+{
+  String lastShutdownTime;
+  String lastShutdownDate;
+  String lastShutdownTimezone;
+  uint64_t lastShutdownRuntime;
+
+  String lastTempAlertTime;
+  String lastTempAlertDate;
+  float lastTempAlertThresh;
+  float lastTempAlertTemp;
+}StarlinkFob_TimestampState_t;
+
+typedef struct
+{
+  TaskHandle_t countdown;
+  TaskHandle_t screenWatch;
+  TaskHandle_t screenUpdate;
+  TaskHandle_t buttonWatch;
+  TaskHandle_t dataUpdate;
+  TaskHandle_t routerView;
+  TaskHandle_t connection;
+}StarlinkFob_TaskState_t;
+
+typedef struct 
+{
+  bool booting;
+  StarlinkFob_WifiState_t wifi;
+  StarlinkFob_HttpServerState_t servers;
+  StarlinkFob_RouterState_t routers;
+  StarlinkFob_SensorState_t sensors;
+  StarlinkFob_ButtonState_t buttons;
+  StarlinkFob_TimestampState_t timestamps;
+  StarlinkFob_TaskState_t tasks;
+  Minu menu;
+  /// @brief Host names resolved for the ping targets and the router
+  DnsCache dns;
+  /// @brief Rolling RTT, jitter and loss statistics of the ping targets
+  LinkMonitor links;
+  /// @brief List of targets to be pinged
+  std::vector<PingTarget> pingTargets;
+}StarlinkFob_GlobalState_t;
+
+extern StarlinkFob_GlobalState_t fob;
+
+/// @brief Overwrite user credentials in runtime variables with their hard-coded default values 
+void resetPreferences();
+
+/// @brief Save the current values of user-defined credentials in runtime variables to non-volatile storage
+/// @return true, on success
+/// @return false, on fail
+bool savePreferences();
+
+/// @brief Print out the current contents of user-defined credentials in runtime variables to the serial console
+void dumpPreferences();
+
+/// @brief Copy router-assigned credentials from non-volatile storage to their corresponding runtime variables,
+/// keeping them in RAM so later changes are only written when they differ. Must be called before the other credential functions
+void retrieveStoredCredentials();
+
+/// @brief Keep a new router cookie in RAM. It is written to non-volatile storage by flushStoredCredentials(),
+/// and not at all if it is the one already stored. Safe to call from any task
+void storeRouterCookie(const String &cookie);
+
+/// @brief Keep a new router access token in RAM, like storeRouterCookie(), along with when it expires
+/// @param validForS Seconds the router granted the token for. 0 if unknown
+void storeRouterToken(const String &token, uint32_t validForS);
+
+/// @brief Keep the ID and secret of the router client the fob created in RAM, like storeRouterCookie()
+void storeRouterClient(const String &id, const String &secret);
+
+/// @brief Write router credentials kept in RAM to non-volatile storage once they have been left unchanged
+/// for CREDENTIAL_FLUSH_DELAY_MS, or at most CREDENTIAL_FLUSH_MAX_DELAY_MS after the first change
+/// @param force Write any change now, e.g. before shutting down
+/// @return Milliseconds until a pending write is due, or 0 if none is pending
+uint32_t flushStoredCredentials(bool force = false);
+
+/// @brief Forget router credentials, both in RAM and in non-volatile storage
+/// @return false if the storage couldn't be opened
+bool clearStoredCredentials();
+
+/// @brief Copy user-defined credentials from non-volatile storage to their corresponding runtime variables
+void restorePreferences();
+
+///@brief Retrieve info on the last shutdown from the event log
+void retrieveLastShutdownInfo();
+
+///@brief Retrieve info on last over-temperature alert from the event log
+void retrieveLastAlertInfo();
+
+/// @brief Open the event log. Must be called once SPIFFS is mounted
+void eventLogInit();
+
+/// @brief Append an event to the event log, stamped with the RTC time. Safe to call from any task
+/// @return false if it couldn't be written
+bool logEvent(EventLog_Type_t type, int32_t value = 0, uint8_t subject = 0, uint8_t detail = 0);
+
+/// @brief Copy logged events older than \a beforeSeq into \a records, newest first
+/// @return Number of events copied
+size_t readEvents(EventLog_Record *records, size_t maxRecords, uint32_t beforeSeq = UINT32_MAX);
+
+/// @brief Find the newest logged event of a \a type
+/// @return false if none is kept
+bool findLastEvent(EventLog_Type_t type, EventLog_Record &record);
+
+/// @brief Print the time of a logged event the way the time page shows timestamps
+void formatEventTime(uint32_t time, char *buffer, size_t len);
+
+/// @brief Start the local webserver
+void startHttpServer();
+
+/// @brief Modify the timezone of network-synced time
+void setTimezone(const char* tzone);
+
+/// @brief Synchronize local RTC time to network time while setting the default timezone
+bool syncNtpToRtc(const char* tzone);
+
+/// @brief Start counting the ticks in which each CPU core gets to run its idle task
+void cpuLoadInit();
+
+/// @brief Get the share of ticks since the last call in which \a core never went idle
+/// @return Load of the core in percent
+uint8_t cpuLoadPercent(int core);
+
+/// @brief Convenience function to print router information to serial 
+void printRouterInfo(PeplinkRouter &router);
+
+/// @brief Convenience function to print router location to serial 
+void printRouterLocation(PeplinkRouter &router);
+
+/// @brief Convenience function to print router clients to serial 
+void printRouterClients(PeplinkRouter &router);
+
+/// @brief Convenience function to print router WAN information to serial 
+void printRouterWanStatus(PeplinkRouter &router);
+
+/// @brief Convenience function to print router cellular WAN information to serial 
+void printSimCards(const PeplinkAPI_WAN_Cellular_SIM *simList, size_t simCount);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,274 @@
+/**
+ * @file  bench_wan_status.cpp
+ * @brief Compares the peak heap and time of parsing status.wan.connection the way the fob did before responses
+ * were parsed straight off the connection (buffer the body into a String, parse it whole to check "stat", parse it
+ * again, then re-serialise and parse each WAN a third time) against PeplinkRouter::getWanStatus(), which parses the
+ * stream once through a filter. Run with `make -C test bench`.
+ * Heap is counted by wrapping malloc() and friends, on the benchmark's thread only, so the mock router's threads
+ * don't show up in it. The numbers depend on the ArduinoJson build and the host's allocator, so compare the two
+ * columns with each other rather than with the ESP32's heap
+ */
+
+#include <malloc.h>
+#include <time.h>
+
+#include <algorithm>
+
+#include "PeplinkAPI.h"
+#include "utils.h"
+#include "mock_router.h"
+
+#define TEST_USERNAME "admin"
+#define TEST_PASSWORD "secret"
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void __libc_free(void *ptr);
+
+static __thread bool heapTracked;
+static long long heapLive;
+static long long heapPeak;
+
+static void heapAdd(void *ptr)
+{
+  if (ptr && heapTracked)
+  {
+    heapLive += malloc_usable_size(ptr);
+    if (heapLive > heapPeak)
+      heapPeak = heapLive;
+  }
+}
+
+static void heapRemove(void *ptr)
+{
+  if (ptr && heapTracked)
+    heapLive -= malloc_usable_size(ptr);
+}
+
+extern "C" void *malloc(size_t size)
+{
+  void *ptr = __libc_malloc(size);
+  heapAdd(ptr);
+  return ptr;
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+  void *ptr = __libc_calloc(count, size);
+  heapAdd(ptr);
+  return ptr;
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+  heapRemove(ptr);
+  void *moved = __libc_realloc(ptr, size);
+  heapAdd(moved ? moved : ptr);
+  return moved;
+}
+
+extern "C" void free(void *ptr)
+{
+  heapRemove(ptr);
+  __libc_free(ptr);
+}
+
+/// @brief Start measuring the peak heap from what is allocated now
+/// @return Heap allocated now, to pass to heapPeakSinceMark()
+static long long heapMark()
+{
+  heapPeak = heapLive;
+  return heapLive;
+}
+
+/// @brief Return the most heap held above what was allocated at heapMark()
+static size_t heapPeakSinceMark(long long mark)
+{
+  return heapPeak - mark;
+}
+
+static MockRouter mock;
+
+static uint64_t nowUs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/// @brief One WAN of each type, plus a disabled one
+static std::vector<MockRouter_WAN> benchWans()
+{
+  std::vector<MockRouter_WAN> wans(4);
+
+  wans[0].id = 1;
+  wans[0].name = "WAN 1";
+  wans[0].type = "ethernet";
+  wans[0].priority = 2;
+  wans[0].ip = "192.0.2.10";
+
+  wans[1].id = 2;
+  wans[1].name = "Cellular";
+  wans[1].type = "cellular";
+  wans[1].priority = 1;
+  wans[1].ip = "198.51.100.7";
+  wans[1].carrier = "Mock Mobile";
+  wans[1].signalLevel = 4;
+  wans[1].network = "LTE";
+  wans[1].sims = {{true, true, "8901260000000000001"}, {false, false, ""}};
+
+  wans[2].id = 3;
+  wans[2].name = "Wi-Fi WAN";
+  wans[2].type = "wifi";
+  wans[2].ip = "203.0.113.5";
+  wans[2].strength = 70;
+  wans[2].ssid = "Campsite";
+  wans[2].bssid = "aa:bb:cc:dd:ee:ff";
+
+  wans[3].id = 4;
+  wans[3].name = "WAN 2";
+  wans[3].type = "ethernet";
+  wans[3].priority = 3;
+  wans[3].message = "Disabled";
+  wans[3].statusLed = "gray";
+  return wans;
+}
+
+/// @brief Fetch a body into a String and parse it whole to check "stat", as _sendJsonRequest() used to
+static String fetchBuffered(HTTPClient &http, WiFiClient &client, const String &uri)
+{
+  JsonDocument recvDoc;
+  String response;
+
+  http.begin(client, "127.0.0.1", mock.port(), uri);
+  if (http.GET() > 0)
+    response = http.getString();
+  http.end();
+
+  if (deserializeJson(recvDoc, response))
+    return String();
+  String opStatus = recvDoc["stat"];
+  if (opStatus != "ok")
+    return String();
+  return response;
+}
+
+/// @brief Fetch and parse the WAN status as getWanStatus() used to: parse the buffered body again, then
+/// re-serialise each WAN in the order list and parse it a third time to read its fields
+/// @return Number of named WANs read, or -1 if the request failed
+static int getWanStatusBuffered(HTTPClient &http, WiFiClient &client, const String &token)
+{
+  String response = fetchBuffered(http, client, "/api/status.wan.connection?accessToken=" + token);
+  if (!response.length())
+    return -1;
+
+  JsonDocument recvDoc;
+  deserializeJson(recvDoc, response);
+
+  int named = 0;
+  for (int key : recvDoc["response"]["order"].as<JsonArray>())
+  {
+    String wanInfo = recvDoc["response"][String(key).c_str()].as<String>();
+    JsonDocument wanDoc;
+    deserializeJson(wanDoc, wanInfo);
+    if (wanDoc["name"].as<String>().length())
+      ++named;
+  }
+  return named;
+}
+
+/// @brief Time and peak heap of one way of fetching the WAN status, over several runs
+struct BenchResult
+{
+  uint64_t totalUs;
+  size_t peakHeap;
+  bool ok;
+};
+
+static BenchResult benchBuffered(const String &token, int iterations)
+{
+  BenchResult result = {0, 0, true};
+  WiFiClient client;
+  HTTPClient http;
+  http.setReuse(true);
+
+  for (int i = 0; i < iterations; ++i)
+  {
+    long long mark = heapMark();
+    uint64_t start = nowUs();
+    int named = getWanStatusBuffered(http, client, token);
+    result.totalUs += nowUs() - start;
+    result.peakHeap = std::max(result.peakHeap, heapPeakSinceMark(mark));
+    result.ok &= named == 4;
+  }
+  client.stop();
+  return result;
+}
+
+static BenchResult benchStreamed(PeplinkRouter &router, int iterations)
+{
+  BenchResult result = {0, 0, true};
+
+  for (int i = 0; i < iterations; ++i)
+  {
+    long long mark = heapMark();
+    uint64_t start = nowUs();
+    bool ok = router.getWanStatus(0, false);
+    result.totalUs += nowUs() - start;
+    result.peakHeap = std::max(result.peakHeap, heapPeakSinceMark(mark));
+    result.ok &= ok;
+  }
+  router.lock();
+  result.ok &= router.wanStatus().size() == 4;
+  router.unlock();
+  return result;
+}
+
+int main()
+{
+  heapTracked = true;
+
+  if (!mock.start())
+  {
+    printf("SKIP bench_wan_status: can't listen on loopback\n");
+    return 0;
+  }
+  mock.setCredentials(TEST_USERNAME, TEST_PASSWORD);
+  mock.setWans(benchWans());
+  fob.routers.username = TEST_USERNAME;
+  fob.routers.password = TEST_PASSWORD;
+
+  PeplinkRouter router;
+  router.setIP("127.0.0.1");
+  router.setPort(mock.port());
+  if (!router.begin(TEST_USERNAME, TEST_PASSWORD, CLIENT_NAME_DEFAULT, CLIENT_SCOPE_READ_WRITE, false).length())
+  {
+    printf("FAIL bench_wan_status: can't log in to the mock router\n");
+    return 1;
+  }
+
+  const int iterations = 20;
+  const size_t paddings[] = {0, 1024, 4096, 16384};
+  bool ok = true;
+
+  printf("%-10s | %-24s | %-24s\n", "", "buffered, parsed 3 times", "streamed through filter");
+  printf("%10s | %11s %12s | %11s %12s\n", "body bytes", "peak heap", "parse us", "peak heap", "parse us");
+  for (size_t padding : paddings)
+  {
+    mock.setPadding(padding);
+    BenchResult buffered = benchBuffered(storedCredentials.token, iterations);
+    size_t size = mock.lastWanStatusSize();
+    BenchResult streamed = benchStreamed(router, iterations);
+
+    printf("%10zu | %11zu %12llu | %11zu %12llu\n", size,
+           buffered.peakHeap, (unsigned long long)(buffered.totalUs / iterations),
+           streamed.peakHeap, (unsigned long long)(streamed.totalUs / iterations));
+    ok &= buffered.ok && streamed.ok;
+  }
+
+  mock.stop();
+  if (!ok)
+    printf("FAIL bench_wan_status: a WAN status request failed\n");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file  check.h
+ * @brief Minimal check macros shared by the host tests
+ */
+
+#ifndef _STARLINKFOB_TEST_CHECK_H_
+#define _STARLINKFOB_TEST_CHECK_H_
+
+#include <stdio.h>
+
+/// @brief Number of checks that failed in this test program
+inline int checkFailures = 0;
+
+/// @brief Report a failed check and carry on, so one run lists every failure
+#define CHECK(cond)                                                                  \
+  do                                                                                 \
+  {                                                                                  \
+    if (!(cond))                                                                     \
+    {                                                                                \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);       \
+      ++checkFailures;                                                               \
+    }                                                                                \
+  } while (0)
+
+/// @brief Report a failed comparison along with both values
+#define CHECK_EQ(actual, expected)                                                   \
+  do                                                                                 \
+  {                                                                                  \
+    long long _a = (long long)(actual), _e = (long long)(expected);                  \
+    if (_a != _e)                                                                    \
+    {                                                                                \
+      fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n",              \
+              __FILE__, __LINE__, #actual, #expected, _a, _e);                       \
+      ++checkFailures;                                                               \
+    }                                                                                \
+  } while (0)
+
+/// @brief Run a test function, naming it in the output
+#define RUN_TEST(fn)                                                                 \
+  do                                                                                 \
+  {                                                                                  \
+    int _before = checkFailures;                                                     \
+    fn();                                                                            \
+    printf("%s %s\n", checkFailures == _before ? "PASS" : "FAIL", #fn);             \
+  } while (0)
+
+/// @brief Exit status of the test program
+#define TEST_RESULT() (checkFailures ? 1 : 0)
+
+#endif
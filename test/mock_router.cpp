@@ -0,0 +1,588 @@
+#include <chrono>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "mock_router.h"
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Connections the router drops are closed this long after the request, so the client is already waiting for the answer
+#define MOCK_ROUTER_DROP_DELAY_MS 20
+
+/// @brief Bytes per chunk when sending chunked bodies
+#define MOCK_ROUTER_CHUNK_SIZE 1024
+
+/// @brief Return the string value of \a key in a flat JSON object, or "" if absent.
+/// The fob serialises its request bodies compactly, so this doesn't need a parser
+static std::string jsonString(const std::string &json, const char *key)
+{
+  std::string pattern = std::string("\"") + key + "\":\"";
+  size_t start = json.find(pattern);
+  if (start == std::string::npos)
+    return std::string();
+  start += pattern.size();
+  size_t end = json.find('"', start);
+  return json.substr(start, end == std::string::npos ? std::string::npos : end - start);
+}
+
+static std::string quoted(const std::string &s)
+{
+  return "\"" + s + "\"";
+}
+
+static std::string fail(int code, const char *message)
+{
+  return "{\"stat\":\"fail\",\"code\":" + std::to_string(code) + ",\"message\":" + quoted(message) + "}";
+}
+
+static bool sendAll(int fd, const std::string &data)
+{
+  size_t sent = 0;
+  while (sent < data.size())
+  {
+    ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    sent += n;
+  }
+  return true;
+}
+
+MockRouter::MockRouter()
+{
+}
+
+MockRouter::~MockRouter()
+{
+  stop();
+}
+
+bool MockRouter::start()
+{
+  _listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  if (_listenFd < 0)
+    return false;
+  int one = 1;
+  setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t len = sizeof(addr);
+  if (bind(_listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(_listenFd, 8) < 0 ||
+      getsockname(_listenFd, (struct sockaddr *)&addr, &len) < 0)
+  {
+    close(_listenFd);
+    _listenFd = -1;
+    return false;
+  }
+  _port = ntohs(addr.sin_port);
+  _stopping = false;
+  _acceptThread = std::thread(&MockRouter::_accept, this);
+  return true;
+}
+
+void MockRouter::stop()
+{
+  if (_listenFd < 0)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+    shutdown(_listenFd, SHUT_RDWR);
+    for (int fd : _fds)
+      shutdown(fd, SHUT_RDWR);
+  }
+  _acceptThread.join();
+  for (std::thread &thread : _threads)
+    thread.join();
+  _threads.clear();
+  close(_listenFd);
+  _listenFd = -1;
+}
+
+void MockRouter::_accept()
+{
+  for (;;)
+  {
+    int fd = accept(_listenFd, NULL, NULL);
+    if (fd < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_stopping)
+    {
+      close(fd);
+      return;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    _connections++;
+    _fds.push_back(fd);
+    _threads.emplace_back(&MockRouter::_serve, this, fd);
+  }
+}
+
+void MockRouter::_serve(int fd)
+{
+  std::string buffer;
+  Clock::time_point arrival = Clock::now();
+  bool open = true;
+
+  while (open)
+  {
+    // Answer every complete request received so far, in order
+    size_t headerEnd;
+    while (open && (headerEnd = buffer.find("\r\n\r\n")) != std::string::npos)
+    {
+      Request request;
+      request.keepAlive = true;
+      size_t contentLength = 0;
+
+      size_t lineEnd = buffer.find("\r\n");
+      std::string requestLine = buffer.substr(0, lineEnd);
+      size_t methodEnd = requestLine.find(' ');
+      size_t uriEnd = requestLine.find(' ', methodEnd + 1);
+      request.method = requestLine.substr(0, methodEnd);
+      std::string uri = requestLine.substr(methodEnd + 1, uriEnd - methodEnd - 1);
+      if (requestLine.compare(uriEnd + 1, std::string::npos, "HTTP/1.0") == 0)
+        request.keepAlive = false;
+
+      for (size_t pos = lineEnd + 2; pos < headerEnd;)
+      {
+        size_t end = buffer.find("\r\n", pos);
+        std::string line = buffer.substr(pos, end - pos);
+        pos = end + 2;
+        size_t colon = line.find(':');
+        if (colon == std::string::npos)
+          continue;
+        std::string name = line.substr(0, colon);
+        std::string value = line.substr(line.find_first_not_of(' ', colon + 1));
+        if (!strcasecmp(name.c_str(), "Content-Length"))
+          contentLength = strtoul(value.c_str(), NULL, 10);
+        else if (!strcasecmp(name.c_str(), "Cookie"))
+          request.cookie = value;
+        else if (!strcasecmp(name.c_str(), "Connection"))
+          request.keepAlive = strcasecmp(value.c_str(), "close") != 0;
+      }
+
+      if (buffer.size() < headerEnd + 4 + contentLength)
+        break;
+      request.body = buffer.substr(headerEnd + 4, contentLength);
+      buffer.erase(0, headerEnd + 4 + contentLength);
+
+      size_t queryStart = uri.find('?');
+      request.path = uri.substr(0, queryStart);
+      if (queryStart != std::string::npos)
+      {
+        std::string query = uri.substr(queryStart + 1);
+        for (size_t pos = 0; pos <= query.size();)
+        {
+          size_t end = query.find('&', pos);
+          if (end == std::string::npos)
+            end = query.size();
+          std::string param = query.substr(pos, end - pos);
+          size_t equals = param.find('=');
+          if (equals != std::string::npos)
+            request.query[param.substr(0, equals)] = param.substr(equals + 1);
+          pos = end + 1;
+        }
+      }
+
+      uint32_t latencyMs;
+      bool drop;
+      bool chunked;
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _requests[request.path]++;
+        latencyMs = _latencyMs;
+        chunked = _chunked;
+        drop = _dropPath == request.path;
+        if (drop)
+          _dropPath.clear();
+      }
+      std::this_thread::sleep_until(arrival + std::chrono::milliseconds(latencyMs));
+
+      std::string extraHeaders;
+      std::string body = _handle(request, extraHeaders);
+
+      if (drop)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(MOCK_ROUTER_DROP_DELAY_MS));
+        open = false;
+        break;
+      }
+
+      bool found = body.size();
+      if (!found)
+        body = fail(404, "Not found");
+      std::string response = found ? "HTTP/1.1 200 OK\r\n" : "HTTP/1.1 404 Not Found\r\n";
+      response += "Content-Type: application/json\r\n";
+      response += request.keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+      response += extraHeaders;
+      if (chunked)
+      {
+        response += "Transfer-Encoding: chunked\r\n\r\n";
+        for (size_t pos = 0; pos < body.size(); pos += MOCK_ROUTER_CHUNK_SIZE)
+        {
+          size_t len = std::min(body.size() - pos, (size_t)MOCK_ROUTER_CHUNK_SIZE);
+          char size[16];
+          snprintf(size, sizeof(size), "%zx\r\n", len);
+          response += size;
+          response.append(body, pos, len);
+          response += "\r\n";
+        }
+        response += "0\r\n\r\n";
+      }
+      else
+      {
+        response += "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+        response += body;
+      }
+
+      if (!sendAll(fd, response) || !request.keepAlive)
+        open = false;
+    }
+    if (!open)
+      break;
+
+    char data[4096];
+    ssize_t n = recv(fd, data, sizeof(data), 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    arrival = Clock::now();
+    buffer.append(data, n);
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto it = _fds.begin(); it != _fds.end(); ++it)
+  {
+    if (*it == fd)
+    {
+      _fds.erase(it);
+      break;
+    }
+  }
+  shutdown(fd, SHUT_RDWR);
+  close(fd);
+}
+
+std::string MockRouter::_handle(const Request &request, std::string &extraHeaders)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (request.path == "/api/login" && request.method == "POST")
+    return _login(request, extraHeaders);
+  if (request.path == "/api/auth.client")
+    return _authClient(request);
+  if (request.path == "/api/auth.token.grant" && request.method == "POST")
+    return _tokenGrant(request);
+
+  bool status = request.path == "/api/status.wan.connection" || request.path == "/api/status.traffic" ||
+                request.path == "/api/status.system.info" || request.path == "/api/info.location" ||
+                request.path == "/api/cmd.system.reboot";
+  if (!status)
+    return std::string();
+  if (!_tokenValid(request))
+    return fail(401, "Invalid access token");
+
+  if (request.path == "/api/status.wan.connection")
+    return _wanStatus(request);
+  if (request.path == "/api/status.traffic")
+    return _traffic();
+  if (request.path == "/api/status.system.info")
+    return _systemInfo();
+  if (request.path == "/api/info.location")
+    return _location();
+  _reboots++;
+  return "{\"stat\":\"ok\"}";
+}
+
+bool MockRouter::_cookieValid(const Request &request) const
+{
+  return _cookie.size() && request.cookie == _cookie;
+}
+
+bool MockRouter::_tokenValid(const Request &request) const
+{
+  auto token = request.query.find("accessToken");
+  if (token == request.query.end())
+    return false;
+  for (const std::string &valid : _tokens)
+    if (valid == token->second)
+      return true;
+  return false;
+}
+
+std::string MockRouter::_login(const Request &request, std::string &extraHeaders)
+{
+  if (jsonString(request.body, "username") != _username || jsonString(request.body, "password") != _password)
+    return fail(401, "Unauthorized");
+
+  _cookie = "bauth=cookie" + std::to_string(++_issued);
+  extraHeaders += "Set-Cookie: " + _cookie + "; Path=/; HttpOnly\r\n";
+  return "{\"stat\":\"ok\",\"response\":{\"permission\":{\"GET\":1,\"POST\":1}}}";
+}
+
+std::string MockRouter::_authClient(const Request &request)
+{
+  if (!_cookieValid(request))
+    return fail(401, "Unauthorized");
+
+  if (request.method == "GET")
+  {
+    std::string out = "{\"stat\":\"ok\",\"response\":[";
+    for (size_t i = 0; i < _clients.size(); ++i)
+    {
+      const Client &client = _clients[i];
+      out += i ? "," : "";
+      out += "{\"name\":" + quoted(client.name) + ",\"clientId\":" + quoted(client.id) + ",\"clientSecret\":" +
+             quoted(client.secret) + ",\"scope\":" + quoted(client.scope) + ",\"createdDate\":\"2024-01-01\"}";
+    }
+    return out + "]}";
+  }
+
+  std::string action = jsonString(request.body, "action");
+  if (action == "add")
+  {
+    Client client;
+    client.name = jsonString(request.body, "name");
+    client.scope = jsonString(request.body, "scope");
+    client.id = "client" + std::to_string(++_issued);
+    client.secret = "secret" + std::to_string(_issued);
+    _clients.push_back(client);
+    return "{\"stat\":\"ok\",\"response\":{\"name\":" + quoted(client.name) + ",\"clientId\":" + quoted(client.id) +
+           ",\"clientSecret\":" + quoted(client.secret) + ",\"scope\":" + quoted(client.scope) + "}}";
+  }
+  if (action == "remove")
+  {
+    std::string id = jsonString(request.body, "clientId");
+    for (auto it = _clients.begin(); it != _clients.end(); ++it)
+    {
+      if (it->id == id)
+      {
+        _clients.erase(it);
+        return "{\"stat\":\"ok\"}";
+      }
+    }
+    return fail(404, "Client not found");
+  }
+  return fail(400, "Invalid action");
+}
+
+std::string MockRouter::_tokenGrant(const Request &request)
+{
+  std::string id = jsonString(request.body, "clientId");
+  std::string secret = jsonString(request.body, "clientSecret");
+  for (const Client &client : _clients)
+  {
+    if (client.id != id || client.secret != secret)
+      continue;
+    std::string token = "token" + std::to_string(++_issued);
+    _tokens.push_back(token);
+    return "{\"stat\":\"ok\",\"response\":{\"accessToken\":" + quoted(token) + ",\"expiresIn\":172800}}";
+  }
+  return fail(401, "Invalid client");
+}
+
+std::string MockRouter::_wanStatus(const Request &request)
+{
+  int only = 0;
+  auto id = request.query.find("id");
+  if (id != request.query.end())
+    only = atoi(id->second.c_str());
+
+  std::string order;
+  std::string wans;
+  for (const MockRouter_WAN &wan : _wans)
+  {
+    if (only && wan.id != only)
+      continue;
+    std::string key = std::to_string(wan.id);
+    order += (order.size() ? "," : "") + key;
+
+    std::string out = "{\"name\":" + quoted(wan.name) + ",\"type\":" + quoted(wan.type) + ",\"message\":" +
+                      quoted(wan.message) + ",\"statusLed\":" + quoted(wan.statusLed) + ",\"enable\":true";
+    if (wan.priority)
+      out += ",\"priority\":" + std::to_string(wan.priority);
+    out += std::string(",\"managementOnly\":") + (wan.managementOnly ? "true" : "false");
+    if (wan.ip.size())
+      out += ",\"ip\":" + quoted(wan.ip) + ",\"mask\":24,\"gateway\":\"192.0.2.1\",\"dns\":[\"192.0.2.53\",\"198.51.100.53\"]";
+    out += ",\"uptime\":86400,\"mtu\":1500,\"macAddress\":\"00:1a:dd:00:00:0" + key + "\"";
+
+    if (wan.type == "cellular")
+    {
+      out += ",\"cellular\":{\"signalLevel\":" + std::to_string(wan.signalLevel) + ",\"network\":" + quoted(wan.network) +
+             ",\"carrier\":{\"name\":" + quoted(wan.carrier) + ",\"country\":\"US\"},\"rat\":[{\"name\":\"LTE\",\"band\":[{\"name\":\"B2\"}]}]";
+      std::string simOrder;
+      std::string sims;
+      for (size_t i = 0; i < wan.sims.size(); ++i)
+      {
+        const MockRouter_SIM &sim = wan.sims[i];
+        std::string simKey = std::to_string(i + 1);
+        simOrder += (i ? "," : "") + simKey;
+        sims += ",\"" + simKey + "\":{\"simCardDetected\":" + (sim.detected ? "true" : "false") + ",\"apn\":\"internet\"";
+        if (sim.detected)
+          sims += std::string(",\"active\":") + (sim.active ? "true" : "false") + ",\"iccid\":" + quoted(sim.iccid);
+        sims += "}";
+      }
+      out += ",\"sim\":{\"order\":[" + simOrder + "]" + sims + "}}";
+    }
+    else if (wan.type == "wifi")
+    {
+      out += ",\"signal\":{\"strength\":" + std::to_string(wan.strength) + ",\"quality\":80},\"ssid\":" + quoted(wan.ssid) +
+             ",\"bssid\":" + quoted(wan.bssid) + ",\"channel\":36";
+    }
+
+    if (_padding)
+    {
+      // Per-interface counters the fob never reads, which the filter has to skip over
+      out += ",\"counters\":[";
+      size_t start = out.size();
+      for (unsigned i = 0; out.size() - start < _padding; ++i)
+        out += std::string(i ? "," : "") + "{\"name\":\"counter" + std::to_string(i) + "\",\"value\":" +
+               std::to_string(i * 7919UL) + ",\"text\":\"unused unused unused\"}";
+      out += "]";
+    }
+    wans += ",\"" + key + "\":" + out + "}";
+  }
+
+  std::string body = "{\"stat\":\"ok\",\"response\":{\"order\":[" + order + "]" + wans + "}}";
+  _lastWanStatusSize = body.size();
+  return body;
+}
+
+std::string MockRouter::_traffic()
+{
+  std::string order;
+  std::string wans;
+  for (const MockRouter_WAN &wan : _wans)
+  {
+    std::string key = std::to_string(wan.id);
+    order += (order.size() ? "," : "") + key;
+    wans += ",\"" + key + "\":{\"name\":" + quoted(wan.name) + ",\"overall\":{\"download\":" + std::to_string(wan.download) +
+            ",\"upload\":" + std::to_string(wan.upload) + "},\"tcp\":{\"download\":1,\"upload\":1}}";
+  }
+  return "{\"stat\":\"ok\",\"response\":{\"bandwidth\":{\"order\":[" + order + "],\"unit\":\"kbps\"" + wans + "}}}";
+}
+
+std::string MockRouter::_systemInfo()
+{
+  return "{\"stat\":\"ok\",\"response\":{\"device\":{\"name\":\"Mock Router\",\"serialNumber\":\"1111-2222-3333\","
+         "\"firmwareVersion\":\"8.4.0 build 1234\",\"productCode\":\"MAX-BR1-MINI\",\"hardwareRevision\":\"2\","
+         "\"model\":\"MAX BR1 Mini\"},\"uptime\":{\"second\":3600,\"string\":\"1 hour\"}}}";
+}
+
+std::string MockRouter::_location()
+{
+  return "{\"stat\":\"ok\",\"response\":{\"gps\":true,\"location\":{\"latitude\":30.25,\"longitude\":-97.75,"
+         "\"altitude\":150.5,\"speed\":0,\"heading\":0}}}";
+}
+
+void MockRouter::setCredentials(const std::string &username, const std::string &password)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _username = username;
+  _password = password;
+}
+
+void MockRouter::setWans(const std::vector<MockRouter_WAN> &wans)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _wans = wans;
+}
+
+void MockRouter::setPadding(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _padding = bytes;
+}
+
+void MockRouter::setLatency(uint32_t ms)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _latencyMs = ms;
+}
+
+void MockRouter::setChunked(bool chunked)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _chunked = chunked;
+}
+
+void MockRouter::expireCookie()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cookie.clear();
+}
+
+void MockRouter::expireToken()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tokens.clear();
+}
+
+void MockRouter::forgetClients()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _clients.clear();
+}
+
+void MockRouter::dropNext(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _dropPath = path;
+}
+
+unsigned MockRouter::connections()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _connections;
+}
+
+unsigned MockRouter::requests(const std::string &path)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _requests.find(path);
+  return it == _requests.end() ? 0 : it->second;
+}
+
+unsigned MockRouter::reboots()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _reboots;
+}
+
+size_t MockRouter::clientCount()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _clients.size();
+}
+
+std::string MockRouter::cookie()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cookie;
+}
+
+size_t MockRouter::lastWanStatusSize()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _lastWanStatusSize;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file  mock_router.h
+ * @brief Peplink router API served on loopback, so PeplinkRouter can be tested without a router.
+ * Answers /api/login, auth.client, auth.token.grant, status.wan.connection, status.traffic, status.system.info,
+ * info.location and cmd.system.reboot the way the router does, on kept-alive HTTP/1.1 connections that
+ * take pipelined requests. Latency, authentication failures, dropped connections and payload size are scripted by the test
+ */
+
+#ifndef _STARLINKFOB_TEST_MOCK_ROUTER_H_
+#define _STARLINKFOB_TEST_MOCK_ROUTER_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief SIM slot of a cellular WAN
+struct MockRouter_SIM
+{
+    bool detected;
+    bool active;
+    std::string iccid;
+};
+
+/// @brief WAN as reported by status.wan.connection and status.traffic. The type selects which type-specific fields are sent
+struct MockRouter_WAN
+{
+    int id;
+    std::string name;
+    std::string type;           // "ethernet", "cellular" or "wifi"
+    std::string message = "Connected";
+    std::string statusLed = "green";
+    int priority = 0;           // 0 leaves the field out, as the router does for WANs with no priority
+    bool managementOnly = false;
+    std::string ip;
+
+    std::string carrier;
+    int signalLevel = 0;
+    std::string network;
+    std::vector<MockRouter_SIM> sims;
+
+    int strength = 0;
+    std::string ssid;
+    std::string bssid;
+
+    long download = 0;
+    long upload = 0;
+};
+
+class MockRouter
+{
+public:
+    MockRouter();
+    ~MockRouter();
+
+    /// @brief Listen on an ephemeral loopback port
+    /// @return false if the socket couldn't be opened
+    bool start();
+    /// @brief Close the listening socket and every connection, and wait for their threads
+    void stop();
+    uint16_t port() const { return _port; }
+
+    /// @brief Set the administrator credentials /api/login accepts
+    void setCredentials(const std::string &username, const std::string &password);
+    void setWans(const std::vector<MockRouter_WAN> &wans);
+    /// @brief Add about \a bytes of fields the fob filters out to each WAN in status.wan.connection,
+    /// as a router with many WANs and detailed status sends
+    void setPadding(size_t bytes);
+    /// @brief Answer every request \a ms after it arrived, as a router a network round trip away does.
+    /// Pipelined requests that arrive together are answered together
+    void setLatency(uint32_t ms);
+    /// @brief Send response bodies with chunked transfer encoding rather than Content-Length
+    void setChunked(bool chunked);
+
+    /// @brief Forget the login cookie, so admin endpoints answer 401 "Unauthorized" until the next login
+    void expireCookie();
+    /// @brief Forget every access token, so status endpoints answer 401 "Invalid access token" until a new one is granted
+    void expireToken();
+    /// @brief Forget every client, so granting a token to a client created earlier fails
+    void forgetClients();
+    /// @brief Act on the next request to \a path, then close its connection without answering
+    void dropNext(const std::string &path);
+
+    /// @brief Return the number of TCP connections accepted
+    unsigned connections();
+    /// @brief Return the number of requests received for \a path, e.g. "/api/login"
+    unsigned requests(const std::string &path);
+    /// @brief Return the number of reboots asked for
+    unsigned reboots();
+    /// @brief Return the number of clients the router knows
+    size_t clientCount();
+    /// @brief Return the cookie issued at the last login
+    std::string cookie();
+    /// @brief Return the length of the last status.wan.connection body sent
+    size_t lastWanStatusSize();
+
+private:
+    struct Client
+    {
+        std::string name;
+        std::string id;
+        std::string secret;
+        std::string scope;
+    };
+
+    struct Request
+    {
+        std::string method;
+        std::string path;
+        std::map<std::string, std::string> query;
+        std::string cookie;
+        std::string body;
+        bool keepAlive;
+    };
+
+    void _accept();
+    void _serve(int fd);
+    /// @brief Answer one request
+    /// @return Response body
+    std::string _handle(const Request &request, std::string &extraHeaders);
+
+    std::string _login(const Request &request, std::string &extraHeaders);
+    std::string _authClient(const Request &request);
+    std::string _tokenGrant(const Request &request);
+    std::string _wanStatus(const Request &request);
+    std::string _traffic();
+    std::string _systemInfo();
+    std::string _location();
+
+    bool _cookieValid(const Request &request) const;
+    bool _tokenValid(const Request &request) const;
+
+    std::mutex _mutex;
+    int _listenFd = -1;
+    uint16_t _port = 0;
+    std::thread _acceptThread;
+    std::vector<std::thread> _threads;
+    std::vector<int> _fds;
+    bool _stopping = false;
+
+    std::string _username = "admin";
+    std::string _password = "admin";
+    std::string _cookie;
+    std::vector<std::string> _tokens;
+    std::vector<Client> _clients;
+    std::vector<MockRouter_WAN> _wans;
+    size_t _padding = 0;
+    uint32_t _latencyMs = 0;
+    bool _chunked = false;
+    std::string _dropPath;
+
+    unsigned _issued = 0;
+    unsigned _connections = 0;
+    unsigned _reboots = 0;
+    std::map<std::string, unsigned> _requests;
+    size_t _lastWanStatusSize = 0;
+};
+
+#endif
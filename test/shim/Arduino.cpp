@@ -0,0 +1,243 @@
+#include <stdarg.h>
+#include <ctype.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <Arduino.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static uint64_t nowUs()
+{
+  static struct timespec start;
+  static bool started = false;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  if (!started)
+  {
+    start = ts;
+    started = true;
+  }
+  return (uint64_t)(ts.tv_sec - start.tv_sec) * 1000000 + (ts.tv_nsec - start.tv_nsec) / 1000;
+}
+
+uint32_t millis()
+{
+  return (uint32_t)(nowUs() / 1000);
+}
+
+uint32_t micros()
+{
+  return (uint32_t)nowUs();
+}
+
+void delay(uint32_t ms)
+{
+  usleep((useconds_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  usleep(us);
+}
+
+String::String(long value, unsigned char base)
+{
+  if (value < 0)
+  {
+    _s = "-";
+    _s += String((unsigned long)-value, base)._s;
+  }
+  else
+    _s = String((unsigned long)value, base)._s;
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+  char buffer[8 * sizeof(unsigned long) + 1];
+  char *p = buffer + sizeof(buffer) - 1;
+  *p = '\0';
+  if (base < 2)
+    base = 10;
+  do
+  {
+    unsigned digit = value % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value);
+  _s = p;
+}
+
+String::String(double value, unsigned int decimals)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+  _s = buffer;
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+  if (from > to)
+    std::swap(from, to);
+  if (from >= _s.length())
+    return String();
+  if (to > _s.length())
+    to = _s.length();
+  String s;
+  s._s = _s.substr(from, to - from);
+  return s;
+}
+
+void String::trim()
+{
+  size_t start = 0, end = _s.length();
+  while (start < end && isspace((unsigned char)_s[start]))
+    start++;
+  while (end > start && isspace((unsigned char)_s[end - 1]))
+    end--;
+  _s = _s.substr(start, end - start);
+}
+
+void String::toLowerCase()
+{
+  for (char &c : _s)
+    c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+  for (char &c : _s)
+    c = toupper((unsigned char)c);
+}
+
+void String::replace(const String &from, const String &to)
+{
+  if (!from.length())
+    return;
+  size_t pos = 0;
+  while ((pos = _s.find(from._s, pos)) != std::string::npos)
+  {
+    _s.replace(pos, from._s.length(), to._s);
+    pos += to._s.length();
+  }
+}
+
+bool IPAddress::fromString(const String &address)
+{
+  return fromString(address.c_str());
+}
+
+String IPAddress::toString() const
+{
+  char buffer[INET_ADDRSTRLEN];
+  inet_ntop(AF_INET, &_addr, buffer, sizeof(buffer));
+  return String(buffer);
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t written = 0;
+  while (size-- && write(*buffer++))
+    written++;
+  return written;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char small[128];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0)
+    return 0;
+  if ((size_t)len < sizeof(small))
+    return write((const uint8_t *)small, len);
+
+  std::string large(len + 1, '\0');
+  va_start(args, format);
+  vsnprintf(&large[0], large.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)large.data(), len);
+}
+
+int Stream::timedRead()
+{
+  uint32_t start = millis();
+  do
+  {
+    int c = read();
+    if (c >= 0)
+      return c;
+    // Let the other end run rather than spin, the host may have a single core
+    delayMicroseconds(50);
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+int Stream::timedPeek()
+{
+  uint32_t start = millis();
+  do
+  {
+    int c = peek();
+    if (c >= 0)
+      return c;
+    delayMicroseconds(50);
+  } while (millis() - start < _timeout);
+  return -1;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+  size_t count = 0;
+  while (count < length)
+  {
+    int c = timedRead();
+    if (c < 0)
+      break;
+    buffer[count++] = (char)c;
+  }
+  return count;
+}
+
+String Stream::readString()
+{
+  String s;
+  int c;
+  while ((c = timedRead()) >= 0)
+    s += (char)c;
+  return s;
+}
+
+String Stream::readStringUntil(char terminator)
+{
+  String s;
+  int c;
+  while ((c = timedRead()) >= 0 && c != terminator)
+    s += (char)c;
+  return s;
+}
+
+static bool serialEnabled()
+{
+  static int enabled = -1;
+  if (enabled < 0)
+    enabled = getenv("SERIAL_LOG") != NULL;
+  return enabled;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  if (serialEnabled())
+    fputc(c, stderr);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  if (serialEnabled())
+    fwrite(buffer, 1, size, stderr);
+  return size;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file  Arduino.h
+ * @brief Stand-in for the ESP32 Arduino core when building sketch modules on a host.
+ * Only what the host-built modules and ArduinoJson's Arduino support use is provided
+ */
+
+#ifndef _STARLINKFOB_TEST_ARDUINO_H_
+#define _STARLINKFOB_TEST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+using std::max;
+using std::min;
+
+#define DEC 10
+#define HEX 16
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+/// @brief BSD strlcpy, which the ESP32 toolchain's newlib has and older glibc doesn't
+inline size_t strlcpy(char *dst, const char *src, size_t size)
+{
+  size_t len = strlen(src);
+  if (size)
+  {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+/// @brief Flash strings are ordinary strings on a host
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+/// @brief Arduino String, backed by std::string
+class String
+{
+public:
+    String() {}
+    String(const char *s) { if (s) _s = s; }
+    String(const String &s) = default;
+    String(String &&s) = default;
+    String(const __FlashStringHelper *s) : String(reinterpret_cast<const char *>(s)) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10) : String((unsigned long)value, base) {}
+    explicit String(int value, unsigned char base = 10) : String((long)value, base) {}
+    explicit String(unsigned int value, unsigned char base = 10) : String((unsigned long)value, base) {}
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10) : String((long)value, base) {}
+    explicit String(unsigned long long value, unsigned char base = 10) : String((unsigned long)value, base) {}
+    explicit String(float value, unsigned int decimals = 2) : String((double)value, decimals) {}
+    explicit String(double value, unsigned int decimals = 2);
+
+    String &operator=(const String &s) = default;
+    String &operator=(String &&s) = default;
+    /// @brief Assigning NULL empties the string, as ArduinoJson does before serialising into one
+    String &operator=(const char *s) { if (s) _s = s; else _s.clear(); return *this; }
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned int length() const { return _s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    void reserve(unsigned int size) { _s.reserve(size); }
+
+    bool concat(const String &s) { _s += s._s; return true; }
+    bool concat(const char *s) { if (!s) return false; _s += s; return true; }
+    bool concat(const char *s, unsigned int len) { if (!s) return false; _s.append(s, len); return true; }
+    bool concat(char c) { _s += c; return true; }
+    bool concat(int value) { return concat(String(value)); }
+    bool concat(unsigned int value) { return concat(String(value)); }
+    bool concat(long value) { return concat(String(value)); }
+    bool concat(unsigned long value) { return concat(String(value)); }
+    bool concat(double value) { return concat(String(value)); }
+
+    template <typename T>
+    String &operator+=(const T &value) { concat(value); return *this; }
+
+    bool equals(const String &s) const { return _s == s._s; }
+    bool equals(const char *s) const { return _s == (s ? s : ""); }
+    bool equalsIgnoreCase(const String &s) const { return strcasecmp(c_str(), s.c_str()) == 0; }
+    bool operator==(const String &s) const { return equals(s); }
+    bool operator==(const char *s) const { return equals(s); }
+    bool operator!=(const String &s) const { return !equals(s); }
+    bool operator!=(const char *s) const { return !equals(s); }
+    bool operator<(const String &s) const { return _s < s._s; }
+
+    char charAt(unsigned int index) const { return index < _s.length() ? _s[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char &operator[](unsigned int index) { return _s[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const { return _find(_s.find(c, from)); }
+    int indexOf(const char *s, unsigned int from = 0) const { return _find(_s.find(s, from)); }
+    int indexOf(const String &s, unsigned int from = 0) const { return _find(_s.find(s._s, from)); }
+    int lastIndexOf(char c) const { return _find(_s.rfind(c)); }
+    bool startsWith(const String &s) const { return _s.compare(0, s._s.length(), s._s) == 0; }
+    bool endsWith(const String &s) const
+    {
+        return _s.length() >= s._s.length() && _s.compare(_s.length() - s._s.length(), s._s.length(), s._s) == 0;
+    }
+
+    String substring(unsigned int from) const { return substring(from, _s.length()); }
+    String substring(unsigned int from, unsigned int to) const;
+
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return atof(c_str()); }
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    void replace(const String &from, const String &to);
+
+private:
+    static int _find(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+    std::string _s;
+};
+
+inline String operator+(const String &lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, const char *rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const char *lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, char rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, int rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, unsigned int rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, long rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, unsigned long rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, double rhs) { String s(lhs); s.concat(rhs); return s; }
+
+/// @brief Byte sink with Arduino's print helpers
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    virtual void flush() {}
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned int value, int base = DEC) { return print(String(value, base)); }
+    size_t print(long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(double value, int digits = 2) { return print(String(value, digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &value) { return print(value) + println(); }
+    template <typename T>
+    size_t println(const T &value, int format) { return print(value, format) + println(); }
+
+    /// @note  Not marked as printf-like, since the sketch's formats are written for the ESP32's 32-bit long
+    size_t printf(const char *format, ...);
+};
+
+/// @brief Byte source with Arduino's timed read helpers
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeoutMs) { _timeout = timeoutMs; }
+    unsigned long getTimeout() const { return _timeout; }
+
+    size_t readBytes(char *buffer, size_t length);
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+    String readString();
+    String readStringUntil(char terminator);
+
+protected:
+    /// @brief Read a byte, waiting up to the timeout for one to arrive
+    int timedRead();
+    int timedPeek();
+
+    unsigned long _timeout = 1000;
+};
+
+/// @brief Serial port. Silent unless SERIAL_LOG is set in the environment, when it writes to stderr
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long baud) {}
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+/// @brief ESP32 chip helpers
+class EspClass
+{
+public:
+    /// @brief There is no fixed heap on a host, so this reports nothing
+    uint32_t getFreeHeap() { return 0; }
+    void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+#include "IPAddress.h"
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * @file  ESP32Ping.h
+ * @brief Stand-in for the ESP32Ping library. Whether the router answers is set by the test
+ */
+
+#ifndef _STARLINKFOB_TEST_ESP32PING_H_
+#define _STARLINKFOB_TEST_ESP32PING_H_
+
+#include <Arduino.h>
+
+class PingClass
+{
+public:
+    bool ping(IPAddress dest, byte count = 5) { return reachable; }
+    bool ping(const char *host, byte count = 5) { return reachable; }
+
+    /// @brief Answer to every ping
+    bool reachable = true;
+};
+
+extern PingClass Ping;
+
+#endif
@@ -0,0 +1,208 @@
+#include <HTTPClient.h>
+
+bool HTTPClient::begin(WiFiClient &client, String host, uint16_t port, String uri, bool https)
+{
+  _client = &client;
+  _host = host;
+  _port = port;
+  _uri = uri;
+  _requestHeaders = String();
+  _size = -1;
+  _chunked = false;
+  for (Header &header : _collected)
+    header.value = String();
+  return true;
+}
+
+void HTTPClient::end()
+{
+  if (_client && (_client->connected() || _client->available() > 0))
+  {
+    // Whatever the caller left unread would be taken for the start of the next response
+    _client->flush();
+    if (!_reuse || !_canReuse)
+      _client->stop();
+  }
+  _requestHeaders = String();
+  _size = -1;
+}
+
+void HTTPClient::collectHeaders(const char *headerKeys[], const size_t headerKeysCount)
+{
+  _collected.clear();
+  for (size_t i = 0; i < headerKeysCount; ++i)
+    _collected.push_back({String(headerKeys[i]), String()});
+}
+
+int HTTPClient::sendRequest(const char *type, uint8_t *payload, size_t size)
+{
+  if (!_client)
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  if (_client->connected())
+  {
+    // Kept alive from the previous request
+    while (_client->available() > 0)
+      _client->read();
+  }
+  else
+  {
+    if (!_client->connect(_host.c_str(), _port))
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    _client->setTimeout((_tcpTimeout + 500) / 1000);
+  }
+
+  if (payload && size > 0)
+    addHeader("Content-Length", String(size));
+
+  String header = String(type) + " " + _uri + " HTTP/1.1\r\n";
+  header += "Host: " + _host + (_port != 80 ? ":" + String(_port) : String()) + "\r\n";
+  header += "User-Agent: ESP32HTTPClient\r\n";
+  header += String("Connection: ") + (_reuse ? "keep-alive" : "close") + "\r\n";
+  header += "Accept-Encoding: identity;q=1,chunked;q=0.1,*;q=0\r\n";
+  header += _requestHeaders;
+  header += "\r\n";
+
+  if (_client->write((const uint8_t *)header.c_str(), header.length()) != header.length())
+    return HTTPC_ERROR_SEND_HEADER_FAILED;
+  if (payload && size > 0 && _client->write(payload, size) != size)
+    return HTTPC_ERROR_SEND_PAYLOAD_FAILED;
+
+  return _handleHeaderResponse();
+}
+
+int HTTPClient::_handleHeaderResponse()
+{
+  if (!_client->connected() && _client->available() <= 0)
+    return HTTPC_ERROR_NOT_CONNECTED;
+
+  _canReuse = _reuse;
+  _size = -1;
+  _chunked = false;
+  int code = 0;
+  uint32_t lastDataTime = millis();
+  while (_client->connected() || _client->available() > 0)
+  {
+    if (_client->available() <= 0)
+    {
+      if (millis() - lastDataTime > _tcpTimeout)
+        return HTTPC_ERROR_READ_TIMEOUT;
+      delay(1);
+      continue;
+    }
+
+    String line = _client->readStringUntil('\n');
+    line.trim();
+    lastDataTime = millis();
+
+    if (line.startsWith("HTTP/1."))
+    {
+      if (_canReuse)
+        _canReuse = line[7] != '0';
+      code = line.substring(9, line.indexOf(' ', 9)).toInt();
+      continue;
+    }
+    if (!line.length())
+      return code ? code : HTTPC_ERROR_NO_HTTP_SERVER;
+
+    int colon = line.indexOf(':');
+    if (colon <= 0)
+      continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+    if (name.equalsIgnoreCase("Content-Length"))
+      _size = value.toInt();
+    else if (name.equalsIgnoreCase("Connection") && value.indexOf("close") >= 0 && value.indexOf("keep-alive") < 0)
+      _canReuse = false;
+    else if (name.equalsIgnoreCase("Transfer-Encoding"))
+      _chunked = value.equalsIgnoreCase("chunked");
+    for (Header &header : _collected)
+      if (header.key.equalsIgnoreCase(name))
+        header.value = value;
+  }
+  return HTTPC_ERROR_CONNECTION_LOST;
+}
+
+String HTTPClient::header(const char *name)
+{
+  for (Header &header : _collected)
+    if (header.key.equalsIgnoreCase(name))
+      return header.value;
+  return String();
+}
+
+bool HTTPClient::hasHeader(const char *name)
+{
+  for (Header &header : _collected)
+    if (header.key.equalsIgnoreCase(name) && header.value.length())
+      return true;
+  return false;
+}
+
+String HTTPClient::getString()
+{
+  String body;
+  if (!_client || _size == 0)
+    return body;
+
+  if (!_chunked)
+  {
+    if (_size > 0)
+      body.reserve(_size);
+    char c;
+    while ((_size < 0 || (int)body.length() < _size) && _client->readBytes(&c, 1) == 1)
+      body += c;
+    return body;
+  }
+
+  for (;;)
+  {
+    long chunkSize = strtol(_client->readStringUntil('\n').c_str(), NULL, 16);
+    if (chunkSize <= 0)
+      break;
+    for (long i = 0; i < chunkSize; ++i)
+    {
+      char c;
+      if (_client->readBytes(&c, 1) != 1)
+        return body;
+      body += c;
+    }
+    _client->readStringUntil('\n');
+  }
+  // Trailer headers, up to the blank line ending the message
+  while (_client->readStringUntil('\n').length() > 1)
+    ;
+  return body;
+}
+
+String HTTPClient::errorToString(int error)
+{
+  switch (error)
+  {
+  case HTTPC_ERROR_CONNECTION_REFUSED:
+    return "connection refused";
+  case HTTPC_ERROR_SEND_HEADER_FAILED:
+    return "send header failed";
+  case HTTPC_ERROR_SEND_PAYLOAD_FAILED:
+    return "send payload failed";
+  case HTTPC_ERROR_NOT_CONNECTED:
+    return "not connected";
+  case HTTPC_ERROR_CONNECTION_LOST:
+    return "connection lost";
+  case HTTPC_ERROR_NO_STREAM:
+    return "no stream";
+  case HTTPC_ERROR_NO_HTTP_SERVER:
+    return "no HTTP server";
+  case HTTPC_ERROR_TOO_LESS_RAM:
+    return "too less ram";
+  case HTTPC_ERROR_ENCODING:
+    return "Transfer-Encoding not supported";
+  case HTTPC_ERROR_STREAM_WRITE:
+    return "Stream write error";
+  case HTTPC_ERROR_READ_TIMEOUT:
+    return "read Timeout";
+  default:
+    return String();
+  }
+}
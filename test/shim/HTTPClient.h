@@ -0,0 +1,83 @@
+/**
+ * @file  HTTPClient.h
+ * @brief Stand-in for the ESP32 HTTPClient, keeping its keep-alive behaviour and error codes:
+ * a request whose socket can't be opened fails with HTTPC_ERROR_CONNECTION_REFUSED, one whose headers can't be
+ * written with HTTPC_ERROR_SEND_HEADER_FAILED, and one whose connection closes before the response with
+ * HTTPC_ERROR_NOT_CONNECTED or HTTPC_ERROR_CONNECTION_LOST
+ */
+
+#ifndef _STARLINKFOB_TEST_HTTPCLIENT_H_
+#define _STARLINKFOB_TEST_HTTPCLIENT_H_
+
+#include <vector>
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED  (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED  (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED       (-4)
+#define HTTPC_ERROR_CONNECTION_LOST     (-5)
+#define HTTPC_ERROR_NO_STREAM           (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER      (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM        (-8)
+#define HTTPC_ERROR_ENCODING            (-9)
+#define HTTPC_ERROR_STREAM_WRITE        (-10)
+#define HTTPC_ERROR_READ_TIMEOUT        (-11)
+
+#define HTTPCLIENT_DEFAULT_TCP_TIMEOUT  (5000)
+
+class HTTPClient
+{
+public:
+    bool begin(WiFiClient &client, String host, uint16_t port, String uri = "/", bool https = false);
+    /// @brief Close the connection unless the server agreed to keep it alive and reuse is on
+    void end();
+
+    void setReuse(bool reuse) { _reuse = reuse; }
+    void setTimeout(uint16_t timeoutMs) { _tcpTimeout = timeoutMs; }
+    void addHeader(const String &name, const String &value) { _requestHeaders += name + ": " + value + "\r\n"; }
+    /// @brief Set the response headers kept for header() and hasHeader()
+    void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+
+    int GET() { return sendRequest("GET"); }
+    int POST(uint8_t *payload, size_t size) { return sendRequest("POST", payload, size); }
+    int POST(const String &payload) { return POST((uint8_t *)payload.c_str(), payload.length()); }
+    int sendRequest(const char *type, uint8_t *payload = NULL, size_t size = 0);
+
+    String header(const char *name);
+    bool hasHeader(const char *name);
+    int headers() { return _collected.size(); }
+
+    /// @brief Return the Content-Length of the response, or -1 if it didn't give one
+    int getSize() { return _size; }
+    WiFiClient &getStream() { return *_client; }
+    /// @brief Read the whole response body, decoding chunked transfer encoding
+    String getString();
+
+    static String errorToString(int error);
+
+private:
+    int _handleHeaderResponse();
+
+    struct Header
+    {
+        String key;
+        String value;
+    };
+
+    WiFiClient *_client = NULL;
+    String _host;
+    uint16_t _port = 80;
+    String _uri;
+    String _requestHeaders;
+    std::vector<Header> _collected;
+    bool _reuse = true;
+    bool _canReuse = false;
+    bool _chunked = false;
+    int _size = -1;
+    uint16_t _tcpTimeout = HTTPCLIENT_DEFAULT_TCP_TIMEOUT;
+};
+
+#endif
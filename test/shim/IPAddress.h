@@ -0,0 +1,39 @@
+/**
+ * @file  IPAddress.h
+ * @brief Stand-in for the Arduino IPv4 address class
+ */
+
+#ifndef _STARLINKFOB_TEST_IPADDRESS_H_
+#define _STARLINKFOB_TEST_IPADDRESS_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+class String;
+
+/// @brief IPv4 address, held in network byte order as lwIP does
+class IPAddress
+{
+public:
+    IPAddress() : _addr(0) {}
+    IPAddress(uint32_t addr) : _addr(addr) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    {
+        uint8_t bytes[4] = {a, b, c, d};
+        memcpy(&_addr, bytes, sizeof(_addr));
+    }
+
+    operator uint32_t() const { return _addr; }
+    bool operator==(const IPAddress &other) const { return _addr == other._addr; }
+    uint8_t operator[](int index) const { return ((const uint8_t *)&_addr)[index]; }
+
+    bool fromString(const char *address) { return address && inet_pton(AF_INET, address, &_addr) == 1; }
+    bool fromString(const String &address);
+    String toString() const;
+
+private:
+    uint32_t _addr;
+};
+
+#endif
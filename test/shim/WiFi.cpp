@@ -0,0 +1,166 @@
+#include <errno.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <WiFi.h>
+
+WiFiClass WiFi;
+
+int WiFiClient::connect(IPAddress ip, uint16_t port)
+{
+  stop();
+  _fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (_fd < 0)
+    return 0;
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = (uint32_t)ip;
+  if (::connect(_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+  {
+    stop();
+    return 0;
+  }
+
+  // lwIP sends small segments straight away too
+  int one = 1;
+  setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return 1;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip))
+    return 0;
+  return connect(ip, port);
+}
+
+void WiFiClient::stop()
+{
+  if (_fd >= 0)
+    close(_fd);
+  _fd = -1;
+  _eof = false;
+  _start = _end = 0;
+}
+
+uint8_t WiFiClient::connected()
+{
+  if (_fd < 0)
+    return 0;
+  if (_start < _end)
+    return 1;
+  return _fill() || _start < _end;
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+  if (_fd < 0)
+    return 0;
+  size_t sent = 0;
+  while (sent < size)
+  {
+    ssize_t n = send(_fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    sent += n;
+  }
+  return sent;
+}
+
+bool WiFiClient::_fill()
+{
+  if (_fd < 0 || _eof)
+    return false;
+  if (_start == _end)
+    _start = _end = 0;
+  if (_end == sizeof(_buffer))
+    return true;
+
+  ssize_t n = recv(_fd, _buffer + _end, sizeof(_buffer) - _end, MSG_DONTWAIT);
+  if (n > 0)
+  {
+    _end += n;
+    return true;
+  }
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+    return true;
+  // Closed by the peer, or reset
+  _eof = true;
+  return false;
+}
+
+int WiFiClient::available()
+{
+  _fill();
+  return _end - _start;
+}
+
+int WiFiClient::read()
+{
+  if (_start == _end)
+    _fill();
+  if (_start == _end)
+    return -1;
+  return _buffer[_start++];
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+  if (_start == _end)
+    _fill();
+  size_t n = std::min(size, _end - _start);
+  if (!n)
+    return -1;
+  memcpy(buffer, _buffer + _start, n);
+  _start += n;
+  return n;
+}
+
+int WiFiClient::peek()
+{
+  if (_start == _end)
+    _fill();
+  if (_start == _end)
+    return -1;
+  return _buffer[_start];
+}
+
+void WiFiClient::flush()
+{
+  while (available() > 0)
+    _start = _end;
+}
+
+int WiFiClient::setTimeout(uint32_t seconds)
+{
+  Stream::setTimeout(seconds * 1000);
+  if (_fd < 0)
+    return 0;
+  struct timeval timeout = {(time_t)seconds, 0};
+  setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  return setsockopt(_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+int WiFiClass::hostByName(const char *host, IPAddress &ip)
+{
+  ++lookups;
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result = NULL;
+  if (getaddrinfo(host, NULL, &hints, &result) || !result)
+    return 0;
+  ip = IPAddress(((struct sockaddr_in *)result->ai_addr)->sin_addr.s_addr);
+  freeaddrinfo(result);
+  return 1;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file  WiFi.h
+ * @brief Stand-in for the ESP32 WiFi library: a TCP client on BSD sockets, and a station that is always connected
+ */
+
+#ifndef _STARLINKFOB_TEST_WIFI_H_
+#define _STARLINKFOB_TEST_WIFI_H_
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+/// @brief TCP client. Reads never block, as on the ESP32; Stream's timed reads wait for data
+class WiFiClient : public Stream
+{
+public:
+    WiFiClient() {}
+    ~WiFiClient() { stop(); }
+    WiFiClient(const WiFiClient &) = delete;
+    WiFiClient &operator=(const WiFiClient &) = delete;
+
+    /// @return 1 if connected
+    virtual int connect(IPAddress ip, uint16_t port);
+    virtual int connect(const char *host, uint16_t port);
+    virtual void stop();
+
+    /// @brief Whether the socket is open, or closed by the peer with data still unread
+    uint8_t connected();
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+
+    int available() override;
+    int read() override;
+    int read(uint8_t *buffer, size_t size);
+    int peek() override;
+    /// @brief Discard any data received but not read
+    void flush() override;
+
+    /// @brief Set the Stream timeout and the socket send and receive timeouts, in seconds
+    int setTimeout(uint32_t seconds);
+
+    int fd() const { return _fd; }
+
+private:
+    /// @brief Receive whatever is waiting on the socket into the buffer without blocking
+    /// @return false if the peer has closed the connection or it failed
+    bool _fill();
+
+    int _fd = -1;
+    bool _eof = false;
+    uint8_t _buffer[1436];
+    size_t _start = 0;
+    size_t _end = 0;
+};
+
+/// @brief WiFi station. Host name lookups go through the host's resolver
+class WiFiClass
+{
+public:
+    wl_status_t status() { return WL_CONNECTED; }
+    int hostByName(const char *host, IPAddress &ip);
+
+    unsigned lookups = 0;    // Calls to hostByName(), cached or not by the host
+};
+
+extern WiFiClass WiFi;
+
+#endif
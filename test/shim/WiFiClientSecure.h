@@ -0,0 +1,25 @@
+/**
+ * @file  WiFiClientSecure.h
+ * @brief Stand-in for the ESP32 TLS client. The host build talks plain HTTP to the mock router,
+ * so this only exists for PEPLINK_USE_HTTPS builds to compile
+ */
+
+#ifndef _STARLINKFOB_TEST_WIFICLIENTSECURE_H_
+#define _STARLINKFOB_TEST_WIFICLIENTSECURE_H_
+
+#include <WiFi.h>
+
+class WiFiClientSecure : public WiFiClient
+{
+public:
+    void setCACert(const char *rootCA) {}
+    void setInsecure() {}
+
+    using WiFiClient::connect;
+    int connect(IPAddress ip, uint16_t port, const char *host, const char *rootCA, const char *cert, const char *key)
+    {
+        return WiFiClient::connect(ip, port);
+    }
+};
+
+#endif
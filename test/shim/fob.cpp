@@ -0,0 +1,35 @@
+#include "utils.h"
+
+StarlinkFob_GlobalState_t fob;
+HostStoredCredentials storedCredentials;
+std::vector<EventLog_Record> loggedEvents;
+PingClass Ping;
+
+void storeRouterCookie(const String &cookie)
+{
+  storedCredentials.cookie = cookie;
+}
+
+void storeRouterToken(const String &token, uint32_t validForS)
+{
+  storedCredentials.token = token;
+  storedCredentials.tokenValidForS = validForS;
+}
+
+void storeRouterClient(const String &id, const String &secret)
+{
+  storedCredentials.clientId = id;
+  storedCredentials.clientSecret = secret;
+}
+
+bool logEvent(EventLog_Type_t type, int32_t value, uint8_t subject, uint8_t detail)
+{
+  EventLog_Record record = {};
+  record.seq = loggedEvents.size() + 1;
+  record.type = type;
+  record.subject = subject;
+  record.detail = detail;
+  record.value = value;
+  loggedEvents.push_back(record);
+  return true;
+}
@@ -0,0 +1,173 @@
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/// @brief Counting semaphore. Mutexes count to 1, and recursive ones also track their holder and depth
+struct HostSemaphore
+{
+  std::mutex mutex;
+  std::condition_variable changed;
+  UBaseType_t count;
+  UBaseType_t maxCount;
+  bool recursive;
+  std::thread::id holder;
+  UBaseType_t depth;
+};
+
+/// @brief Wait on \a cv until \a ready, for at most \a ticks
+template <typename Predicate>
+static bool waitFor(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, TickType_t ticks, Predicate ready)
+{
+  if (ticks == portMAX_DELAY)
+  {
+    cv.wait(lock, ready);
+    return true;
+  }
+  return cv.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+static SemaphoreHandle_t createSemaphore(UBaseType_t maxCount, UBaseType_t initialCount, bool recursive)
+{
+  SemaphoreHandle_t semaphore = new HostSemaphore;
+  semaphore->count = initialCount;
+  semaphore->maxCount = maxCount;
+  semaphore->recursive = recursive;
+  semaphore->depth = 0;
+  return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+  return createSemaphore(1, 1, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+  return createSemaphore(1, 1, true);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return createSemaphore(1, 0, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+{
+  return createSemaphore(maxCount, initialCount, false);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+  delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait)
+{
+  std::unique_lock<std::mutex> lock(semaphore->mutex);
+  if (!waitFor(semaphore->changed, lock, ticksToWait, [&] { return semaphore->count > 0; }))
+    return pdFALSE;
+  semaphore->count--;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+  std::lock_guard<std::mutex> lock(semaphore->mutex);
+  if (semaphore->count >= semaphore->maxCount)
+    return pdFALSE;
+  semaphore->count++;
+  semaphore->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t mutex, TickType_t ticksToWait)
+{
+  std::unique_lock<std::mutex> lock(mutex->mutex);
+  std::thread::id self = std::this_thread::get_id();
+  if (mutex->depth && mutex->holder == self)
+  {
+    mutex->depth++;
+    return pdTRUE;
+  }
+  if (!waitFor(mutex->changed, lock, ticksToWait, [&] { return mutex->depth == 0; }))
+    return pdFALSE;
+  mutex->holder = self;
+  mutex->depth = 1;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t mutex)
+{
+  std::lock_guard<std::mutex> lock(mutex->mutex);
+  if (!mutex->depth || mutex->holder != std::this_thread::get_id())
+    return pdFALSE;
+  if (--mutex->depth == 0)
+    mutex->changed.notify_all();
+  return pdTRUE;
+}
+
+/// @brief A task's notification value. The thread itself is detached, as FreeRTOS tasks are never joined
+struct HostTask
+{
+  std::mutex mutex;
+  std::condition_variable notified;
+  uint32_t value = 0;
+};
+
+static thread_local HostTask *currentTask = NULL;
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  // Threads not started through xTaskCreate(), e.g. main(), get a handle the first time they ask
+  if (!currentTask)
+    currentTask = new HostTask;
+  return currentTask;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+  HostTask *task = new HostTask;
+  if (handle)
+    *handle = task;
+  std::thread([function, arg, task] {
+    currentTask = task;
+    function(arg);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stackDepth, void *arg,
+                       UBaseType_t priority, TaskHandle_t *handle)
+{
+  return xTaskCreatePinnedToCore(function, name, stackDepth, arg, priority, handle, 0);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait)
+{
+  HostTask *task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->mutex);
+  if (!waitFor(task->notified, lock, ticksToWait, [&] { return task->value > 0; }))
+    return 0;
+  uint32_t value = task->value;
+  task->value = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  std::lock_guard<std::mutex> lock(task->mutex);
+  task->value++;
+  task->notified.notify_all();
+  return pdPASS;
+}
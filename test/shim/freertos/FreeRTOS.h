@@ -0,0 +1,25 @@
+/**
+ * @file  FreeRTOS.h
+ * @brief Stand-in for the FreeRTOS kernel types when building sketch modules on a host.
+ * Ticks are milliseconds, as on the fob
+ */
+
+#ifndef _STARLINKFOB_TEST_FREERTOS_H_
+#define _STARLINKFOB_TEST_FREERTOS_H_
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              pdTRUE
+#define pdFAIL              pdFALSE
+#define portMAX_DELAY       ((TickType_t)0xFFFFFFFF)
+#define configTICK_RATE_HZ  1000
+#define portTICK_PERIOD_MS  1
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * @file  utils.h
+ * @brief Stand-in for the sketch's utils.h, holding only the parts of the global fob state that PeplinkAPI.cpp uses.
+ * What the router code stores and logs is kept in memory for the tests to check
+ */
+
+#ifndef _STARLINKFOB_TEST_UTILS_H_
+#define _STARLINKFOB_TEST_UTILS_H_
+
+#include <vector>
+
+#include <Arduino.h>
+
+#include "PeplinkAPI.h"
+#include "EventLog.h"
+#include "config.h"
+
+typedef struct
+{
+    String username;
+    String password;
+} StarlinkFob_RouterState_t;
+
+typedef struct
+{
+    StarlinkFob_RouterState_t routers;
+} StarlinkFob_GlobalState_t;
+
+extern StarlinkFob_GlobalState_t fob;
+
+/// @brief Router credentials passed to the store functions, in place of the cookie jar
+typedef struct
+{
+    String cookie;
+    String token;
+    uint32_t tokenValidForS;
+    String clientId;
+    String clientSecret;
+} HostStoredCredentials;
+
+extern HostStoredCredentials storedCredentials;
+
+/// @brief Events passed to logEvent(), oldest first
+extern std::vector<EventLog_Record> loggedEvents;
+
+void storeRouterCookie(const String &cookie);
+void storeRouterToken(const String &token, uint32_t validForS);
+void storeRouterClient(const String &id, const String &secret);
+bool logEvent(EventLog_Type_t type, int32_t value = 0, uint8_t subject = 0, uint8_t detail = 0);
+
+#endif
@@ -0,0 +1,229 @@
+/**
+ * @file  test_eventlog.cpp
+ * @brief Runs the circular event log against a plain file
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "EventLog.h"
+#include "check.h"
+
+#define TEST_CAPACITY 10
+
+static char path[64];
+
+/// @brief Overwrite one byte of the record in \a slot, as a write cut short by a power loss would
+static void tearSlot(size_t slot)
+{
+  FILE *file = fopen(path, "r+b");
+  fseek(file, slot * sizeof(EventLog_Record) + offsetof(EventLog_Record, value), SEEK_SET);
+  fputc(0x77, file);
+  fclose(file);
+}
+
+/// @brief Start a log from scratch and append events 1 to \a count
+static void fill(EventLog &log, uint32_t count)
+{
+  unlink(path);
+  CHECK(log.begin(path, TEST_CAPACITY));
+  for (uint32_t i = 1; i <= count; ++i)
+    CHECK(log.append(EVENT_LOG_BOOT + i % 3, 1000 + i, -(int32_t)i, i & 0xFF, 7));
+}
+
+/// @brief Events read back newest first, with every field as appended
+static void testAppendRead()
+{
+  EventLog log;
+  fill(log, 4);
+
+  EventLog_Record records[TEST_CAPACITY];
+  CHECK_EQ(log.read(records, TEST_CAPACITY), 4);
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    uint32_t seq = 4 - i;
+    CHECK_EQ(records[i].seq, seq);
+    CHECK_EQ(records[i].time, 1000 + seq);
+    CHECK_EQ(records[i].type, EVENT_LOG_BOOT + seq % 3);
+    CHECK_EQ(records[i].value, -(int32_t)seq);
+    CHECK_EQ(records[i].subject, seq);
+    CHECK_EQ(records[i].detail, 7);
+  }
+  CHECK_EQ(log.firstSeq(), 1);
+  CHECK_EQ(log.lastSeq(), 4);
+}
+
+/// @brief Once full, the oldest events are overwritten and only the last TEST_CAPACITY are kept
+static void testWrapAround()
+{
+  EventLog log;
+  fill(log, 2 * TEST_CAPACITY + 3);
+
+  EventLog_Record records[2 * TEST_CAPACITY];
+  CHECK_EQ(log.read(records, 2 * TEST_CAPACITY), TEST_CAPACITY);
+  CHECK_EQ(records[0].seq, 2 * TEST_CAPACITY + 3);
+  CHECK_EQ(records[TEST_CAPACITY - 1].seq, TEST_CAPACITY + 4);
+  CHECK_EQ(log.firstSeq(), TEST_CAPACITY + 4);
+
+  // The file never grows past the capacity
+  FILE *file = fopen(path, "rb");
+  fseek(file, 0, SEEK_END);
+  CHECK_EQ(ftell(file), TEST_CAPACITY * sizeof(EventLog_Record));
+  fclose(file);
+}
+
+/// @brief Reopening finds the newest event wherever the log stopped, before and after it first wraps
+static void testReopen()
+{
+  EventLog log;
+  unlink(path);
+  for (uint32_t seq = 1; seq <= 3 * TEST_CAPACITY + 1; ++seq)
+  {
+    CHECK(log.begin(path, TEST_CAPACITY));
+    CHECK_EQ(log.lastSeq(), seq - 1);
+    CHECK(log.append(EVENT_LOG_BOOT, seq, seq));
+    log.end();
+  }
+
+  CHECK(log.begin(path, TEST_CAPACITY));
+  EventLog_Record records[TEST_CAPACITY];
+  CHECK_EQ(log.read(records, TEST_CAPACITY), TEST_CAPACITY);
+  CHECK_EQ(records[0].seq, 3 * TEST_CAPACITY + 1);
+  CHECK_EQ(records[0].value, 3 * TEST_CAPACITY + 1);
+}
+
+/// @brief Pages read with the seq of the last record of the previous page cover every event once, in order
+static void testPaging()
+{
+  EventLog log;
+  fill(log, TEST_CAPACITY + 5);
+
+  EventLog_Record page[3];
+  uint32_t before = UINT32_MAX;
+  uint32_t expected = log.lastSeq();
+  size_t total = 0, count;
+  while ((count = log.read(page, 3, before)) > 0)
+  {
+    for (size_t i = 0; i < count; ++i)
+      CHECK_EQ(page[i].seq, expected--);
+    total += count;
+    before = page[count - 1].seq;
+  }
+  CHECK_EQ(total, TEST_CAPACITY);
+  CHECK_EQ(expected + 1, log.firstSeq());
+
+  // Nothing is older than the oldest kept
+  CHECK_EQ(log.read(page, 3, log.firstSeq()), 0);
+}
+
+/// @brief The newest record of each type is found, even when newer ones of other types follow it.
+/// A type not kept is reported missing
+static void testFindLast()
+{
+  EventLog log;
+  fill(log, TEST_CAPACITY + 2);
+
+  EventLog_Record record;
+  CHECK(log.findLast(EVENT_LOG_BOOT + 1, record));
+  CHECK_EQ(record.seq, TEST_CAPACITY);
+  CHECK(log.findLast(EVENT_LOG_BOOT + 2, record));
+  CHECK_EQ(record.seq, TEST_CAPACITY + 1);
+  CHECK(!log.findLast(EVENT_LOG_ROUTER_AUTH_FAIL, record));
+}
+
+/// @brief A torn newest record is dropped on reopening and written over by the next event
+static void testTornNewest()
+{
+  EventLog log;
+
+  // Before the log wraps
+  fill(log, 5);
+  log.end();
+  tearSlot(4);
+  CHECK(log.begin(path, TEST_CAPACITY));
+  CHECK_EQ(log.lastSeq(), 4);
+  CHECK(log.append(EVENT_LOG_REBOOT, 0, 55));
+  EventLog_Record records[TEST_CAPACITY];
+  CHECK_EQ(log.read(records, TEST_CAPACITY), 5);
+  CHECK_EQ(records[0].seq, 5);
+  CHECK_EQ(records[0].value, 55);
+
+  // After it wraps, in the middle of the file
+  fill(log, TEST_CAPACITY + 4);
+  log.end();
+  tearSlot(3);
+  CHECK(log.begin(path, TEST_CAPACITY));
+  CHECK_EQ(log.lastSeq(), TEST_CAPACITY + 3);
+
+  // After it wraps, in slot 0
+  fill(log, TEST_CAPACITY + 1);
+  log.end();
+  tearSlot(0);
+  CHECK(log.begin(path, TEST_CAPACITY));
+  CHECK_EQ(log.lastSeq(), TEST_CAPACITY);
+}
+
+/// @brief A record torn in the middle is skipped when reading, without hiding the rest
+static void testTornMiddle()
+{
+  EventLog log;
+  fill(log, 6);
+  log.end();
+  tearSlot(2);
+  CHECK(log.begin(path, TEST_CAPACITY));
+
+  EventLog_Record records[TEST_CAPACITY];
+  CHECK_EQ(log.read(records, TEST_CAPACITY), 5);
+  CHECK_EQ(records[2].seq, 4);
+  CHECK_EQ(records[3].seq, 2);
+}
+
+/// @brief Half a record at the end of the file, as left by a write cut short while the log was filling, is written over
+static void testPartialRecord()
+{
+  EventLog log;
+  fill(log, 3);
+  log.end();
+  FILE *file = fopen(path, "ab");
+  fwrite("\x04\x00\x00\x00\x01", 5, 1, file);
+  fclose(file);
+
+  CHECK(log.begin(path, TEST_CAPACITY));
+  CHECK_EQ(log.lastSeq(), 3);
+  CHECK(log.append(EVENT_LOG_BOOT, 0));
+  log.end();
+  CHECK(log.begin(path, TEST_CAPACITY));
+  CHECK_EQ(log.lastSeq(), 4);
+}
+
+/// @brief A log written with a larger capacity is started afresh
+static void testCapacityChange()
+{
+  EventLog log;
+  fill(log, TEST_CAPACITY);
+  log.end();
+
+  CHECK(log.begin(path, TEST_CAPACITY / 2));
+  CHECK_EQ(log.lastSeq(), 0);
+  EventLog_Record records[TEST_CAPACITY];
+  CHECK_EQ(log.read(records, TEST_CAPACITY), 0);
+  CHECK(!log.findLast(EVENT_LOG_BOOT, records[0]));
+}
+
+int main()
+{
+  snprintf(path, sizeof(path), "/tmp/test_eventlog_%d.bin", (int)getpid());
+
+  RUN_TEST(testAppendRead);
+  RUN_TEST(testWrapAround);
+  RUN_TEST(testReopen);
+  RUN_TEST(testPaging);
+  RUN_TEST(testFindLast);
+  RUN_TEST(testTornNewest);
+  RUN_TEST(testTornMiddle);
+  RUN_TEST(testPartialRecord);
+  RUN_TEST(testCapacityChange);
+
+  unlink(path);
+  return TEST_RESULT();
+}
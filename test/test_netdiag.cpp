@@ -0,0 +1,113 @@
+/**
+ * @file  test_netdiag.cpp
+ * @brief Runs the concurrent ICMP sweep against loopback addresses
+ */
+
+#include <arpa/inet.h>
+#include <time.h>
+
+#include "NetDiag.h"
+#include "check.h"
+
+static uint64_t nowMs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static NetDiag_Socket sock = NETDIAG_SOCKET_INIT;
+
+/// @brief Every loopback address answers every probe, and the sweep ends as soon as the last reply is in
+static void testLoopbackAnswers()
+{
+  NetDiag_PingResult results[4] = {};
+  results[0].addr = inet_addr("127.0.0.1");
+  results[1].addr = inet_addr("127.0.0.2");
+  results[2].addr = inet_addr("127.0.0.3");
+  results[3].addr = inet_addr("127.0.0.4");
+
+  uint64_t start = nowMs();
+  CHECK(netDiagSweep(&sock, results, 4, 3, 50, 2000));
+  uint64_t took = nowMs() - start;
+
+  for (const NetDiag_PingResult &r : results)
+  {
+    CHECK_EQ(r.sent, 3);
+    CHECK_EQ(r.received, 3);
+    CHECK_EQ(r.lossPercent, 0);
+    CHECK(r.rttMinUs > 0);
+    CHECK(r.rttMinUs <= r.rttAvgUs && r.rttAvgUs <= r.rttMaxUs);
+  }
+  // Two intervals between the three rounds, then no wait for the timeout
+  CHECK(took >= 100);
+  CHECK(took < 1000);
+}
+
+/// @brief A host with no address is reported as lost without sending anything, and doesn't hold up the others
+static void testUnresolvedSkipped()
+{
+  NetDiag_PingResult results[2] = {};
+  results[0].addr = 0;
+  results[1].addr = inet_addr("127.0.0.1");
+
+  uint64_t start = nowMs();
+  CHECK(netDiagSweep(&sock, results, 2, 2, 20, 2000));
+  CHECK(nowMs() - start < 1000);
+
+  CHECK_EQ(results[0].sent, 0);
+  CHECK_EQ(results[0].received, 0);
+  CHECK_EQ(results[0].lossPercent, 100);
+  CHECK_EQ(results[0].rttAvgUs, 0);
+  CHECK_EQ(results[1].received, 2);
+}
+
+/// @brief Results left over from a previous sweep are cleared, and the socket is kept open across sweeps
+static void testRepeatedSweeps()
+{
+  NetDiag_PingResult results[1] = {};
+  results[0].addr = inet_addr("127.0.0.1");
+  results[0].received = 200;
+  results[0].rttMaxUs = 12345678;
+
+  int fd = sock.fd;
+  for (int i = 0; i < 3; ++i)
+  {
+    CHECK(netDiagSweep(&sock, results, 1, 2, 10, 2000));
+    CHECK_EQ(results[0].sent, 2);
+    CHECK_EQ(results[0].received, 2);
+    CHECK(results[0].rttMaxUs < 12345678);
+  }
+  CHECK_EQ(sock.fd, fd);
+}
+
+/// @brief More hosts than NETDIAG_MAX_TARGETS are not pinged
+static void testTargetLimit()
+{
+  NetDiag_PingResult results[NETDIAG_MAX_TARGETS + 2] = {};
+  for (NetDiag_PingResult &r : results)
+    r.addr = inet_addr("127.0.0.1");
+
+  CHECK(netDiagSweep(&sock, results, NETDIAG_MAX_TARGETS + 2, 1, 10, 2000));
+  CHECK_EQ(results[0].received, 1);
+  CHECK_EQ(results[NETDIAG_MAX_TARGETS - 1].received, 1);
+  CHECK_EQ(results[NETDIAG_MAX_TARGETS].sent, 0);
+}
+
+int main()
+{
+  // Probe for an ICMP socket first. Hosts that allow neither a raw nor a datagram one can't run the rest
+  NetDiag_PingResult probe = {};
+  probe.addr = inet_addr("127.0.0.1");
+  if (!netDiagSweep(&sock, &probe, 1, 1, 10, 500))
+  {
+    printf("SKIP test_netdiag: no ICMP socket allowed. Set net.ipv4.ping_group_range to run it\n");
+    return 0;
+  }
+
+  RUN_TEST(testLoopbackAnswers);
+  RUN_TEST(testUnresolvedSkipped);
+  RUN_TEST(testRepeatedSweeps);
+  RUN_TEST(testTargetLimit);
+  return TEST_RESULT();
+}
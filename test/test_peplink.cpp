@@ -0,0 +1,452 @@
+/**
+ * @file  test_peplink.cpp
+ * @brief Runs PeplinkRouter against the mock router: logging in, recovering from expired credentials,
+ * parsing the WAN status, pipelining, and the latency and throughput of large responses
+ */
+
+#include <time.h>
+
+#include "PeplinkAPI.h"
+#include "DnsCache.h"
+#include "utils.h"
+#include "mock_router.h"
+#include "check.h"
+
+#define TEST_USERNAME "admin"
+#define TEST_PASSWORD "secret"
+
+static MockRouter mock;
+
+static uint64_t nowMs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/// @brief One WAN of each type, plus a disabled one, with priorities that differ from the router's order
+static std::vector<MockRouter_WAN> testWans()
+{
+  std::vector<MockRouter_WAN> wans(4);
+
+  wans[0].id = 1;
+  wans[0].name = "WAN 1";
+  wans[0].type = "ethernet";
+  wans[0].priority = 2;
+  wans[0].ip = "192.0.2.10";
+  wans[0].download = 1000;
+  wans[0].upload = 200;
+
+  wans[1].id = 2;
+  wans[1].name = "Cellular";
+  wans[1].type = "cellular";
+  wans[1].priority = 1;
+  wans[1].ip = "198.51.100.7";
+  wans[1].carrier = "Mock Mobile";
+  wans[1].signalLevel = 4;
+  wans[1].network = "LTE";
+  wans[1].sims = {{true, true, "8901260000000000001"}, {false, false, ""}};
+  wans[1].download = 5000;
+  wans[1].upload = 800;
+
+  wans[2].id = 3;
+  wans[2].name = "Wi-Fi WAN";
+  wans[2].type = "wifi";
+  wans[2].ip = "203.0.113.5";
+  wans[2].strength = 70;
+  wans[2].ssid = "Campsite";
+  wans[2].bssid = "aa:bb:cc:dd:ee:ff";
+  wans[2].statusLed = "yellow";
+
+  wans[3].id = 4;
+  wans[3].name = "WAN 2";
+  wans[3].type = "ethernet";
+  wans[3].priority = 3;
+  wans[3].message = "Disabled";
+  wans[3].statusLed = "gray";
+  return wans;
+}
+
+/// @brief Bring a router up against the mock the way the fob does at boot
+static bool beginRouter(PeplinkRouter &router)
+{
+  router.setIP("127.0.0.1");
+  router.setPort(mock.port());
+  return router.begin(TEST_USERNAME, TEST_PASSWORD, CLIENT_NAME_DEFAULT, CLIENT_SCOPE_READ_WRITE, false).length() > 0;
+}
+
+/// @brief A first start logs in, creates a client and is granted a token, and stores all three
+static void testLogin()
+{
+  PeplinkRouter router;
+  unsigned logins = mock.requests("/api/login");
+  size_t clients = mock.clientCount();
+
+  CHECK(beginRouter(router));
+  CHECK(router.available());
+  CHECK_EQ(mock.requests("/api/login"), logins + 1);
+  CHECK_EQ(mock.clientCount(), clients + 1);
+  CHECK(router.cookie() == mock.cookie().c_str());
+  CHECK(storedCredentials.cookie == router.cookie());
+  CHECK(router.token().length());
+  CHECK(storedCredentials.token == router.token());
+  CHECK_EQ(storedCredentials.tokenValidForS, 172800);
+  CHECK(storedCredentials.clientId.length());
+
+  // Started again from the stored credentials, the router is used straight away
+  PeplinkRouter restored("127.0.0.1", mock.port());
+  restored.setCookie(storedCredentials.cookie);
+  restored.setToken(storedCredentials.token);
+  restored.setClient(storedCredentials.clientId, storedCredentials.clientSecret);
+  CHECK(restored.begin(TEST_USERNAME, TEST_PASSWORD, CLIENT_NAME_DEFAULT, CLIENT_SCOPE_READ_WRITE, false).length());
+  CHECK(restored.getWanStatus(0, false));
+  CHECK_EQ(mock.requests("/api/login"), logins + 1);
+  CHECK_EQ(mock.clientCount(), clients + 1);
+}
+
+/// @brief A refused login returns no cookie and is logged, once nothing holds the router any more
+static void testLoginRefused()
+{
+  PeplinkRouter router("127.0.0.1", mock.port());
+  size_t events = loggedEvents.size();
+
+  CHECK(!router.login(TEST_USERNAME, "wrong").length());
+  CHECK(!router.cookie().length());
+  CHECK_EQ(loggedEvents.size(), events + 1);
+  CHECK_EQ(loggedEvents.back().type, EVENT_LOG_ROUTER_AUTH_FAIL);
+  CHECK_EQ(loggedEvents.back().value, 401);
+
+  router.lock();
+  CHECK(!router.login(TEST_USERNAME, "wrong").length());
+  CHECK_EQ(loggedEvents.size(), events + 1);
+  router.unlock();
+  CHECK_EQ(loggedEvents.size(), events + 2);
+}
+
+/// @brief A request refused with "Invalid access token" has a new token granted to the same client,
+/// so the next request goes through. Pipelined requests recover the same way
+static void testExpiredToken()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  String oldToken = router.token();
+  size_t clients = mock.clientCount();
+
+  mock.expireToken();
+  CHECK(!router.getWanStatus(0, false));
+  CHECK(router.token().length());
+  CHECK(router.token() != oldToken);
+  CHECK(storedCredentials.token == router.token());
+  CHECK(router.getWanStatus(0, false));
+  CHECK_EQ(mock.clientCount(), clients);
+
+  mock.expireToken();
+  CHECK(!router.refresh());
+  CHECK(router.refresh());
+  CHECK_EQ(mock.clientCount(), clients);
+}
+
+/// @brief When the router no longer knows the fob's client, a new client is created for the token
+static void testForgottenClient()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  String oldClient = storedCredentials.clientId;
+
+  mock.forgetClients();
+  mock.expireToken();
+  CHECK(!router.getWanStatus(0, false));
+  CHECK_EQ(mock.clientCount(), 1);
+  CHECK(storedCredentials.clientId != oldClient);
+  CHECK(router.getWanStatus(0, false));
+}
+
+/// @brief A request refused with "Unauthorized" logs in again, so the next admin request goes through
+static void testExpiredCookie()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  String oldCookie = router.cookie();
+  unsigned logins = mock.requests("/api/login");
+
+  mock.expireCookie();
+  CHECK(!router.getClientList());
+  CHECK_EQ(mock.requests("/api/login"), logins + 1);
+  CHECK(router.cookie() != oldCookie);
+  CHECK(router.cookie() == mock.cookie().c_str());
+  CHECK(storedCredentials.cookie == router.cookie());
+
+  CHECK(router.getClientList());
+  CHECK_EQ(router.numClients(), mock.clientCount());
+}
+
+/// @brief Every WAN type is parsed, and the list is sorted by priority with unprioritised WANs last
+static void testWanStatus()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  CHECK(router.getWanStatus(0, true));
+
+  router.lock();
+  const PeplinkAPI_WANTable &wans = router.wanStatus();
+  CHECK_EQ(wans.size(), 4);
+  if (wans.size() == 4)
+  {
+    const PeplinkAPI_WAN &cellular = wans.wans[0];
+    CHECK_EQ(cellular.id, 2);
+    CHECK_EQ(cellular.type, PEPLINKAPI_WAN_TYPE_CELLULAR);
+    CHECK(!strcmp(cellular.name, "Cellular"));
+    CHECK(!strcmp(cellular.ip, "198.51.100.7"));
+    CHECK(!strcmp(cellular.cellular.carrier, "Mock Mobile"));
+    CHECK(!strcmp(cellular.cellular.networkType, "LTE"));
+    CHECK_EQ(cellular.cellular.signalLevel, 4);
+    CHECK_EQ(cellular.cellular.simCount, 2);
+    CHECK(cellular.cellular.simCards[0].detected);
+    CHECK(cellular.cellular.simCards[0].active);
+    CHECK(!strcmp(cellular.cellular.simCards[0].iccid, "8901260000000000001"));
+    CHECK(!cellular.cellular.simCards[1].detected);
+    CHECK_EQ(cellular.download, 5000);
+    CHECK_EQ(cellular.upload, 800);
+
+    const PeplinkAPI_WAN &ethernet = wans.wans[1];
+    CHECK_EQ(ethernet.id, 1);
+    CHECK_EQ(ethernet.type, PEPLINKAPI_WAN_TYPE_ETHERNET);
+    CHECK(!strcmp(ethernet.status, "Connected"));
+    CHECK(!strcmp(ethernet.statusLED, "green"));
+    CHECK(!strcmp(ethernet.ip, "192.0.2.10"));
+    CHECK_EQ(ethernet.priority, 2);
+    CHECK_EQ(ethernet.download, 1000);
+    CHECK(!strcmp(ethernet.unit, "kbps"));
+
+    const PeplinkAPI_WAN &disabled = wans.wans[2];
+    CHECK_EQ(disabled.id, 4);
+    CHECK(!strcmp(disabled.status, "Disabled"));
+    CHECK(!disabled.ip[0]);
+
+    const PeplinkAPI_WAN &wifi = wans.wans[3];
+    CHECK_EQ(wifi.id, 3);
+    CHECK_EQ(wifi.type, PEPLINKAPI_WAN_TYPE_WIFI);
+    CHECK_EQ(wifi.wifi.strength, 70);
+    CHECK(!strcmp(wifi.wifi.ssid, "Campsite"));
+    CHECK(!strcmp(wifi.wifi.bssid, "aa:bb:cc:dd:ee:ff"));
+
+    for (const PeplinkAPI_WAN &wan : wans)
+      CHECK_EQ(wan.changes, PEPLINKAPI_WAN_CHANGED_ALL);
+  }
+  router.unlock();
+}
+
+/// @brief A refresh sends its four requests pipelined on the connection begin() left open
+static void testRefreshPipelined()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  unsigned connections = mock.connections();
+  unsigned wanRequests = mock.requests("/api/status.wan.connection");
+  unsigned infoRequests = mock.requests("/api/status.system.info");
+  PeplinkAPI_RequestStats_t before = router.requestStats();
+
+  CHECK(router.refresh());
+  CHECK_EQ(mock.connections(), connections);
+  CHECK_EQ(router.requestStats().connects, before.connects);
+  CHECK_EQ(mock.requests("/api/status.wan.connection"), wanRequests + 1);
+  CHECK_EQ(mock.requests("/api/status.system.info"), infoRequests + 1);
+
+  PeplinkRouterInfo info = router.info();
+  CHECK(info.name == "Mock Router");
+  CHECK(info.serial == "1111-2222-3333");
+  CHECK_EQ(info.uptime, 3600);
+  PeplinkRouterLocation location = router.location();
+  CHECK(location.latitude == "30.25");
+  CHECK(location.altitude == "150.5");
+
+  router.lock();
+  CHECK_EQ(router.wanStatus().size(), 4);
+  router.unlock();
+}
+
+/// @brief Pipelined, the four parts of a refresh take one round trip, where fetched one by one they take four
+static void testRefreshLatency()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  const uint32_t rttMs = 100;
+  mock.setLatency(rttMs);
+
+  uint64_t start = nowMs();
+  CHECK(router.refresh());
+  uint64_t pipelined = nowMs() - start;
+
+  start = nowMs();
+  CHECK(router.getWanStatus(0, false));
+  CHECK(router.getWanTraffic());
+  CHECK(router.getInfo());
+  CHECK(router.getLocation());
+  uint64_t oneByOne = nowMs() - start;
+  mock.setLatency(0);
+
+  printf("  refresh at %ums round trip: pipelined %llums, one by one %llums\n", rttMs, (unsigned long long)pipelined,
+         (unsigned long long)oneByOne);
+  CHECK(pipelined >= rttMs);
+  CHECK(pipelined < 2 * rttMs);
+  CHECK(oneByOne >= 4 * rttMs);
+}
+
+/// @brief A large WAN status is filtered down to the fields the fob keeps as it streams in, at a rate well above
+/// what the fob's Wi-Fi delivers
+static void testLargePayloadThroughput()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  mock.setPadding(16384);
+
+  const int iterations = 20;
+  uint64_t start = nowMs();
+  for (int i = 0; i < iterations; ++i)
+    CHECK(router.getWanStatus(0, false));
+  uint64_t took = nowMs() - start;
+  size_t size = mock.lastWanStatusSize();
+  mock.setPadding(0);
+
+  double kBps = took ? (double)size * iterations / took : 0;
+  printf("  %d WAN status responses of %zu bytes in %llums, %.0f kB/s\n", iterations, size, (unsigned long long)took, kBps);
+  CHECK(size > 64000);
+  CHECK(!took || kBps > 1000);
+
+  router.lock();
+  CHECK_EQ(router.wanStatus().size(), 4);
+  router.unlock();
+}
+
+/// @brief Chunked responses are decoded on both the single and the pipelined path, and for the login
+static void testChunked()
+{
+  PeplinkRouter router;
+  mock.setChunked(true);
+  mock.setPadding(4096);
+
+  CHECK(beginRouter(router));
+  CHECK(router.getWanStatus(0, true));
+  CHECK(router.refresh());
+  CHECK(router.refresh());
+  mock.setChunked(false);
+  mock.setPadding(0);
+
+  router.lock();
+  CHECK_EQ(router.wanStatus().size(), 4);
+  router.unlock();
+  CHECK(router.info().name == "Mock Router");
+}
+
+/// @brief Requests after the first reuse its connection
+static void testKeepAlive()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  unsigned connections = mock.connections();
+  PeplinkAPI_RequestStats_t before = router.requestStats();
+
+  for (int i = 0; i < 5; ++i)
+  {
+    CHECK(router.getWanStatus(0, true));
+    CHECK(router.getInfo());
+  }
+  CHECK_EQ(mock.connections(), connections);
+  CHECK_EQ(router.requestStats().connects, before.connects);
+  CHECK_EQ(router.requestStats().requests, before.requests + 15);
+}
+
+/// @brief A GET whose kept-alive connection drops before the answer is sent again on a new connection
+static void testDroppedGetRetried()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  CHECK(router.getWanStatus(0, false));
+  unsigned requests = mock.requests("/api/status.wan.connection");
+  PeplinkAPI_RequestStats_t before = router.requestStats();
+
+  mock.dropNext("/api/status.wan.connection");
+  CHECK(router.getWanStatus(0, false));
+  CHECK_EQ(mock.requests("/api/status.wan.connection"), requests + 2);
+  CHECK_EQ(router.requestStats().reconnects, before.reconnects + 1);
+}
+
+/// @brief A POST whose connection drops after the router got it isn't sent again, as the router may have acted on it
+static void testDroppedPostNotRetried()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  CHECK(router.getWanStatus(0, false));
+  unsigned logins = mock.requests("/api/login");
+  PeplinkAPI_RequestStats_t before = router.requestStats();
+
+  mock.dropNext("/api/login");
+  CHECK(!router.login(TEST_USERNAME, TEST_PASSWORD).length());
+  CHECK_EQ(mock.requests("/api/login"), logins + 1);
+  CHECK_EQ(router.requestStats().reconnects, before.reconnects);
+  CHECK_EQ(router.requestStats().failures, before.failures + 1);
+
+  // The next one goes out on a new connection
+  CHECK(router.login(TEST_USERNAME, TEST_PASSWORD).length());
+}
+
+/// @brief A router known by name is looked up through the DNS cache, so a new connection doesn't look it up again
+static void testRouterByName()
+{
+  DnsCache dns;
+  unsigned lookups = WiFi.lookups;
+
+  PeplinkRouter router("localhost", mock.port());
+  router.setResolver(&dns);
+  CHECK(router.login(TEST_USERNAME, TEST_PASSWORD).length());
+  CHECK_EQ(WiFi.lookups, lookups + 1);
+
+  PeplinkRouter again("localhost", mock.port());
+  again.setResolver(&dns);
+  CHECK(again.login(TEST_USERNAME, TEST_PASSWORD).length());
+  CHECK_EQ(WiFi.lookups, lookups + 1);
+}
+
+/// @brief A reboot is sent, and the router is marked unavailable until it comes back
+static void testReboot()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router));
+  unsigned reboots = mock.reboots();
+
+  CHECK(router.remoterReboot());
+  CHECK_EQ(mock.reboots(), reboots + 1);
+  CHECK(!router.available());
+}
+
+int main()
+{
+  if (!mock.start())
+  {
+    printf("SKIP test_peplink: can't listen on loopback\n");
+    return 0;
+  }
+  mock.setCredentials(TEST_USERNAME, TEST_PASSWORD);
+  mock.setWans(testWans());
+  fob.routers.username = TEST_USERNAME;
+  fob.routers.password = TEST_PASSWORD;
+
+  RUN_TEST(testLogin);
+  RUN_TEST(testLoginRefused);
+  RUN_TEST(testExpiredToken);
+  RUN_TEST(testForgottenClient);
+  RUN_TEST(testExpiredCookie);
+  RUN_TEST(testWanStatus);
+  RUN_TEST(testRefreshPipelined);
+  RUN_TEST(testRefreshLatency);
+  RUN_TEST(testLargePayloadThroughput);
+  RUN_TEST(testChunked);
+  RUN_TEST(testKeepAlive);
+  RUN_TEST(testDroppedGetRetried);
+  RUN_TEST(testDroppedPostNotRetried);
+  RUN_TEST(testRouterByName);
+  RUN_TEST(testReboot);
+
+  mock.stop();
+  return TEST_RESULT();
+}
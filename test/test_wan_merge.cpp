@@ -0,0 +1,322 @@
+/**
+ * @file  test_wan_merge.cpp
+ * @brief Runs PeplinkRouter's WAN table updates against the mock router: how full and single WAN responses
+ * are merged into the table, which changes are flagged, and how the table is ordered
+ */
+
+#include "PeplinkAPI.h"
+#include "utils.h"
+#include "mock_router.h"
+#include "check.h"
+
+#define TEST_USERNAME "admin"
+#define TEST_PASSWORD "secret"
+
+static MockRouter mock;
+
+static MockRouter_WAN ethernetWan(int id, const char *name, int priority)
+{
+  MockRouter_WAN wan;
+  wan.id = id;
+  wan.name = name;
+  wan.type = "ethernet";
+  wan.priority = priority;
+  wan.ip = "192.0.2." + std::to_string(id);
+  wan.download = 100 * id;
+  wan.upload = 10 * id;
+  return wan;
+}
+
+static MockRouter_WAN cellularWan(int id, const char *name, int priority)
+{
+  MockRouter_WAN wan;
+  wan.id = id;
+  wan.name = name;
+  wan.type = "cellular";
+  wan.priority = priority;
+  wan.ip = "198.51.100." + std::to_string(id);
+  wan.carrier = "Mock Mobile";
+  wan.signalLevel = 3;
+  wan.network = "LTE";
+  wan.sims = {{true, true, "8901260000000000001"}, {true, false, "8901260000000000002"}};
+  return wan;
+}
+
+/// @brief Three ethernet WANs, listed in priority order
+static std::vector<MockRouter_WAN> threeWans()
+{
+  return {ethernetWan(1, "WAN 1", 1), ethernetWan(2, "WAN 2", 2), ethernetWan(3, "WAN 3", 3)};
+}
+
+/// @brief Bring a router up against the mock and fetch the WANs \a wans with their traffic
+static bool beginRouter(PeplinkRouter &router, const std::vector<MockRouter_WAN> &wans)
+{
+  mock.setWans(wans);
+  router.setIP("127.0.0.1");
+  router.setPort(mock.port());
+  return router.begin(TEST_USERNAME, TEST_PASSWORD, CLIENT_NAME_DEFAULT, CLIENT_SCOPE_READ_WRITE, false).length() > 0 &&
+         router.getWanStatus(0, true);
+}
+
+/// @brief Return a copy of the listed WAN with \a id. Its id is 0 if it isn't listed
+static PeplinkAPI_WAN wanCopy(PeplinkRouter &router, int id)
+{
+  PeplinkAPI_WAN copy;
+  memset(&copy, 0, sizeof(copy));
+  router.lock();
+  const PeplinkAPI_WAN *wan = router.wanStatus().find(id);
+  if (wan)
+    copy = *wan;
+  router.unlock();
+  return copy;
+}
+
+/// @brief Check that the table lists exactly the WANs with \a ids, in that order
+static void checkIds(PeplinkRouter &router, std::vector<int> ids)
+{
+  router.lock();
+  const PeplinkAPI_WANTable &wans = router.wanStatus();
+  CHECK_EQ(wans.size(), ids.size());
+  for (size_t i = 0; i < wans.size() && i < ids.size(); ++i)
+    CHECK_EQ(wans.wans[i].id, ids[i]);
+  router.unlock();
+}
+
+/// @brief A WAN fetched on its own that comes back unnamed or of an unsupported type is removed,
+/// and the other WANs keep their status and traffic
+static void testSingleWanUnnamedRemoved()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans[1].name = "";
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(2, false));
+  checkIds(router, {1, 3});
+
+  wans[2].type = "vpn";
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(3, false));
+  checkIds(router, {1});
+
+  router.lock();
+  const PeplinkAPI_WAN *wan = router.wanStatus().find(1);
+  CHECK(wan && !strcmp(wan->name, "WAN 1"));
+  CHECK(wan && !strcmp(wan->ip, "192.0.2.1"));
+  CHECK(wan && wan->download == 100);
+  CHECK(!router.wanStatus().find(2));
+  CHECK(!router.wanStatus().find(3));
+  router.unlock();
+}
+
+/// @brief An unnamed WAN the table doesn't list yet is never added, whether fetched on its own or in a full listing
+static void testUnnamedNotAdded()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans.push_back(ethernetWan(4, "", 4));
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(4, false));
+  checkIds(router, {1, 2, 3});
+  CHECK(router.getWanStatus(0, false));
+  checkIds(router, {1, 2, 3});
+}
+
+/// @brief New WANs are flagged as all changed. Fetched again, unchanged WANs are flagged unchanged,
+/// and each changed field raises its own flag
+static void testChangeFlags()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+  for (int id = 1; id <= 3; ++id)
+    CHECK_EQ(wanCopy(router, id).changes, PEPLINKAPI_WAN_CHANGED_ALL);
+
+  CHECK(router.getWanStatus(0, true));
+  for (int id = 1; id <= 3; ++id)
+    CHECK_EQ(wanCopy(router, id).changes, 0);
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans[0].statusLed = "red";
+  wans[0].download = 555;
+  wans[1].ip = "192.0.2.200";
+  wans[2].message = "No cable detected";
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, true));
+  CHECK_EQ(wanCopy(router, 1).changes, PEPLINKAPI_WAN_CHANGED_LED | PEPLINKAPI_WAN_CHANGED_TRAFFIC);
+  CHECK_EQ(wanCopy(router, 2).changes, PEPLINKAPI_WAN_CHANGED_IP);
+  CHECK_EQ(wanCopy(router, 3).changes, PEPLINKAPI_WAN_CHANGED_STATUS);
+  CHECK_EQ(wanCopy(router, 1).download, 555);
+  CHECK(!strcmp(wanCopy(router, 2).ip, "192.0.2.200"));
+}
+
+/// @brief Cellular signal and SIM changes are flagged apart, and a WAN changing type is flagged as changed throughout
+static void testCellularAndTypeChanges()
+{
+  std::vector<MockRouter_WAN> wans = {ethernetWan(1, "WAN 1", 1), cellularWan(2, "Cellular", 2)};
+  PeplinkRouter router;
+  CHECK(beginRouter(router, wans));
+  CHECK(router.getWanStatus(0, true));
+
+  wans[1].signalLevel = 5;
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  CHECK_EQ(wanCopy(router, 2).changes, PEPLINKAPI_WAN_CHANGED_SIGNAL);
+  CHECK_EQ(wanCopy(router, 2).cellular.signalLevel, 5);
+
+  wans[1].sims[0].active = false;
+  wans[1].sims[1].active = true;
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  CHECK_EQ(wanCopy(router, 2).changes, PEPLINKAPI_WAN_CHANGED_SIM);
+  CHECK(wanCopy(router, 2).cellular.simCards[1].active);
+
+  wans[0].type = "wifi";
+  wans[0].ssid = "Campsite";
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  PeplinkAPI_WAN wifi = wanCopy(router, 1);
+  CHECK_EQ(wifi.type, PEPLINKAPI_WAN_TYPE_WIFI);
+  CHECK(!strcmp(wifi.wifi.ssid, "Campsite"));
+  CHECK_EQ(wifi.changes, PEPLINKAPI_WAN_CHANGED_STATUS | PEPLINKAPI_WAN_CHANGED_SIGNAL | PEPLINKAPI_WAN_CHANGED_SIM);
+}
+
+/// @brief Fetching one WAN updates only its entry, status and traffic, through both the single and the pipelined path
+static void testSingleWanKeepsOthers()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans[0].message = "Connecting";
+  wans[0].download = 1;
+  wans[1].message = "Standby";
+  wans[1].download = 2;
+  mock.setWans(wans);
+
+  CHECK(router.getWanStatus(2, true));
+  checkIds(router, {1, 2, 3});
+  CHECK(!strcmp(wanCopy(router, 1).status, "Connected"));
+  CHECK_EQ(wanCopy(router, 1).download, 100);
+  CHECK(!strcmp(wanCopy(router, 2).status, "Standby"));
+  CHECK_EQ(wanCopy(router, 2).download, 2);
+
+  wans[1].message = "Connected";
+  wans[1].download = 3;
+  mock.setWans(wans);
+  CHECK(router.refresh(PEPLINKAPI_STATE_WAN_STATUS | PEPLINKAPI_STATE_WAN_TRAFFIC, 2));
+  checkIds(router, {1, 2, 3});
+  CHECK(!strcmp(wanCopy(router, 1).status, "Connected"));
+  CHECK_EQ(wanCopy(router, 1).download, 100);
+  CHECK(!strcmp(wanCopy(router, 2).status, "Connected"));
+  CHECK_EQ(wanCopy(router, 2).download, 3);
+}
+
+/// @brief A status fetch without traffic keeps the bandwidth the last traffic fetch stored
+static void testTrafficPreserved()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans[0].download = 999;
+  wans[0].statusLed = "red";
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+
+  PeplinkAPI_WAN wan = wanCopy(router, 1);
+  CHECK(!strcmp(wan.statusLED, "red"));
+  CHECK_EQ(wan.download, 100);
+  CHECK_EQ(wan.upload, 10);
+  CHECK(!strcmp(wan.unit, "kbps"));
+}
+
+/// @brief A full listing drops the WANs it leaves out. A single WAN response leaves the others alone
+static void testMissingWanDropped()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans.erase(wans.begin() + 1);
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(1, false));
+  checkIds(router, {1, 2, 3});
+  CHECK(router.getWanStatus(0, false));
+  checkIds(router, {1, 3});
+  CHECK_EQ(wanCopy(router, 3).download, 300);
+}
+
+/// @brief The table follows priority changes, keeps its order among equal priorities, and lists
+/// WANs with no priority last
+static void testPriorityOrder()
+{
+  PeplinkRouter router;
+  CHECK(beginRouter(router, threeWans()));
+
+  std::vector<MockRouter_WAN> wans = threeWans();
+  wans[0].priority = 3;
+  wans[2].priority = 1;
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  checkIds(router, {3, 2, 1});
+
+  for (MockRouter_WAN &wan : wans)
+    wan.priority = 2;
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  checkIds(router, {3, 2, 1});
+
+  wans[2].priority = 0;
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  checkIds(router, {2, 1, 3});
+}
+
+/// @brief WANs beyond PEPLINK_MAX_WANS are left out, and the ones listed keep updating
+static void testTableFull()
+{
+  std::vector<MockRouter_WAN> wans;
+  for (int id = 1; id <= PEPLINK_MAX_WANS + 2; ++id)
+    wans.push_back(ethernetWan(id, ("WAN " + std::to_string(id)).c_str(), id));
+  PeplinkRouter router;
+  CHECK(beginRouter(router, wans));
+
+  std::vector<int> ids;
+  for (int id = 1; id <= PEPLINK_MAX_WANS; ++id)
+    ids.push_back(id);
+  checkIds(router, ids);
+
+  wans[0].message = "Standby";
+  mock.setWans(wans);
+  CHECK(router.getWanStatus(0, false));
+  checkIds(router, ids);
+  CHECK(!strcmp(wanCopy(router, 1).status, "Standby"));
+}
+
+int main()
+{
+  if (!mock.start())
+  {
+    printf("SKIP test_wan_merge: can't listen on loopback\n");
+    return 0;
+  }
+  mock.setCredentials(TEST_USERNAME, TEST_PASSWORD);
+  fob.routers.username = TEST_USERNAME;
+  fob.routers.password = TEST_PASSWORD;
+
+  RUN_TEST(testSingleWanUnnamedRemoved);
+  RUN_TEST(testUnnamedNotAdded);
+  RUN_TEST(testChangeFlags);
+  RUN_TEST(testCellularAndTypeChanges);
+  RUN_TEST(testSingleWanKeepsOthers);
+  RUN_TEST(testTrafficPreserved);
+  RUN_TEST(testMissingWanDropped);
+  RUN_TEST(testPriorityOrder);
+  RUN_TEST(testTableFull);
+
+  mock.stop();
+  return TEST_RESULT();
+}